@@ -1,7 +1,7 @@
 # -*- mode: cmake; tab-width: 2; indent-tabs-mode: t; truncate-lines: t; compile-command: "cmake -Wdev" -*-
 # vim: set filetype=cmake autoindent tabstop=2 shiftwidth=2 noexpandtab softtabstop=2 nowrap:
 
-# This file sets up six lists:
+# This file sets up seven lists:
 # MAIN_SOURCE_FILES     List of compilation units which will be included in
 #                       the library. If it isn't on this list, it won't be
 #                       part of the library. Please try to keep it sorted to
@@ -17,6 +17,9 @@
 #                       build, but which is not part of the library nor is
 #                       run as tests.
 #
+# BENCHMARK_SOURCE_FILES Programs that time the grid, which are only built
+#                       by the "benchmarks" target.
+#
 # PUBLIC_HEADER_FILES   List of public header files that should be
 #                       distributed together with the library. The source
 #                       files can of course include other files than these;
@@ -39,9 +42,14 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/cpgrid/PartitionTypeIndicator.cpp
   opm/grid/cpgrid/CpGridUtilities.cpp
   opm/grid/cpgrid/processEclipseFormat.cpp
+  opm/grid/cpgrid/ProcessedGridIO.cpp
+  opm/grid/cpgrid/CellCommunicationPlan.cpp
+  opm/grid/cpgrid/CellRenumbering.cpp
+  opm/grid/common/CellGraphPartition.cpp
   opm/grid/common/GeometryHelpers.cpp
   opm/grid/common/GridPartitioning.cpp
   opm/grid/common/MetisPartition.cpp
+  opm/grid/common/PartitionCache.cpp
   opm/grid/common/WellConnections.cpp
   opm/grid/common/ZoltanGraphFunctions.cpp
   opm/grid/common/ZoltanPartition.cpp
@@ -62,8 +70,10 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/cpgpreprocess/uniquepoints.c
   opm/grid/UnstructuredGrid.c
   opm/grid/grid_equal.cpp
+  opm/grid/transmissibility/CpGridTransTpfa.cpp
   opm/grid/utility/compressedToCartesian.cpp
   opm/grid/utility/cartesianToCompressed.cpp
+  opm/grid/utility/PhaseTimings.cpp
   opm/grid/utility/StopWatch.cpp
   opm/grid/utility/WachspressCoord.cpp
   )
@@ -83,25 +93,35 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_communication_utils.cpp
   tests/test_column_extract.cpp
   tests/cpgrid/addLgrsOnDistributedGrid_test.cpp
+  tests/cpgrid/cell_renumbering_test.cpp
+  tests/cpgrid/dense_index_map_test.cpp
   tests/cpgrid/distribution_test.cpp
   tests/cpgrid/entityrep_test.cpp
   tests/cpgrid/entity_test.cpp
   tests/cpgrid/facetag_test.cpp
+  tests/cpgrid/intersection_table_test.cpp
   tests/cpgrid/orientedentitytable_test.cpp
+  tests/cpgrid/overlap_layer_test.cpp
   tests/cpgrid/partition_iterator_test.cpp
+  tests/cpgrid/processed_grid_io_test.cpp
   tests/cpgrid/zoltan_test.cpp
   tests/test_cellCentroid_polyhedralGrid.cpp
+  tests/test_celllocator.cpp
   tests/test_compressed_cartesian_mapping.cpp
   tests/test_elementchunks.cpp
   tests/test_geom2d.cpp
   tests/test_gridutilities.cpp
   tests/test_lookupdata_polyhedral.cpp
   tests/test_minpvprocessor.cpp
+  tests/test_phasetimings.cpp
   tests/test_polyhedralgrid.cpp
+  tests/test_polyhedralgrid_loadbalance.cpp
+  tests/test_preprocess_slabs.cpp
   tests/test_quadratures.cpp
   tests/test_repairzcorn.cpp
   tests/test_sparsetable.cpp
   tests/test_subgridpart.cpp
+  tests/test_transtpfa.cpp
 	)
 
 if(Boost_VERSION_STRING VERSION_GREATER 1.53)
@@ -127,6 +147,12 @@ if(Boost_VERSION_STRING VERSION_GREATER 1.53)
   )
 endif()
 
+if (opm-common_FOUND)
+  list(APPEND TEST_SOURCE_FILES
+		tests/test_velocityinterpolation_cpgrid.cpp
+	)
+endif()
+
 if(HAVE_ECL_INPUT)
   list(APPEND TEST_SOURCE_FILES
 		tests/test_regionmapping.cpp
@@ -162,6 +188,12 @@ list (APPEND EXAMPLE_SOURCE_FILES
 list (APPEND PROGRAM_SOURCE_FILES
   examples/mirror_grid.cpp
   )
+list (APPEND BENCHMARK_SOURCE_FILES
+  benchmarks/communication_benchmark.cpp
+  benchmarks/construction_benchmark.cpp
+  benchmarks/traversal_benchmark.cpp
+  )
+
 if(HAVE_ECL_INPUT)
   list(APPEND EXAMPLE_SOURCE_FILES examples/grdecl2vtu.cpp)
   list(APPEND PROGRAM_SOURCE_FILES examples/grdecl2vtu.cpp)
@@ -170,20 +202,25 @@ endif()
 # originally generated with the command:
 # find dune -name '*.h*' -a ! -name '*-pch.hpp' -printf '\t%p\n' | sort
 list (APPEND PUBLIC_HEADER_FILES
+  opm/grid/common/CellGraphPartition.hpp
   opm/grid/common/CommunicationUtils.hpp
   opm/grid/common/GeometryHelpers.hpp
   opm/grid/common/GridAdapter.hpp
   opm/grid/common/GridPartitioning.hpp
+  opm/grid/common/PartitionCache.hpp
   opm/grid/common/Volumes.hpp
   opm/grid/common/p2pcommunicator.hh
   opm/grid/common/p2pcommunicator_impl.hh
   opm/grid/common/WellConnections.hpp
   opm/grid/cpgrid/CartesianIndexMapper.hpp
+  opm/grid/cpgrid/CellCommunicationPlan.hpp
+  opm/grid/cpgrid/CommunicationRequest.hpp
   opm/grid/cpgrid/CpGridData.hpp
   opm/grid/cpgrid/CpGridDataTraits.hpp
   opm/grid/cpgrid/CpGridUtilities.hpp
   opm/grid/cpgrid/DataHandleWrappers.hpp
   opm/grid/cpgrid/DefaultGeometryPolicy.hpp
+  opm/grid/cpgrid/DenseIndexMap.hpp
   opm/grid/cpgrid/dgfparser.hh
   opm/grid/cpgrid/Entity2IndexDataHandle.hpp
   opm/grid/cpgrid/Entity.hpp
@@ -195,6 +232,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/CpGrid.hpp
   opm/grid/cpgrid/Indexsets.hpp
   opm/grid/cpgrid/Intersection.hpp
+  opm/grid/cpgrid/IntersectionTable.hpp
   opm/grid/cpgrid/Iterators.hpp
   opm/grid/LookUpCellCentroid.hh
   opm/grid/LookUpData.hh
@@ -213,6 +251,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/common/ZoltanPartition.hpp
   opm/grid/polyhedralgrid/capabilities.hh
   opm/grid/polyhedralgrid/cartesianindexmapper.hh
+  opm/grid/polyhedralgrid/communication.hh
   opm/grid/polyhedralgrid/declaration.hh
   opm/grid/polyhedralgrid/dgfparser.hh
   opm/grid/polyhedralgrid/entity.hh
@@ -247,15 +286,18 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/cpgpreprocess/geometry.h
   opm/grid/cpgpreprocess/preprocess.h
   opm/grid/cpgpreprocess/uniquepoints.h
+  opm/grid/transmissibility/CpGridTransTpfa.hpp
   opm/grid/transmissibility/trans_tpfa.h
   opm/grid/transmissibility/TransTpfa.hpp
   opm/grid/transmissibility/TransTpfa_impl.hpp
   opm/grid/utility/compressedToCartesian.hpp
   opm/grid/utility/cartesianToCompressed.hpp
   opm/grid/utility/createThreadIterators.hpp
+  opm/grid/utility/CellLocator.hpp
   opm/grid/utility/ElementChunks.hpp
   opm/grid/utility/IteratorRange.hpp
   opm/grid/utility/OpmWellType.hpp
+  opm/grid/utility/PhaseTimings.hpp
   opm/grid/utility/RegionMapping.hpp
   opm/grid/utility/SparseTable.hpp
   opm/grid/utility/StopWatch.hpp
@@ -0,0 +1,335 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_GRID_BENCHMARKSUITE_HEADER
+#define OPM_GRID_BENCHMARKSUITE_HEADER
+
+#include <opm/grid/cpgpreprocess/preprocess.h>
+#include <opm/grid/cpgrid/CpGridDataTraits.hpp>
+#include <opm/grid/utility/StopWatch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Common parts of the grid benchmarks: the command line options, the
+/// synthetic models and the JSON report of the timings.
+namespace Opm::GridBenchmark
+{
+
+/// \brief Command line options shared by all benchmarks.
+struct Options
+{
+    /// Logical cartesian size of the synthetic models.
+    std::array<int, 3> dims = {40, 40, 20};
+    /// Number of timed runs of each benchmark.
+    int repetitions = 5;
+    /// Number of chunks, and OpenMP threads, of the chunked loops.
+    int threads = 1;
+    /// Number of cells marked for refinement by the adapt() benchmark.
+    int markedCells = 64;
+    /// Eclipse decks to process in addition to the synthetic models.
+    std::vector<std::string> decks;
+    /// File to write the JSON report to, standard output if empty.
+    std::string output;
+};
+
+inline const char* usage()
+{
+    return "Options:\n"
+           "  --dims NX NY NZ      size of the synthetic models (default 40 40 20)\n"
+           "  --repetitions N      timed runs of each benchmark (default 5)\n"
+           "  --threads N          chunks and OpenMP threads of chunked loops (default 1)\n"
+           "  --marked N           cells marked for refinement (default 64)\n"
+           "  --deck FILE          Eclipse deck to benchmark, may be repeated\n"
+           "  --output FILE        write the JSON report to FILE instead of stdout\n";
+}
+
+/// \brief Parse the command line.
+///
+/// Throws std::invalid_argument for unknown options and invalid values.
+inline Options parseOptions(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value of " + arg);
+            }
+            return argv[++i];
+        };
+        auto positive = [&]() {
+            const int number = std::stoi(value());
+            if (number <= 0) {
+                throw std::invalid_argument(arg + " must be positive");
+            }
+            return number;
+        };
+
+        if (arg == "--dims") {
+            for (auto& dim : options.dims) {
+                dim = positive();
+            }
+        } else if (arg == "--repetitions") {
+            options.repetitions = positive();
+        } else if (arg == "--threads") {
+            options.threads = positive();
+        } else if (arg == "--marked") {
+            options.markedCells = positive();
+        } else if (arg == "--deck") {
+            options.decks.push_back(value());
+        } else if (arg == "--output") {
+            options.output = value();
+        } else {
+            throw std::invalid_argument("Unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+/// \brief Name of a synthetic model in the report.
+inline std::string modelName(const std::string& kind, const std::array<int, 3>& dims)
+{
+    return kind + "_" + std::to_string(dims[0]) + "x" + std::to_string(dims[1])
+        + "x" + std::to_string(dims[2]);
+}
+
+/// \brief A scalable corner-point model with faults.
+///
+/// The pillars are tilted, and every fourth column of cells is shifted
+/// along the pillars, such that the faces between the columns are split
+/// into several fault faces. The model is generated from a fixed seed, so
+/// that all runs process the same grid.
+struct FaultedModel
+{
+    explicit FaultedModel(const std::array<int, 3>& d)
+        : dims(d)
+        , coord(6 * (d[0] + 1) * (d[1] + 1))
+        , zcorn(8 * std::size_t(d[0]) * d[1] * d[2])
+        , actnum(std::size_t(d[0]) * d[1] * d[2], 1)
+    {
+        const int nx = dims[0];
+        const int ny = dims[1];
+        const int nz = dims[2];
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> unif(0.0, 1.0);
+
+        for (int j = 0; j <= ny; ++j) {
+            for (int i = 0; i <= nx; ++i) {
+                double* c = &coord[6 * (i + (nx + 1) * j)];
+                c[0] = i;   c[1] = j;   c[2] = 0.0;
+                c[3] = i + 0.2 * unif(gen);   c[4] = j;   c[5] = nz;
+            }
+        }
+        for (int k = 0; k < nz; ++k) {
+            for (int j = 0; j < ny; ++j) {
+                for (int i = 0; i < nx; ++i) {
+                    const double displacement = (i / 4) % 2 == 1 ? 0.5 : 0.0;
+                    for (int kk = 0; kk < 2; ++kk) {
+                        for (int jj = 0; jj < 2; ++jj) {
+                            for (int ii = 0; ii < 2; ++ii) {
+                                const std::size_t ix = (2*i + ii)
+                                    + 2*std::size_t(nx)*((2*j + jj) + 2*std::size_t(ny)*(2*k + kk));
+                                zcorn[ix] = k + kk + displacement;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        for (auto& active : actnum) {
+            active = unif(gen) > 0.05;
+        }
+    }
+
+    grdecl input() const
+    {
+        grdecl g;
+        std::copy(dims.begin(), dims.end(), g.dims);
+        g.coord = coord.data();
+        g.zcorn = zcorn.data();
+        g.actnum = actnum.data();
+        return g;
+    }
+
+    std::array<int, 3> dims;
+    std::vector<double> coord;
+    std::vector<double> zcorn;
+    std::vector<int> actnum;
+};
+
+/// \brief Timings of the benchmarks of one program, written as JSON.
+///
+/// Each repetition is timed on every process, the report holds the
+/// maximum over the processes. Only rank zero writes the report.
+class Report
+{
+public:
+    using Communication = Dune::cpgrid::CpGridDataTraits::Communication;
+
+    Report(const std::string& suite, const Options& options, const Communication& comm)
+        : suite_(suite), options_(options), comm_(comm)
+    {}
+
+    /// \brief Time a benchmark.
+    ///
+    /// \param name  the name of the benchmark.
+    /// \param model the name of the model it runs on.
+    /// \param cells the number of cells of the model.
+    /// \param setup called before each repetition and not timed.
+    /// \param body  the code to time.
+    template<class Setup, class Body>
+    void run(const std::string& name, const std::string& model, std::size_t cells,
+             Setup&& setup, Body&& body)
+    {
+        Result result{name, model, cells, {}};
+        for (int rep = 0; rep < options_.repetitions; ++rep) {
+            setup();
+            comm_.barrier();
+            Opm::time::StopWatch clock;
+            clock.start();
+            body();
+            clock.stop();
+            result.seconds.push_back(comm_.max(clock.secsSinceStart()));
+        }
+        results_.push_back(std::move(result));
+    }
+
+    template<class Body>
+    void run(const std::string& name, const std::string& model, std::size_t cells, Body&& body)
+    {
+        run(name, model, cells, []{}, std::forward<Body>(body));
+    }
+
+    /// \brief Record a time measured by the benchmark itself.
+    ///
+    /// For phases that cannot be repeated on their own, e.g. the parsing of
+    /// a deck, which is timed once per repetition of the whole pipeline.
+    void add(const std::string& name, const std::string& model, std::size_t cells,
+             const std::vector<double>& seconds)
+    {
+        Result result{name, model, cells, {}};
+        for (double s : seconds) {
+            result.seconds.push_back(comm_.max(s));
+        }
+        results_.push_back(std::move(result));
+    }
+
+    /// \brief Write the report to the output file, or standard output.
+    void write() const
+    {
+        if (comm_.rank() != 0) {
+            return;
+        }
+        if (options_.output.empty()) {
+            write(std::cout);
+            return;
+        }
+        std::ofstream out(options_.output);
+        if (!out) {
+            throw std::runtime_error("Could not open " + options_.output + " for writing.");
+        }
+        write(out);
+    }
+
+    void write(std::ostream& os) const
+    {
+        os << std::setprecision(std::numeric_limits<double>::max_digits10);
+        os << "{\n"
+           << "  \"suite\": " << quoted(suite_) << ",\n"
+           << "  \"ranks\": " << comm_.size() << ",\n"
+           << "  \"threads\": " << options_.threads << ",\n"
+           << "  \"repetitions\": " << options_.repetitions << ",\n"
+           << "  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const auto& result = results_[i];
+            const auto [min, max] = std::minmax_element(result.seconds.begin(), result.seconds.end());
+            double mean = 0.0;
+            for (double s : result.seconds) {
+                mean += s;
+            }
+            mean /= result.seconds.size();
+
+            os << (i == 0 ? "\n" : ",\n")
+               << "    {\"name\": " << quoted(result.name)
+               << ", \"model\": " << quoted(result.model)
+               << ", \"cells\": " << result.cells
+               << ", \"min\": " << *min
+               << ", \"mean\": " << mean
+               << ", \"max\": " << *max
+               << ", \"seconds\": [";
+            for (std::size_t s = 0; s < result.seconds.size(); ++s) {
+                os << (s == 0 ? "" : ", ") << result.seconds[s];
+            }
+            os << "]}";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+private:
+    struct Result
+    {
+        std::string name;
+        std::string model;
+        std::size_t cells;
+        std::vector<double> seconds;
+    };
+
+    static std::string quoted(const std::string& str)
+    {
+        std::ostringstream os;
+        os << '"';
+        for (char c : str) {
+            switch (c) {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                       << std::dec << std::setfill(' ');
+                } else {
+                    os << c;
+                }
+            }
+        }
+        os << '"';
+        return os.str();
+    }
+
+    std::string suite_;
+    const Options& options_;
+    Communication comm_;
+    std::vector<Result> results_;
+};
+
+} // namespace Opm::GridBenchmark
+
+#endif // OPM_GRID_BENCHMARKSUITE_HEADER
@@ -0,0 +1,186 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file communication_benchmark.cpp
+ * @brief Time the distribution of CpGrids and the halo exchanges.
+ *
+ * Times loadBalance() of the cartesian model and of the Eclipse decks given
+ * on the command line, and the exchange of cell values on the distributed
+ * grid with communicate(), startCommunicate() and a cell communication
+ * plan. Run it with mpirun, the number of processes is the number of
+ * partitions.
+ */
+
+#include <config.h>
+
+#include "BenchmarkSuite.hpp"
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/CellCommunicationPlan.hpp>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#endif
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace Opm::GridBenchmark;
+
+namespace {
+
+/// Copies one value per cell.
+class CellValueHandle
+{
+public:
+    using DataType = double;
+
+    explicit CellValueHandle(std::vector<double>& values)
+        : values_(values)
+    {}
+
+    bool fixedSize(int /*dim*/, int /*codim*/)
+    {
+        return true;
+    }
+
+    bool contains(int dim, int codim)
+    {
+        return dim == 3 && codim == 0;
+    }
+
+    template<class T>
+    std::size_t size(const T&)
+    {
+        return 1;
+    }
+
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        buffer.write(values_[t.index()]);
+    }
+
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t)
+    {
+        buffer.read(values_[t.index()]);
+    }
+
+private:
+    std::vector<double>& values_;
+};
+
+void benchmarkCommunication(Report& report, const std::string& model,
+                            const std::function<void(Dune::CpGrid&)>& build)
+{
+    std::size_t cells = 0;
+    {
+        Dune::CpGrid global;
+        build(global);
+        cells = global.comm().max(global.size(0));
+    }
+
+    std::unique_ptr<Dune::CpGrid> grid;
+    report.run("loadBalance", model, cells,
+               [&] {
+                   grid = std::make_unique<Dune::CpGrid>();
+                   build(*grid);
+               },
+               [&] { grid->loadBalance(); });
+
+    const auto& gv = grid->leafGridView();
+    std::vector<double> values(grid->size(0));
+    for (const auto& elem : elements(gv)) {
+        values[elem.index()] = elem.geometry().volume();
+    }
+    CellValueHandle handle(values);
+
+    report.run("communicate", model, cells, [&] {
+        grid->communicate(handle, Dune::InteriorBorder_All_Interface,
+                          Dune::ForwardCommunication);
+    });
+
+    report.run("startCommunicate", model, cells, [&] {
+        auto request = grid->startCommunicate(handle, Dune::InteriorBorder_All_Interface,
+                                              Dune::ForwardCommunication);
+        request.finish();
+    });
+
+    auto& plan = grid->cellCommunicationPlan(Dune::InteriorBorder_All_Interface);
+    report.run("cellCommunicationPlan", model, cells, [&] {
+        plan.exchange(values, 1);
+    });
+
+    std::vector<double> blocks(3 * values.size());
+    report.run("cellCommunicationPlan_block3", model, cells, [&] {
+        plan.exchange(blocks, 3);
+    });
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const auto& helper = Dune::MPIHelper::instance(argc, argv);
+    try {
+        const Options options = parseOptions(argc, argv);
+        Report report("communication", options, helper.getCommunication());
+
+        benchmarkCommunication(report, modelName("cartesian", options.dims),
+                               [&](Dune::CpGrid& grid) {
+                                   grid.createCartesian(options.dims, {1.0, 1.0, 1.0});
+                               });
+
+#if HAVE_ECL_INPUT
+        for (const auto& deckFile : options.decks) {
+            // The global grid is only built on rank 0.
+            std::unique_ptr<Opm::EclipseGrid> ecl_grid;
+            if (helper.rank() == 0) {
+                Opm::Parser parser;
+                ecl_grid = std::make_unique<Opm::EclipseGrid>(parser.parseFile(deckFile));
+            }
+            benchmarkCommunication(report, deckFile,
+                                   [&](Dune::CpGrid& grid) {
+                                       grid.processEclipseFormat(ecl_grid.get(), nullptr, false);
+                                   });
+        }
+#else
+        if (!options.decks.empty()) {
+            std::cerr << "Decks are ignored, opm-grid was built without Eclipse input support." << std::endl;
+        }
+#endif
+        report.write();
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n" << usage();
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file construction_benchmark.cpp
+ * @brief Time the construction of CpGrids.
+ *
+ * Builds the cartesian and the faulted corner-point models, and the Eclipse
+ * decks given on the command line, and times the phases of the processing:
+ * the corner-point preprocessing on its own, and the whole
+ * processEclipseFormat(). For decks, the parsing and the construction of the
+ * EclipseGrid are timed as well. Each process builds its own grids, so the
+ * program is meant to be run on a single process.
+ */
+
+#include <config.h>
+
+#include "BenchmarkSuite.hpp"
+
+#include <opm/grid/CpGrid.hpp>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#endif
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace Opm::GridBenchmark;
+
+namespace {
+
+void benchmarkCartesian(Report& report, const Options& options)
+{
+    const auto& dims = options.dims;
+    const std::size_t cells = std::size_t(dims[0]) * dims[1] * dims[2];
+    std::unique_ptr<Dune::CpGrid> grid;
+    report.run("createCartesian", modelName("cartesian", dims), cells,
+               [&] { grid = std::make_unique<Dune::CpGrid>(Dune::MPIHelper::getLocalCommunicator()); },
+               [&] { grid->createCartesian(dims, {1.0, 1.0, 1.0}); });
+}
+
+void benchmarkCornerPoint(Report& report, const Options& options)
+{
+    const FaultedModel model(options.dims);
+    const grdecl input = model.input();
+    const std::string name = modelName("faulted", options.dims);
+    const std::size_t cells = model.actnum.size();
+
+    report.run("process_grdecl", name, cells,
+               [&] {
+                   processed_grid output;
+                   if (!process_grdecl(&input, 0.0, nullptr, &output, false)) {
+                       throw std::runtime_error("process_grdecl failed");
+                   }
+                   free_processed_grid(&output);
+               });
+
+    std::unique_ptr<Dune::CpGrid> grid;
+    report.run("processEclipseFormat", name, cells,
+               [&] { grid = std::make_unique<Dune::CpGrid>(Dune::MPIHelper::getLocalCommunicator()); },
+               [&] { grid->processEclipseFormat(input, false); });
+}
+
+#if HAVE_ECL_INPUT
+void benchmarkDeck(Report& report, const Options& options, const std::string& deckFile)
+{
+    std::vector<double> parse, eclGrid, process;
+    std::size_t cells = 0;
+    for (int rep = 0; rep < options.repetitions; ++rep) {
+        Opm::time::StopWatch clock;
+        clock.start();
+        Opm::Parser parser;
+        const auto deck = parser.parseFile(deckFile);
+        parse.push_back(clock.secsSinceLast());
+
+        Opm::EclipseGrid ecl_grid(deck);
+        eclGrid.push_back(clock.secsSinceLast());
+
+        Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+        clock.secsSinceLast();
+        grid.processEclipseFormat(&ecl_grid, nullptr, false);
+        process.push_back(clock.secsSinceLast());
+        cells = grid.size(0);
+    }
+    report.add("deck_parse", deckFile, cells, parse);
+    report.add("EclipseGrid", deckFile, cells, eclGrid);
+    report.add("processEclipseFormat", deckFile, cells, process);
+}
+#endif
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const auto& helper = Dune::MPIHelper::instance(argc, argv);
+    try {
+        const Options options = parseOptions(argc, argv);
+        Report report("construction", options, helper.getCommunication());
+
+        benchmarkCartesian(report, options);
+        benchmarkCornerPoint(report, options);
+#if HAVE_ECL_INPUT
+        for (const auto& deck : options.decks) {
+            benchmarkDeck(report, options, deck);
+        }
+#else
+        if (!options.decks.empty()) {
+            std::cerr << "Decks are ignored, opm-grid was built without Eclipse input support." << std::endl;
+        }
+#endif
+        report.write();
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n" << usage();
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file traversal_benchmark.cpp
+ * @brief Time the traversal and refinement of CpGrids.
+ *
+ * Times plain and chunked loops over the leaf cells, the traversal of all
+ * intersections, the access to cell centroids and volumes, and adapt() with
+ * a number of marked cells. Runs on the cartesian and the faulted
+ * corner-point models, and on the Eclipse decks given on the command line.
+ * Each process builds its own grids, so the program is meant to be run on a
+ * single process.
+ */
+
+#include <config.h>
+
+#include "BenchmarkSuite.hpp"
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/ElementChunks.hpp>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#endif
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace Opm::GridBenchmark;
+
+namespace {
+
+/// Keep the compiler from removing loops whose results are unused.
+volatile double sink = 0.0;
+
+void benchmarkTraversal(Report& report, const Options& options, const std::string& model,
+                        const std::function<void(Dune::CpGrid&)>& build)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    build(grid);
+    const auto& gv = grid.leafGridView();
+    const std::size_t cells = grid.size(0);
+    std::vector<double> values(cells);
+
+    report.run("leaf_iteration", model, cells, [&] {
+        for (const auto& elem : elements(gv)) {
+            values[elem.index()] = elem.geometry().volume();
+        }
+    });
+
+    const Opm::ElementChunks chunks(gv, options.threads);
+    report.run("element_chunks", model, cells, [&] {
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(options.threads)
+#endif
+        for (const auto& chunk : chunks) {
+            for (const auto& elem : chunk) {
+                values[elem.index()] = elem.geometry().volume();
+            }
+        }
+    });
+
+    report.run("intersections", model, cells, [&] {
+        double sum = 0.0;
+        for (const auto& elem : elements(gv)) {
+            for (const auto& is : intersections(gv, elem)) {
+                if (is.neighbor()) {
+                    sum += is.outside().index() * is.geometry().volume();
+                } else {
+                    sum += is.centerUnitOuterNormal()[2];
+                }
+            }
+        }
+        sink = sum;
+    });
+
+    report.run("cellCentroid_cellVolume", model, cells, [&] {
+        double sum = 0.0;
+        const int numCells = grid.numCells();
+        for (int cell = 0; cell < numCells; ++cell) {
+            sum += grid.cellCentroid(cell)[2] * grid.cellVolume(cell);
+        }
+        sink = sum;
+    });
+
+    report.run("geometry_center_volume", model, cells, [&] {
+        double sum = 0.0;
+        for (const auto& elem : elements(gv)) {
+            const auto& geometry = elem.geometry();
+            sum += geometry.center()[2] * geometry.volume();
+        }
+        sink = sum;
+    });
+
+    // Mark cells spread evenly over the grid, each is refined into 2x2x2 children.
+    const int marked = std::min(options.markedCells, grid.size(0));
+    std::unique_ptr<Dune::CpGrid> adapted;
+    report.run("adapt_" + std::to_string(marked) + "_marked", model, cells,
+               [&] {
+                   adapted = std::make_unique<Dune::CpGrid>(Dune::MPIHelper::getLocalCommunicator());
+                   build(*adapted);
+                   const int stride = grid.size(0) / marked;
+                   for (const auto& elem : elements(adapted->leafGridView())) {
+                       if (elem.index() % stride == 0 && elem.index() / stride < marked) {
+                           adapted->mark(1, elem);
+                       }
+                   }
+               },
+               [&] {
+                   adapted->preAdapt();
+                   adapted->adapt();
+                   adapted->postAdapt();
+               });
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const auto& helper = Dune::MPIHelper::instance(argc, argv);
+    try {
+        const Options options = parseOptions(argc, argv);
+        Report report("traversal", options, helper.getCommunication());
+
+        benchmarkTraversal(report, options, modelName("cartesian", options.dims),
+                           [&](Dune::CpGrid& grid) {
+                               grid.createCartesian(options.dims, {1.0, 1.0, 1.0});
+                           });
+
+        const FaultedModel faulted(options.dims);
+        benchmarkTraversal(report, options, modelName("faulted", options.dims),
+                           [&](Dune::CpGrid& grid) {
+                               grid.processEclipseFormat(faulted.input(), false);
+                           });
+
+#if HAVE_ECL_INPUT
+        for (const auto& deckFile : options.decks) {
+            Opm::Parser parser;
+            const Opm::EclipseGrid ecl_grid(parser.parseFile(deckFile));
+            benchmarkTraversal(report, options, deckFile,
+                               [&](Dune::CpGrid& grid) {
+                                   grid.processEclipseFormat(&ecl_grid, nullptr, false);
+                               });
+        }
+#else
+        if (!options.decks.empty()) {
+            std::cerr << "Decks are ignored, opm-grid was built without Eclipse input support." << std::endl;
+        }
+#endif
+        report.write();
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n" << usage();
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
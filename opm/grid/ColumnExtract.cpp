@@ -19,10 +19,12 @@
 #include <config.h>
 #include <opm/grid/ColumnExtract.hpp>
 
+#include <opm/grid/CpGrid.hpp>
 #include <opm/grid/UnstructuredGrid.h>
 
 #include <algorithm>
 #include <map>
+#include <numeric>
 
 namespace {
 
@@ -63,6 +65,39 @@ bool neighbours(const UnstructuredGrid& grid, const int c0, const int c1)
     return false;
 }
 
+/// Neighbourhood query.
+/// \return true if two cells are neighbours.
+bool neighbours(const Dune::CpGrid& grid, const int c0, const int c1)
+{
+    for (const auto& face : grid.cellFaceRow(c0)) {
+        const int f = face.index();
+        if (grid.faceCell(f, 0) == c1 || grid.faceCell(f, 1) == c1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Stable counting sort of cells by key(cell), with keys in [0, num_keys).
+/// \return The position of the first cell of each key, and the number of
+///         cells at the end.
+template <class Key>
+std::vector<int> countingSort(std::vector<int>& cells, const int num_keys, const Key& key)
+{
+    std::vector<int> start(num_keys + 1, 0);
+    for (const int cell : cells) {
+        ++start[key(cell) + 1];
+    }
+    std::partial_sum(start.begin(), start.end(), start.begin());
+    std::vector<int> pos(start.begin(), start.end() - 1);
+    std::vector<int> sorted(cells.size());
+    for (const int cell : cells) {
+        sorted[pos[key(cell)]++] = cell;
+    }
+    cells.swap(sorted);
+    return start;
+}
+
 } // anonymous namespace
 
 
@@ -132,4 +167,64 @@ void extractColumn(const UnstructuredGrid& grid, std::vector<std::vector<int> >&
     }
 }
 
+SparseTable<int> extractColumns(const Dune::CpGrid& grid)
+{
+    const auto& dims = grid.logicalCartesianSize();
+    const std::vector<int>& global_cell = grid.globalCell();
+
+    std::vector<int> cells;
+    cells.reserve(grid.numCells());
+    for (const auto& element : elements(grid.leafGridView())) {
+        if (element.partitionType() == Dune::InteriorEntity) {
+            cells.push_back(element.index());
+        }
+    }
+
+    // Sort by k-index, then by column. The second sort is stable, hence
+    // the cells of each column end up ordered by k-index.
+    const int layer_size = dims[0]*dims[1];
+    countingSort(cells, dims[2], [&](int cell) { return global_cell[cell] / layer_size; });
+    const std::vector<int> column_start =
+        countingSort(cells, layer_size, [&](int cell) { return global_cell[cell] % layer_size; });
+
+    // A column may contain multiple disjoint sets of cells, each
+    // becomes a row of its own. The sorted cells are the table data.
+    std::vector<int> row_sizes;
+    row_sizes.reserve(layer_size);
+    for (int col = 0; col < layer_size; ++col) {
+        int first_of_col = column_start[col];
+        for (int k = first_of_col + 1; k < column_start[col + 1]; ++k) {
+            if (!neighbours(grid, cells[k - 1], cells[k])) {
+                row_sizes.push_back(k - first_of_col);
+                first_of_col = k;
+            }
+        }
+        if (first_of_col != column_start[col + 1]) {
+            row_sizes.push_back(column_start[col + 1] - first_of_col);
+        }
+    }
+    return SparseTable<int>(cells.begin(), cells.end(), row_sizes.begin(), row_sizes.end());
+}
+
+std::vector<int> columnPartition(const Dune::CpGrid& grid,
+                                 const SparseTable<int>& columns,
+                                 const int num_parts)
+{
+    std::vector<int> parts(grid.numCells(), 0);
+    const long long total = columns.dataSize();
+    long long before = 0;
+    for (int col = 0; col < columns.size(); ++col) {
+        const int size = columns[col].size();
+        // The part that the middle cell of the column would get if the
+        // cells were split evenly in the order of the columns.
+        const int part = std::min<long long>(num_parts - 1,
+                                             (2*before + size) * num_parts / (2*total));
+        for (const int cell : columns[col]) {
+            parts[cell] = part;
+        }
+        before += size;
+    }
+    return parts;
+}
+
 } // namespace Opm
@@ -18,10 +18,15 @@
 */
 
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/utility/SparseTable.hpp>
 #include <vector>
 
 struct UnstructuredGrid;
 
+namespace Dune {
+class CpGrid;
+}
+
 namespace Opm {
 
 /// Extract each column of the grid.
@@ -32,4 +37,29 @@ namespace Opm {
 ///         centered at (i, j) in the second variable, and i+jN in the first variable.
 void extractColumn(const UnstructuredGrid& grid, std::vector<std::vector<int> >& columns);
 
+/// Extract each column of the current view of a CpGrid.
+///  \note Assumes the pillars of the grid are all vertically aligned.
+///  \param grid The grid from which to extract the columns.
+///  \return One row per column, containing its cells ordered by k-index.
+///          A column (i, j) whose cells are not connected is split into
+///          its connected segments, top first. The rows are ordered by
+///          i+jN. Cells are bucketed by their Cartesian index in linear
+///          time. On a distributed grid only the interior cells are used,
+///          hence each cell is in a column on exactly one rank. A column
+///          that is split between ranks yields one segment on each of them,
+///          see columnPartition() for how to avoid that.
+SparseTable<int> extractColumns(const Dune::CpGrid& grid);
+
+/// Partition the cells of a grid such that every column is in one part.
+///  \param grid The grid, not yet distributed.
+///  \param columns The columns of the grid as returned by extractColumns().
+///  \param num_parts The number of parts, at most the number of columns.
+///  \return The part of each cell. Consecutive columns are assigned to
+///          the same part, and the parts have about the same number of
+///          cells. Pass this to CpGrid::loadBalance() to keep each column
+///          on one rank.
+std::vector<int> columnPartition(const Dune::CpGrid& grid,
+                                 const SparseTable<int>& columns,
+                                 int num_parts);
+
 } // namespace Opm
@@ -44,13 +44,18 @@
 
 #include <dune/grid/common/grid.hh>
 #include <opm/grid/cpgrid/CpGridDataTraits.hpp>
+#include <opm/grid/cpgrid/CellCommunicationPlan.hpp>
+#include <opm/grid/cpgrid/CommunicationRequest.hpp>
 #include <opm/grid/cpgrid/DefaultGeometryPolicy.hpp>
+#include <opm/grid/cpgrid/DenseIndexMap.hpp>
 #include <opm/grid/cpgrid/OrientedEntityTable.hpp>
 #include <opm/grid/cpgpreprocess/preprocess.h>
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h> //  Not really needed it seems, but alas.
 #include "common/GridEnums.hpp"
 #include <opm/grid/utility/OpmWellType.hpp>
+#include <opm/grid/utility/PhaseTimings.hpp>
 
+#include <functional>
 #include <set>
 
 namespace Opm
@@ -277,6 +282,80 @@ namespace Dune
         /// \param remove_ij_boundary if true, will remove (i, j) boundaries. Used internally.
         void processEclipseFormat(const grdecl& input_data, bool remove_ij_boundary, bool turn_normals = false);
 
+        /// Save the processed grid to a binary file.
+        ///
+        /// Writes the topology, geometry, face tags, global cells, zcorn and aquifer
+        /// cells of the grid in a versioned format, such that loadProcessedGrid()
+        /// restores the grid without repeating the processing of the Eclipse grid
+        /// format. The grid lives on rank zero, only that rank writes the file.
+        /// \param fileName the name of the file to write.
+        void saveProcessedGrid(const std::string& fileName) const;
+
+        /// Load a grid saved by saveProcessedGrid().
+        ///
+        /// Replaces processEclipseFormat() for an unchanged model. Changes to the
+        /// EclipseState made by processEclipseFormat(), e.g. the NNCs of numerical
+        /// aquifers, are not replayed. Only rank zero reads the file.
+        /// \param fileName the name of the file to read.
+        void loadProcessedGrid(const std::string& fileName);
+
+        /// Save the distributed grid, one file per process.
+        ///
+        /// Each process writes its interior and overlap cells with their faces and
+        /// points, the global ids and the parallel index set of the cells to
+        /// fileName.<rank>. Must be called on all processes after loadBalance().
+        /// \param fileName the common prefix of the file names.
+        void saveDistributedGrid(const std::string& fileName) const;
+
+        /// Load a distributed grid saved by saveDistributedGrid().
+        ///
+        /// Replaces processEclipseFormat() and loadBalance() in a run with the same
+        /// number of processes. Each process reads its own file only, and the global
+        /// grid is never built. Hence scatterData() and gatherData() cannot be used.
+        /// Must be called on all processes.
+        /// \param fileName the common prefix of the file names.
+        void loadDistributedGrid(const std::string& fileName);
+
+        /// Renumber the cells of the current view to improve memory locality.
+        ///
+        /// Orders the cells along a Hilbert curve through their centroids, or by
+        /// reverse Cuthill-McKee on the cells connected by faces (including NNCs).
+        /// The faces are renumbered to follow their cells. Meant to be called after
+        /// processEclipseFormat() or loadBalance(). globalCell(), the index sets and
+        /// the communication interfaces are updated; other data attached to cells or
+        /// faces can be reordered with cellRenumbering() and faceRenumbering().
+        /// The global ids of a distributed grid are kept, those of a serial grid
+        /// are its cell indices. Not supported for grids with LGRs, or for the
+        /// global view of a distributed grid. Must be called on all processes.
+        /// \param ordering the method computing the new order.
+        void renumberCells(CellOrdering ordering);
+
+        /// For each cell of the current view, its index before the last call
+        /// to renumberCells(). Empty if the cells were never renumbered.
+        const std::vector<int>& cellRenumbering() const;
+
+        /// For each face of the current view, its index before the last call
+        /// to renumberCells(). Empty if the cells were never renumbered.
+        const std::vector<int>& faceRenumbering() const;
+
+        /// Wall time, peak memory growth and item counts of the phases of the
+        /// setup on this process.
+        ///
+        /// Records processEclipseFormat() with its phases getSanitizedZCORN, minpv,
+        /// process_grdecl, filterNNCs, buildTopo and buildGeom, and loadBalance()
+        /// with its phases partition, addOverlapLayer, distributeGlobalGrid and
+        /// computeCommunicationInterfaces. Phases that run several times are
+        /// accumulated.
+        const Opm::PhaseTimings& setupTimings() const;
+
+        /// Write the setup timings of all processes as JSON.
+        ///
+        /// Writes an object {"ranks": [{"rank": 0, "phases": [...]}, ...]} with the
+        /// phases of each rank as written by Opm::PhaseTimings::writeJson(). Must
+        /// be called on all processes, only rank zero writes.
+        /// \param os the stream to write to on rank zero.
+        void writeSetupTimings(std::ostream& os) const;
+
         //@}
 
         /// \name Cartesian grid extensions.
@@ -334,6 +413,46 @@ namespace Dune
         /// Set whether we want to have unique boundary ids.
         /// \param uids if true, each boundary intersection will have a unique boundary id.
         void setUniqueBoundaryIds(bool uids);
+
+        /// Is the corner-point preprocessing shared among all ranks?
+        bool distributedPreprocessing() const;
+
+        /// Set whether processEclipseFormat() shares the corner-point
+        /// preprocessing among all ranks of the grid's communicator.
+        /// Must be called with the same value on all ranks, and the grid
+        /// must then be created by calling processEclipseFormat() or
+        /// createCartesian() on all ranks.  The grid is still assembled on
+        /// rank 0 and is identical to the serial result.
+        /// \param distributed if true, each rank processes a slab of cell rows.
+        void setDistributedPreprocessing(bool distributed);
+
+        /// Is the cell geometry stored compactly?
+        bool compactCellGeometry() const;
+
+        /// \brief Set whether the cell geometry of all grid views is stored compactly.
+        ///
+        /// With compact storage only the centroids and volumes of the cells
+        /// are stored, and element geometries are built on demand as views
+        /// of the grid's corners. This roughly halves the memory of the cell
+        /// geometry, and element geometries can be copied by many threads
+        /// without updating reference counts. beginCellCentroids() is not
+        /// available. loadBalance() and refinement restore the regular storage.
+        void setCompactCellGeometry(bool compact);
+
+        /// Do the intersection iterators of the current view read precomputed data?
+        bool hasIntersectionTable() const;
+
+        /// \brief Set whether the grid views store precomputed intersection data.
+        ///
+        /// With the table, the intersection iterators read the outside cell,
+        /// the boundary flag, indexInInside() and the face index of each
+        /// cell face from a compact array, instead of looking up the face to
+        /// cell topology and the face tags at every increment. The table
+        /// takes 10 bytes per cell face. It is built for the views that exist
+        /// when this is called, and is kept up to date by renumberCells(),
+        /// processEclipseFormat(), createCartesian() and loadProcessedGrid().
+        /// loadBalance() and refinement drop it.
+        void setIntersectionTable(bool enable);
        
 
         // --- Dune interface below ---
@@ -581,17 +700,17 @@ namespace Dune
                                                     std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                                     int& markedElem_count,
                                                     std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                                    std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                                    cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                                     std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                                     /* Refined cells parameters */
-                                                    std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAdRefinedCell,
-                                                    std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                                    cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAdRefinedCell,
+                                                    cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                                     std::vector<int>& refined_cell_count_vec,
                                                     const std::vector<int>& assignRefinedLevel,
                                                     std::vector<std::vector<std::tuple<int,std::vector<int>>>>& preAdapt_parent_to_children_cells_vec,
                                                     /* Adapted cells parameters */
-                                                    std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                                    std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                                    cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                                    cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                                     int& cell_count,
                                                     std::vector<std::vector<int>>& preAdapt_level_to_leaf_cells_vec,
                                                     /* Additional parameters */
@@ -621,9 +740,9 @@ namespace Dune
         std::tuple< std::vector<std::vector<std::array<int,2>>>,
                     std::vector<std::vector<int>>,
                     std::vector<std::array<int,2>>,
-                    std::vector<int>> defineChildToParentAndIdxInParentCell( const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                    std::vector<int>> defineChildToParentAndIdxInParentCell( const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                                                              const std::vector<int>& refined_cell_count_vec,
-                                                                             const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                                                             const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                                                              const int& cell_count) const;
 
         /// @brief Define refined level grid cells indices and leaf grid view (or adapted grid) cells indices relations. Namely, level_to_leaf_cells_ for each new
@@ -653,11 +772,11 @@ namespace Dune
         /// @return refined_level_to_leaf_cells_vec:                         refined_level_to_leaf_cells_vec[ levelGridIdx ] [ cell idx in that level grid ] = equivalent leaf cell idx
         ///         leaf_to_level_cells:                                     leaf_to_level_cells[ leaf cell idx ] = {level where cell was born, cell idx on that level}
         std::pair<std::vector<std::vector<int>>, std::vector<std::array<int,2>>>
-        defineLevelToLeafAndLeafToLevelCells(const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+        defineLevelToLeafAndLeafToLevelCells(const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                              const std::vector<int>& refined_cell_count_vec,
-                                             const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                             const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                             const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                             const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                              const int& cell_count) const;
 
         /// @brief Define various corner relations. 1. refined corners from auxiliary single marked element refinement to its corresponding refined level grid, and vice versa.
@@ -686,10 +805,10 @@ namespace Dune
         /// @param [in] cornerInMarkedElemWithEquivRefinedCorner
         /// @param [in] faceInMarkedElemAndRefinedFaces
         /// @param [in] cells_per_dim_vec
-        void identifyRefinedCornersPerLevel(std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                            std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
+        void identifyRefinedCornersPerLevel(cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                            cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
                                             std::vector<int>& refined_corner_count_vec,
-                                            std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                            cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                             const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                             const std::vector<int>& assignRefinedLevel,
                                             const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
@@ -713,8 +832,8 @@ namespace Dune
         /// @param [in] assignRefinedLevel
         /// @param [in] faceInMarkedElemAndRefinedFaces
         /// @param [in] cells_per_dim_vec
-        void identifyRefinedFacesPerLevel(std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
-                                          std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+        void identifyRefinedFacesPerLevel(cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                          cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
                                           std::vector<int>& refined_face_count_vec,
                                           const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                           const std::vector<int>& assignRefinedLevel,
@@ -741,13 +860,13 @@ namespace Dune
         /// @param [in] vanishedRefinedCorner_to_itsLastAppearance
         /// @param [in] faceInMarkedElemAndRefinedFaces
         /// @param [in] cells_per_dim_vec
-        void identifyLeafGridCorners(std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                     std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+        void identifyLeafGridCorners(cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                     cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                                      int& corner_count,
                                      const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                      const std::vector<int>& assignRefinedLevel,
                                      const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                     std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                     cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                      const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                      const std::vector<std::array<int,3>>& cells_per_dim_vec) const;
 
@@ -768,8 +887,8 @@ namespace Dune
         /// @param [in] assignRefinedLevel
         /// @param [in] faceInMarkedElemAndRefinedFaces
         /// @param [in] cells_per_dim_vec
-        void identifyLeafGridFaces(std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
-                                   std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+        void identifyLeafGridFaces(cpgrid::IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                                   cpgrid::DenseIndexMap<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
                                    int& face_count,
                                    const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                    const std::vector<int>& assignRefinedLevel,
@@ -781,7 +900,7 @@ namespace Dune
                                     const std::vector<int>& refined_corner_count_vec,
                                     const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                     const int& preAdaptMaxLevel,
-                                    const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner) const;
+                                    const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner) const;
 
         /// @brief Define the faces, face tags, face normarls, and face_to_point_, for each refined level grid.
         void populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<2,3>>>& refined_faces_vec,
@@ -789,13 +908,13 @@ namespace Dune
                                   std::vector<Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>>& mutable_refine_face_normals_vec,
                                   std::vector<Opm::SparseTable<int>>& refined_face_to_point_vec,
                                   const std::vector<int>& refined_face_count_vec,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                  const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                   const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                   const int& preAdaptMaxLevel,
                                   const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                  const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner) const;
+                                  const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner) const;
 
         /// @brief Define the cells, cell_to_point_, global_cell_, cell_to_face_, face_to_cell_, for each refined level grid.
         void populateRefinedCells(std::vector<Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<3,3>>>& refined_cells_vec,
@@ -804,16 +923,16 @@ namespace Dune
                                   const std::vector<int>& refined_cell_count_vec,
                                   std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
                                   std::vector<cpgrid::OrientedEntityTable<1,0>>& refined_face_to_cell_vec,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
                                   const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                   const std::vector<Dune::cpgrid::DefaultGeometryPolicy>& refined_geometries_vec,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                  const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                   const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                   const std::vector<int>& assignRefinedLevel,
                                   const int& preAdaptMaxLevel,
-                                  const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                  const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                   const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                   const std::vector<std::array<int,3>>&  cells_per_dim_vec) const;
 
@@ -835,18 +954,18 @@ namespace Dune
                                              std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
                                              std::vector<cpgrid::OrientedEntityTable<1,0>>& refined_face_to_cell_vec,
                                              /* Auxiliary arguments */
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
                                              const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                              const std::vector<Dune::cpgrid::DefaultGeometryPolicy>& refined_geometries_vec,
-                                             const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                              const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                              const std::vector<int>& assignRefinedLevel,
                                              const int& preAdaptMaxLevel,
-                                             const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                             const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                              const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                              const std::vector<std::array<int,3>>&  cells_per_dim_vec) const;
 
@@ -854,7 +973,7 @@ namespace Dune
         void populateLeafGridCorners(Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<0,3>>& adapted_corners,
                                      const int& corners_count,
                                      const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
-                                     const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner) const;
+                                     const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner) const;
 
         /// @brief Define the faces, face tags, face normarls, and face_to_point_, for the leaf grid view.
         void populateLeafGridFaces(Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<2,3>>& adapted_faces,
@@ -862,12 +981,12 @@ namespace Dune
                                    Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>& mutable_face_normals,
                                    Opm::SparseTable<int>& adapted_face_to_point,
                                    const int& face_count,
-                                   const std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
-                                   const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                   const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                   const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                                   const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                   const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                    const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                    const std::vector<int>& assignRefinedLevel,
-                                   const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                   const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                    const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                    const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                    const int& preAdaptMaxLevel) const;
@@ -878,15 +997,15 @@ namespace Dune
                                    const int& cell_count,
                                    cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                    cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
-                                   const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
-                                   const std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                                   const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                   const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
                                    const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                    const Dune::cpgrid::DefaultGeometryPolicy& adapted_geometries,
-                                   const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                   const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                   const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                   const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                    const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                    const std::vector<int>& assignRefinedLevel,
-                                   const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                   const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                    const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                    const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                    const int& preAdaptMaxLevel) const;
@@ -908,24 +1027,24 @@ namespace Dune
                                            cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                            cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
                                            /* Auxiliary arguments */
-                                           const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
-                                           const std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
-                                           const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
-                                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                                           const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                                           const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                                           const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                           const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
                                            const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                            const Dune::cpgrid::DefaultGeometryPolicy& adapted_geometries,
-                                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                           const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                           const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                           const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                            const std::vector<int>& assignRefinedLevel,
-                                           const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                           const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                            const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                            const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                            const int& preAdaptMaxLevel) const;
 
         void updateCornerHistoryLevels(const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                       const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                       const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                                       const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                       const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                                        const int& corner_count,
                                        const std::vector<std::array<int,2>>& preAdaptGrid_corner_history,
                                        const int& preAdaptMaxLevel,
@@ -1072,6 +1191,21 @@ namespace Dune
         
         /// --------------- Auxiliary methods to support Adaptivity (end) ---------------
 
+        /// @brief Recover the blocks of cells refined into the LGRs of a grid that has not been distributed yet.
+        ///
+        /// The result is suitable for addLgrsUpdateLeafView, which is used to refine the grid again after
+        /// its level zero grid has been distributed. The blocks are computed on rank 0 and broadcast.
+        /// Throws if an LGR has not been created from a block of cells (e.g. via mark() and adapt()).
+        ///
+        /// @param [out] cells_per_dim_vec    Number of subdivisions per parent cell, in each direction, of each LGR.
+        /// @param [out] startIJK_vec         Start ijk of the block of parent cells of each LGR.
+        /// @param [out] endIJK_vec           End ijk (excluded) of the block of parent cells of each LGR.
+        /// @param [out] lgr_name_vec         Name of each LGR.
+        void getLgrBlocksOfGlobalGrid(std::vector<std::array<int,3>>& cells_per_dim_vec,
+                                      std::vector<std::array<int,3>>& startIJK_vec,
+                                      std::vector<std::array<int,3>>& endIJK_vec,
+                                      std::vector<std::string>& lgr_name_vec) const;
+
         /// @brief Check if there are non neighboring connections on blocks of cells selected for refinement.
         ///
         /// @param [in] startIJK_vec    Vector of ijk values denoting the start of each block of cells selected for refinement.
@@ -1212,9 +1346,25 @@ namespace Dune
 
         void setPartitioningParams(const std::map<std::string,std::string>& params);
 
+        /// \brief Enable caching of the partitioning computed by loadBalance().
+        ///
+        /// The partitioning is stored in the given file together with a hash of its
+        /// input (grid, wells, transmissibilities, partitioning method and parameters,
+        /// number of processes). A later loadBalance() with the same input reuses it
+        /// instead of calling the partitioner. Must be called with the same file name
+        /// on all processes; an empty name disables the cache (the default).
+        void setPartitionCacheFile(const std::string& fileName);
+
+        /// \brief The partition cache file, empty if caching is disabled.
+        const std::string& partitionCacheFile() const;
+
         // loadbalance is not part of the grid interface therefore we skip it.
 
         /// \brief Distributes this grid over the available nodes in a distributed machine
+        ///
+        /// A grid with LGRs added by addLgrsUpdateLeafView() is distributed via its level
+        /// zero grid, where the parent cells are weighted by their number of children (Zoltan
+        /// only). The LGRs are then refined again on the process of each parent cell.
         /// \param overlapLayers The number of layers of cells of the overlap region (default: 1).
         /// \param partitionMethod The method used to partition the grid, one of Dune::PartitionMethod
         /// \warning May only be called once.
@@ -1521,6 +1671,45 @@ namespace Dune
             return ret;
         }
 
+        /// \brief Redistributes an already distributed grid.
+        ///
+        /// Cells are migrated directly between the processes, without a global view of the
+        /// grid, and only the processes exchanging cells communicate. The overlap layer
+        /// (one layer of cells sharing a face with an owned cell) and the communication
+        /// interfaces are rebuilt. Grids with LGRs are not supported yet.
+        /// \param parts For each cell of the leaf grid view of this process, the process
+        ///              owning it afterwards. Only the entries of owned cells are used.
+        ///              parts.size() == size(0).
+        /// \warning Afterwards, scatterData() can no longer be used, as the global grid
+        ///          is not redistributed.
+        void repartition(const std::vector<int>& parts);
+
+        /// \brief Redistributes an already distributed grid and attached data.
+        ///
+        /// See repartition(const std::vector<int>&).
+        /// \param parts For each cell of the leaf grid view of this process, the process
+        ///              owning it afterwards.
+        /// \param data A data handle describing how to migrate the attached data. It gathers
+        ///             from entities of the old and scatters to entities of the new grid.
+        /// \tparam DataHandle The type implementing DUNE's DataHandle interface.
+        template<class DataHandle>
+        void repartition(const std::vector<int>& parts, DataHandle& data)
+        {
+            repartitionGrid(parts,
+                            [this, &data]([[maybe_unused]] const cpgrid::CpGridData& oldData,
+                                          [[maybe_unused]] const InterfaceMap& cellMigration,
+                                          [[maybe_unused]] const InterfaceMap& pointMigration)
+                            {
+#if HAVE_MPI
+                                current_view_data_->scatterData(data, &oldData, current_view_data_,
+                                                                cellMigration, pointMigration);
+#else
+                                // Suppress warnings for unused argument.
+                                (void) data;
+#endif
+                            });
+        }
+
         /// \brief Partitions the grid using Zoltan without decomposing and distributing it among processes.
         /// \param wells The wells of the eclipse.
         /// \param possibleFutureConnections An optional unordered_map<string, set<array<int,3>>>
@@ -1555,6 +1744,10 @@ namespace Dune
 
         /// The new communication interface.
         /// \brief communicate objects for all codims on a given level.
+        ///
+        /// Cells, faces and points are supported. Face data is only sent for the
+        /// faces shared with other processes, and the index of a face entity is
+        /// the one used by numFaces() and cellFace().
         /// \tparam DataHandle The type of the data handle describing the data.
         /// \param data The data handle describing the data. Has to adhere to the Dune::DataHandleIF interface.
         /// \param iftype The interface to use for the communication.
@@ -1563,6 +1756,41 @@ namespace Dune
         template<class DataHandle>
         void communicate (DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const;
 
+        /// \brief Start a communication of objects for all codims, to be finished later.
+        ///
+        /// Same as communicate(), but split in two phases such that computations
+        /// can overlap the exchange of halo data:
+        /// \code
+        /// auto request = grid.startCommunicate(handle, InteriorBorder_All_Interface, ForwardCommunication);
+        /// // compute on interior cells
+        /// request.finish();
+        /// \endcode
+        /// The data is gathered when the communication is started and scattered
+        /// by finish(). Message buffers are kept by the grid and reused by later
+        /// communications. All processes need to start their communications
+        /// in the same order.
+        /// \tparam DataHandle The type of the data handle describing the data.
+        /// \param data The data handle describing the data. Has to adhere to the
+        /// Dune::DataHandleIF interface and to stay alive until the request is finished.
+        /// \param iftype The interface to use for the communication.
+        /// \param dir The direction of the communication along the interface (forward or backward).
+        /// \return The pending communication.
+        template<class DataHandle>
+        cpgrid::CommunicationRequest<DataHandle>
+        startCommunicate (DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const;
+
+        /// \brief Get the cached plan for exchanging fixed size double data of cells.
+        ///
+        /// Cheaper than communicate() for fields exchanged repeatedly along the
+        /// same interface:
+        /// \code
+        /// auto& plan = grid.cellCommunicationPlan(InteriorBorder_All_Interface);
+        /// plan.exchange(values, blockSize);
+        /// \endcode
+        /// The plan is set up on first use for the current view, which is collective.
+        /// \param iftype The interface to communicate along.
+        cpgrid::CellCommunicationPlan& cellCommunicationPlan (InterfaceType iftype) const;
+
         /// \brief Get the collective communication object.
         const typename CpGridTraits::Communication& comm () const;
         //@}
@@ -1893,6 +2121,16 @@ namespace Dune
                     bool allowDistributedWells = true,
                     const std::vector<int>& input_cell_part = {});
 
+        /// \brief Redistributes the distributed grid according to a new partitioning.
+        /// \param parts For each cell of the leaf grid view of this process, the new owner.
+        /// \param migrateData If set, called with the previous distributed grid and the
+        ///        interfaces from its cells and points to the ones of the new grid, once the
+        ///        new grid is the current view.
+        void repartitionGrid(const std::vector<int>& parts,
+                             const std::function<void(const cpgrid::CpGridData&,
+                                                      const InterfaceMap&,
+                                                      const InterfaceMap&)>& migrateData = {});
+
         /** @brief The data stored in the grid.
          *
          * All the data of all grids are stored there and
@@ -1929,6 +2167,16 @@ namespace Dune
          */
         std::map<std::string,std::string> partitioningParams;
 
+        /**
+         * @brief File caching the partitioning, empty if disabled.
+         */
+        std::string partition_cache_file_;
+
+        /**
+         * @brief The phases of the setup, shared with the grid data.
+         */
+        std::shared_ptr<Opm::PhaseTimings> setup_timings_;
+
     }; // end Class CpGrid
 
 } // end namespace Dune
@@ -1984,6 +2232,13 @@ namespace Dune
         current_view_data_->communicate(data, iftype, dir);
     }
 
+    template<class DataHandle>
+    cpgrid::CommunicationRequest<DataHandle>
+    CpGrid::startCommunicate (DataHandle& data, InterfaceType iftype, CommunicationDirection dir) const
+    {
+        return current_view_data_->startCommunicate(data, iftype, dir);
+    }
+
 
     template<class DataHandle>
     void CpGrid::scatterData(DataHandle& handle) const
@@ -1991,6 +2246,8 @@ namespace Dune
 #if HAVE_MPI
         if(distributed_data_.empty())
             OPM_THROW(std::runtime_error, "Moving Data only allowed with a load balanced grid!");
+        if(cell_scatter_gather_interfaces_->empty())
+            OPM_THROW(std::runtime_error, "Scattering data of the global grid is not possible after repartition!");
         distributed_data_[0]->scatterData(handle, data_[0].get(), distributed_data_[0].get(), cellScatterGatherInterface(),
                                           pointScatterGatherInterface());
 #else
@@ -26,6 +26,9 @@
 #include <config.h>
 #include "GraphOfGrid.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
 
 namespace Opm {
@@ -34,12 +37,19 @@ template<typename Grid>
 void GraphOfGrid<Grid>::createGraph (const double* transmissibilities,
                                      const Dune::EdgeWeightMethod edgeWeightMethod)
 {
+    if (transmissibilities && (edgeWeightMethod < 0 || edgeWeightMethod > 2))
+    {
+        OPM_THROW(std::invalid_argument, "GraphOfGrid recognizes only EdgeWeightMethod of value 0, 1, or 2.");
+    }
+
     // Find the lowest positive transmissibility in the grid.
     // This includes boundary faces, even though they will not appear in the graph.
     WeightType logMinTransm = std::numeric_limits<WeightType>::max();
     if (transmissibilities && edgeWeightMethod==Dune::EdgeWeightMethod::logTransEdgeWgt)
     {
-        for (int face = 0; face < getGrid().numFaces(); ++face)
+        const int numFaces = getGrid().numFaces();
+#pragma omp parallel for schedule(static) reduction(min:logMinTransm)
+        for (int face = 0; face < numFaces; ++face)
         {
             WeightType transm = transmissibilities[face];
             if (transm > 0 && transm < logMinTransm)
@@ -53,128 +63,174 @@ void GraphOfGrid<Grid>::createGraph (const double* transmissibilities,
         logMinTransm = std::log(logMinTransm);
     }
 
-    const auto& rank = grid.comm().rank();
-    // load vertices (grid cells) into graph
-    graph.reserve(grid.size(0));
-    for (auto it=grid.template leafbegin<0>(); it!=grid.template leafend<0>(); ++it)
+    const auto edgeWeight = [&](int face) -> WeightType
+    {
+        if (!transmissibilities) {
+            return 1.;
+        }
+        switch (edgeWeightMethod) {
+        case 1:
+            return transmissibilities[face];
+        case 2:
+            return 1 + std::log(transmissibilities[face]) - logMinTransm;
+        default:
+            return 1.;
+        }
+    };
+
+    // Cells of the grid are the vertices of the graph, and cell's
+    // global ID is its index.
+    const int numCells = grid.size(0);
+    const auto otherCell = [this](int cell, int face)
     {
-        VertexProperties vertex;
-        vertex.nproc = rank;
-        // get vertex's global ID
-        int gID = grid.globalIdSet().id(*it);
+        const int other = grid.faceCell(face, 0);
+        return other == cell ? grid.faceCell(face, 1) : other;
+    };
 
-        // iterate over vertex's faces and store neighbors' IDs
-        for (int face_lID=0; face_lID<grid.numCellFaces(gID); ++face_lID)
+    // Count distinct neighbors of each cell. Several faces can connect
+    // the same pair of cells, only the first one gives the edge weight.
+    offsets.assign(numCells+1, 0);
+#pragma omp parallel for schedule(static)
+    for (int cell = 0; cell < numCells; ++cell)
+    {
+        const int numFaces = grid.numCellFaces(cell);
+        int count = 0;
+        for (int face_lID=0; face_lID<numFaces; ++face_lID)
         {
-            const int face  = grid.cellFace(gID, face_lID);
-            int otherCell   = grid.faceCell(face, 0);
-            if (otherCell == -1) // -1 means no cell, face is at boundary
+            const int other = otherCell(cell, grid.cellFace(cell, face_lID));
+            if (other == -1) // -1 means no cell, face is at boundary
             {
                 continue;
             }
-            if (otherCell == gID)
+            bool seen = false;
+            for (int prev=0; prev<face_lID && !seen; ++prev)
             {
-                otherCell = grid.faceCell(face, 1);
+                seen = otherCell(cell, grid.cellFace(cell, prev)) == other;
             }
-            if (otherCell == -1)
+            count += !seen;
+        }
+        offsets[cell+1] = count;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Store the neighbors of each cell, sorted by ID.
+    neighbors.resize(offsets[numCells]);
+    edgeWeights.resize(offsets[numCells]);
+#pragma omp parallel for schedule(static)
+    for (int cell = 0; cell < numCells; ++cell)
+    {
+        const int begin = offsets[cell];
+        int end = begin;
+        for (int face_lID=0; face_lID<grid.numCellFaces(cell); ++face_lID)
+        {
+            const int face = grid.cellFace(cell, face_lID);
+            const int other = otherCell(cell, face);
+            if (other == -1 || std::find(&neighbors[begin], &neighbors[end], other) != &neighbors[end])
             {
                 continue;
             }
-            WeightType weight;
-            if (transmissibilities) {
-                switch (edgeWeightMethod) {
-                case 0:
-                    weight = 1.;
-                    break;
-                case 1:
-                    weight = transmissibilities[face];
-                    break;
-                case 2:
-                    weight = 1 + std::log(transmissibilities[face]) - logMinTransm;
-                    break;
-                default:
-                    OPM_THROW(std::invalid_argument, "GraphOfGrid recognizes only EdgeWeightMethod of value 0, 1, or 2.");
-                }
-            } else {
-                weight = 1.;
+            // insertion sort, rows are short
+            int pos = end;
+            for (; pos > begin && neighbors[pos-1] > other; --pos)
+            {
+                neighbors[pos] = neighbors[pos-1];
+                edgeWeights[pos] = edgeWeights[pos-1];
             }
-            vertex.edges.try_emplace(otherCell, weight);
+            neighbors[pos] = other;
+            edgeWeights[pos] = edgeWeight(face);
+            ++end;
         }
-
-        graph.try_emplace(gID, vertex);
+        assert(end == offsets[cell+1]);
     }
 
+    rank = grid.comm().rank();
+    numVertices = numCells;
+    parent.resize(numCells);
+    std::iota(parent.begin(), parent.end(), 0);
+    next = parent;
+    minID = parent;
+    setSize.assign(numCells, 1);
+    vertexWeights.assign(numCells, 1);
+    inWell.assign(numCells, 0);
 }
 
 template<typename Grid>
-int GraphOfGrid<Grid>::contractVertices (int gID1, int gID2)
+void GraphOfGrid<Grid>::collectEdges (int rep, Edges& edges) const
 {
-    // check if the gIDs are in the graph or a well
-    // do nothing if the vertex is not there
-    auto pgID1 = find(gID1);
-    auto pgID2 = find(gID2);
-    if (pgID1==graph.end() || pgID2==graph.end())
+    edges.clear();
+    int cell = rep;
+    do
     {
-        return -1;
-    }
+        for (int e = offsets[cell]; e < offsets[cell+1]; ++e)
+        {
+            const int nrep = parent[neighbors[e]];
+            if (nrep != rep) // skip edges inside the contracted vertex
+            {
+                edges.emplace_back(minID[nrep], edgeWeights[e]);
+            }
+        }
+        cell = next[cell];
+    } while (cell != rep);
 
-    gID1 = pgID1->first;
-    gID2 = pgID2->first;
-    // ensure that gID1<gID2
-    if (gID1==gID2)
-    {
-        return gID1;
-    }
-    if (gID2<gID1)
+    // Rows of uncontracted cells with uncontracted neighbors are already sorted.
+    const auto byID = [](const auto& a, const auto& b) { return a.first < b.first; };
+    if (!std::is_sorted(edges.begin(), edges.end(), byID))
     {
-        std::swap(gID1, gID2);
+        std::sort(edges.begin(), edges.end(), byID);
     }
-
-    // add up vertex weights
-    graph[gID1].weight += graph[gID2].weight;
-
-    // Merge the list of neighbors,
-    // for common neighbors add up edge weights.
-    // Remove the edge between gID1, gID2.
-    auto& v1e = graph[gID1].edges;
-    v1e.erase(gID2);
-    for (const auto& edge : graph[gID2].edges)
+    // add up weights of edges to the same vertex
+    auto out = edges.begin();
+    for (auto in = edges.begin(); in != edges.end(); ++in)
     {
-        if (v1e.find(edge.first)==v1e.end())
-        { // new edge
-            if (edge.first != gID1)
-            {
-                v1e.insert(edge);
-                // remap neighbor's edge
-                graph[edge.first].edges.erase(gID2);
-                graph[edge.first].edges.emplace(gID1, edge.second);
-            }
+        if (out != edges.begin() && (out-1)->first == in->first)
+        {
+            (out-1)->second += in->second;
         }
         else
-        { // common neighbor, add edge weight
-            v1e[edge.first] += edge.second;
-            graph[edge.first].edges.erase(gID2);
-            graph[edge.first].edges[gID1] += edge.second;
+        {
+            *out++ = *in;
         }
     }
-
-    // erase the second vertex to conclude contraction
-    graph.erase(gID2);
-    return gID1;
+    edges.erase(out, edges.end());
 }
 
 template<typename Grid>
-int GraphOfGrid<Grid>::wellID (int gID) const
+int GraphOfGrid<Grid>::contractVertices (int gID1, int gID2)
 {
-    for (const auto& w : wells)
+    // check if the gIDs are in the graph or a well
+    // do nothing if the vertex is not there
+    gID1 = find(gID1);
+    gID2 = find(gID2);
+    if (gID1==-1 || gID2==-1)
     {
-        auto pgID = w.find(gID);
-        if (pgID!=w.end())
-        {
-            return *(w.begin()); // well entries are ordered
-        }
+        return -1;
     }
-    return -1;
+    if (gID1==gID2)
+    {
+        return gID1;
+    }
+
+    // relabel cells of the smaller set
+    int rep1 = parent[gID1];
+    int rep2 = parent[gID2];
+    if (setSize[rep1] < setSize[rep2])
+    {
+        std::swap(rep1, rep2);
+    }
+    int cell = rep2;
+    do
+    {
+        parent[cell] = rep1;
+        cell = next[cell];
+    } while (cell != rep2);
+    // join the cycles of the two sets
+    std::swap(next[rep1], next[rep2]);
+
+    setSize[rep1] += setSize[rep2];
+    vertexWeights[rep1] += vertexWeights[rep2];
+    minID[rep1] = std::min(gID1, gID2);
+    --numVertices;
+    return minID[rep1];
 }
 
 template<typename Grid>
@@ -194,7 +250,8 @@ void GraphOfGrid<Grid>::addWell (const std::set<int>& well, bool checkIntersecti
             {
                 continue;
             }
-            for (auto w=wells.begin(); w!=wells.end(); ++w)
+            const bool inOtherWell = gID >= 0 && gID < static_cast<int>(inWell.size()) && inWell[gID];
+            for (auto w=wells.begin(); inOtherWell && w!=wells.end(); ++w)
             {
                 if (w->find(gID)!=w->end())
                 {
@@ -213,6 +270,10 @@ void GraphOfGrid<Grid>::addWell (const std::set<int>& well, bool checkIntersecti
             assert(wID!=-1 && "Added well vertex was not found in the grid (or its wells).");
         }
         newWell.insert(well.begin(), well.end());
+        for (int gID : newWell)
+        {
+            inWell[gID] = 1;
+        }
         wells.push_front(newWell);
     }
     else
@@ -220,6 +281,13 @@ void GraphOfGrid<Grid>::addWell (const std::set<int>& well, bool checkIntersecti
         std::accumulate(well.begin(), well.end(), wID,
                         [this](const auto wId, const auto gID)
                         { return contractVertices(wId, gID); });
+        for (int gID : well)
+        {
+            if (gID >= 0 && gID < static_cast<int>(inWell.size()))
+            {
+                inWell[gID] = 1;
+            }
+        }
         wells.emplace_front(well);
     }
 }
@@ -230,11 +298,13 @@ void GraphOfGrid<Grid>::addNeighboringCellsToWells ()
     // mark all cells that will be added to wells (addding them one
     // by one would require recursive checks for neighboring wells)
     std::vector<std::set<int>> buffer(wells.size());
+    Edges edges;
     int i=0;
     for (auto& w : wells)
     {
         buffer[i].insert(*w.begin()); // intersects with its well
-        for (const auto& v : edgeList(*w.begin()))
+        getEdges(*w.begin(), edges);
+        for (const auto& v : edges)
         {
             buffer[i].insert(v.first);
         }
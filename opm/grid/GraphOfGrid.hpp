@@ -28,6 +28,12 @@
 
 #include <opm/grid/CpGrid.hpp>
 
+#include <list>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
 namespace Opm {
 
 /// \brief A class storing a graph representation of the grid
@@ -39,6 +45,11 @@ namespace Opm {
 /// Features edge contractions, which adds weights of merged vertices
 /// and of edges to every shared neighbor. Intended use is for loadbalancing
 /// to ensure that no well is split between processes.
+///
+/// The edges of the grid are stored in compressed sparse row format.
+/// Contracted vertices are tracked by a union-find structure, and
+/// the ID of a contracted vertex is the smallest global ID of the merged
+/// cells. Edges of contracted vertices are merged when they are requested.
 template<typename Grid>
 class GraphOfGrid{
     using WeightType = float;
@@ -52,6 +63,9 @@ class GraphOfGrid{
     };
 
 public:
+    /// \brief Edges of a vertex as (neighbor ID, edge weight), sorted by ID
+    using Edges = std::vector<std::pair<int,WeightType>>;
+
     explicit GraphOfGrid (const Grid& grid_,
                           const double* transmissibilities=nullptr,
                           const Dune::EdgeWeightMethod edgeWeightMethod=Dune::EdgeWeightMethod::defaultTransEdgeWgt)
@@ -68,49 +82,121 @@ public:
     /// \brief Number of graph vertices
     int size () const
     {
-        return graph.size();
+        return numVertices;
     }
 
-    auto begin() const
+    /// \brief Iterator over the vertices, in increasing order of ID
+    ///
+    /// Dereferencing gives a pair of the vertex ID and its properties,
+    /// which are assembled on access.
+    class VertexIterator
+    {
+    public:
+        using value_type = std::pair<int, VertexProperties>;
+
+        VertexIterator(const GraphOfGrid& gog, int gID)
+            : gog_(&gog), gID_(gID)
+        {
+            skipContracted();
+        }
+        /// \brief ID of the vertex, cheaper than dereferencing
+        int id() const
+        {
+            return gID_;
+        }
+        value_type operator*() const
+        {
+            return { gID_, gog_->getVertex(gID_) };
+        }
+        VertexIterator& operator++()
+        {
+            ++gID_;
+            skipContracted();
+            return *this;
+        }
+        bool operator==(const VertexIterator& other) const
+        {
+            return gID_ == other.gID_;
+        }
+        bool operator!=(const VertexIterator& other) const
+        {
+            return gID_ != other.gID_;
+        }
+
+    private:
+        void skipContracted()
+        {
+            while (gID_ < static_cast<int>(gog_->parent.size())
+                   && gog_->minID[gog_->parent[gID_]] != gID_)
+            {
+                ++gID_;
+            }
+        }
+
+        const GraphOfGrid* gog_;
+        int gID_;
+    };
+
+    VertexIterator begin() const
     {
-        return graph.begin();
+        return VertexIterator(*this, 0);
     }
-    auto end() const
+    VertexIterator end() const
     {
-        return graph.end();
+        return VertexIterator(*this, parent.size());
     }
 
-    /// \brief Get iterator to the vertex with this global ID
+    /// \brief Get ID of the vertex with this global ID
     /// or ID of the well containing it
-    auto find(int gID) const
+    ///
+    /// returns -1 if no such vertex exists
+    int find(int gID) const
     {
-        // search the graph first, and then wells
-        auto pgID = graph.find(gID);
-        if (pgID == graph.end())
+        if (gID < 0 || gID >= static_cast<int>(parent.size()))
         {
-            gID = wellID(gID);
-            if (gID == -1)
-            {
-                return graph.end();
-            }
-            pgID = graph.find(gID);
+            return -1;
         }
-        return pgID;
+        const int id = minID[parent[gID]];
+        if (id == gID || inWell[gID])
+        {
+            return id;
+        }
+        return -1;
     }
 
     /// \brief Return properties of vertex of given ID.
     ///
-    /// If no such vertex exists, returns vertex with
-    /// process -1, weight 0, and empty edgeList.
     /// If the vertex is in a well, return the well's vertex.
-    const VertexProperties& getVertex (int gID) const
+    /// Throws if no such vertex exists.
+    VertexProperties getVertex (int gID) const
     {
-        auto pgID = find(gID);
-        if (pgID == graph.end())
+        const int vertex = find(gID);
+        if (vertex == -1)
         {
             OPM_THROW(std::logic_error, "GraphOfGrid::getVertex: gID is not in the graph!");
         }
-        return pgID->second;
+        VertexProperties properties;
+        properties.nproc = rank;
+        properties.weight = vertexWeights[parent[vertex]];
+        Edges edges;
+        collectEdges(parent[vertex], edges);
+        properties.edges.insert(edges.begin(), edges.end());
+        return properties;
+    }
+
+    /// \brief Weight of the vertex with this ID (or of the well containing it)
+    ///
+    /// returns 0 if vertex with such global ID is not in the graph (or wells)
+    WeightType vertexWeight (int gID) const
+    {
+        const int vertex = find(gID);
+        return vertex == -1 ? 0 : vertexWeights[parent[vertex]];
+    }
+
+    /// \brief Number of the process owning the vertices
+    int getRank () const
+    {
+        return rank;
     }
 
     /// \brief Number of vertices for given vertex
@@ -118,27 +204,42 @@ public:
     // returns -1 if vertex with such global ID is not in the graph (or wells)
     int numEdges (int gID) const
     {
-        auto pgID = find(gID);
-        if (pgID == graph.end())
+        const int vertex = find(gID);
+        if (vertex == -1)
         {
             return -1;
         }
-        else
-        {
-            return pgID->second.edges.size();
-        }
+        Edges edges;
+        collectEdges(parent[vertex], edges);
+        return edges.size();
     }
 
     /// \brief List of neighbors for given vertex
-    const EdgeList& edgeList(int gID) const
+    EdgeList edgeList(int gID) const
     {
-        // get iterator to the vertex or the well containing it
-        auto pgID = find(gID);
-        if (pgID==graph.end())
+        Edges edges;
+        if (!getEdges(gID, edges))
         {
             OPM_THROW(std::logic_error, "GraphOfGrid::edgeList: gID is not in the graph!");
         }
-        return pgID->second.edges;
+        return EdgeList(edges.begin(), edges.end());
+    }
+
+    /// \brief Fill edges with the neighbors of given vertex
+    ///
+    /// Cheaper than edgeList() when called for many vertices, as
+    /// the storage of edges can be reused.
+    /// Returns false if vertex with such global ID is not in the graph (or wells).
+    bool getEdges(int gID, Edges& edges) const
+    {
+        const int vertex = find(gID);
+        if (vertex == -1)
+        {
+            edges.clear();
+            return false;
+        }
+        collectEdges(parent[vertex], edges);
+        return true;
     }
 
     /// \brief Contract two vertices
@@ -185,14 +286,26 @@ private:
     void createGraph (const double* transmissibilities=nullptr,
                       const Dune::EdgeWeightMethod edgeWeightMethod=Dune::EdgeWeightMethod::defaultTransEdgeWgt);
 
-    /// \brief Identify the well containing the cell with this global ID
-    ///
-    /// returns the smallest cell-ID in the well or
-    /// returns -1 if no well contains given gID
-    int wellID (int gID) const;
+    /// \brief Merge the edges of all cells in the set of representative rep
+    void collectEdges (int rep, Edges& edges) const;
 
     const Grid& grid;
-    std::unordered_map<int, VertexProperties> graph; // <gID, VertexProperties>
+    int rank = 0;
+    int numVertices = 0;
+    // Grid graph in compressed sparse row format, indexed by global ID.
+    std::vector<int> offsets;
+    std::vector<int> neighbors;
+    std::vector<WeightType> edgeWeights;
+    // Union-find of contracted vertices. Each cell points directly to the
+    // representative of its set, and the cells of a set form a cycle in next.
+    // On contraction, the smaller set is relabelled.
+    std::vector<int> parent;
+    std::vector<int> next;
+    // Indexed by representatives: size of the set, vertex ID, and weight
+    std::vector<int> setSize;
+    std::vector<int> minID;
+    std::vector<WeightType> vertexWeights;
+    std::vector<char> inWell;
     std::list<std::set<int>> wells;
 };
 
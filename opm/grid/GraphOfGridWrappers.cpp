@@ -52,11 +52,11 @@ void getGraphOfGridVerticesList(void* pGraph,
     assert(weightDim==1); // vertex weight is a single float
     const GraphOfGrid<Dune::CpGrid>& gog = *static_cast<const GraphOfGrid<Dune::CpGrid>*>(pGraph);
     int i=0;
-    for (const auto& v : gog)
+    for (auto v = gog.begin(); v != gog.end(); ++v)
     {
-        gIDs[i] = v.first;
+        gIDs[i] = v.id();
         // lIDs are left unused
-        objWeights[i] = v.second.weight;
+        objWeights[i] = gog.vertexWeight(v.id());
         ++i;
     }
     *err = ZOLTAN_OK;
@@ -105,10 +105,12 @@ void getGraphOfGridEdgeList(void *pGraph,
     assert(dimGlobalID==1); // ID is a single int
     assert(weightDim==1); // edge weight is a single float
     const GraphOfGrid<Dune::CpGrid>&  gog = *static_cast<const GraphOfGrid<Dune::CpGrid>*>(pGraph);
+    const int rank = gog.getRank();
+    GraphOfGrid<Dune::CpGrid>::Edges eList;
     int id=0;
     for (int i=0; i<numCells; ++i)
     {
-        const auto& eList = gog.edgeList(gIDs[i]);
+        gog.getEdges(gIDs[i], eList);
         if ((int)eList.size()!=numEdges[i])
         {
             std::ostringstream ostr;
@@ -122,7 +124,7 @@ void getGraphOfGridEdgeList(void *pGraph,
         for (const auto& e : eList)
         {
             nborGIDs[id]= e.first;
-            nborProc[id]= gog.getVertex(e.first).nproc;
+            nborProc[id]= rank;
             edgeWeights[id]= e.second;
             ++id;
         }
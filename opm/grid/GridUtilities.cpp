@@ -20,12 +20,15 @@
 #include <opm/grid/GridUtilities.hpp>
 #include <opm/grid/GridHelpers.hpp>
 
+#include <opm/common/ErrorMacros.hpp>
+
 #include <opm/grid/utility/platform_dependent/disable_warnings.h>
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h>
 
 #include <set>
 #include <vector>
 #include <cmath>
+#include <cstdlib>
 #include <algorithm>
 
 namespace {
@@ -137,4 +140,92 @@ namespace Opm
         }
     }
 
+    UnstructuredGrid* extractSubGrid(const UnstructuredGrid& grid,
+                                     const std::vector<int>& cells,
+                                     std::vector<int>& faces,
+                                     std::vector<int>& nodes)
+    {
+        const int dim = grid.dimensions;
+        std::vector<int> local_cell(grid.number_of_cells, -1);
+        std::vector<int> local_face(grid.number_of_faces, -1);
+        std::vector<int> local_node(grid.number_of_nodes, -1);
+        faces.clear();
+        nodes.clear();
+        std::size_t num_cell_faces = 0;
+        std::size_t num_face_nodes = 0;
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+            const int cell = cells[c];
+            local_cell[cell] = c;
+            for (int hf = grid.cell_facepos[cell]; hf < grid.cell_facepos[cell + 1]; ++hf) {
+                const int face = grid.cell_faces[hf];
+                ++num_cell_faces;
+                if (local_face[face] >= 0) {
+                    continue;
+                }
+                local_face[face] = faces.size();
+                faces.push_back(face);
+                for (int np = grid.face_nodepos[face]; np < grid.face_nodepos[face + 1]; ++np) {
+                    const int node = grid.face_nodes[np];
+                    ++num_face_nodes;
+                    if (local_node[node] < 0) {
+                        local_node[node] = nodes.size();
+                        nodes.push_back(node);
+                    }
+                }
+            }
+        }
+
+        UnstructuredGrid* sub = allocate_grid(dim, cells.size(), faces.size(), num_face_nodes,
+                                              num_cell_faces, nodes.size());
+        if (!sub) {
+            OPM_THROW(std::runtime_error, "Unable to allocate the subgrid.");
+        }
+        std::copy(grid.cartdims, grid.cartdims + 3, sub->cartdims);
+        sub->global_cell = static_cast<int*>(std::malloc(cells.size() * sizeof(int)));
+        if (!sub->global_cell) {
+            destroy_grid(sub);
+            OPM_THROW(std::runtime_error, "Unable to allocate the subgrid.");
+        }
+        if (!grid.cell_facetag) {
+            std::free(sub->cell_facetag);
+            sub->cell_facetag = nullptr;
+        }
+
+        for (std::size_t n = 0; n < nodes.size(); ++n) {
+            std::copy_n(grid.node_coordinates + dim * nodes[n], dim, sub->node_coordinates + dim * n);
+        }
+        sub->face_nodepos[0] = 0;
+        for (std::size_t f = 0; f < faces.size(); ++f) {
+            const int face = faces[f];
+            int pos = sub->face_nodepos[f];
+            for (int np = grid.face_nodepos[face]; np < grid.face_nodepos[face + 1]; ++np, ++pos) {
+                sub->face_nodes[pos] = local_node[grid.face_nodes[np]];
+            }
+            sub->face_nodepos[f + 1] = pos;
+            for (int side = 0; side < 2; ++side) {
+                const int cell = grid.face_cells[2 * face + side];
+                sub->face_cells[2 * f + side] = cell >= 0 ? local_cell[cell] : -1;
+            }
+            std::copy_n(grid.face_centroids + dim * face, dim, sub->face_centroids + dim * f);
+            std::copy_n(grid.face_normals + dim * face, dim, sub->face_normals + dim * f);
+            sub->face_areas[f] = grid.face_areas[face];
+        }
+        sub->cell_facepos[0] = 0;
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+            const int cell = cells[c];
+            int pos = sub->cell_facepos[c];
+            for (int hf = grid.cell_facepos[cell]; hf < grid.cell_facepos[cell + 1]; ++hf, ++pos) {
+                sub->cell_faces[pos] = local_face[grid.cell_faces[hf]];
+                if (grid.cell_facetag) {
+                    sub->cell_facetag[pos] = grid.cell_facetag[hf];
+                }
+            }
+            sub->cell_facepos[c + 1] = pos;
+            std::copy_n(grid.cell_centroids + dim * cell, dim, sub->cell_centroids + dim * c);
+            sub->cell_volumes[c] = grid.cell_volumes[cell];
+            sub->global_cell[c] = grid.global_cell ? grid.global_cell[cell] : cell;
+        }
+        return sub;
+    }
+
 } // namespace Opm
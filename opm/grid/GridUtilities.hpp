@@ -23,6 +23,8 @@
 #include <opm/grid/UnstructuredGrid.h>
 #include <opm/grid/utility/SparseTable.hpp>
 
+#include <vector>
+
 namespace Opm
 {
 
@@ -37,6 +39,21 @@ namespace Opm
     void orderCounterClockwise(const UnstructuredGrid& grid,
                                SparseTable<int>& nb);
 
+    /// Extract the part of a grid made up of some of its cells.
+    /// Faces between a cell of the subgrid and a cell outside of it
+    /// become boundary faces of the subgrid. The global cell indices
+    /// of the subgrid are the ones of the grid, or the cell indices
+    /// of the grid if it has none.
+    /// \param[in]  grid   A grid object.
+    /// \param[in]  cells  The cells of the subgrid, in their order there.
+    /// \param[out] faces  For each face of the subgrid its index in grid.
+    /// \param[out] nodes  For each node of the subgrid its index in grid.
+    /// \return            The subgrid, to be released with destroy_grid().
+    UnstructuredGrid* extractSubGrid(const UnstructuredGrid& grid,
+                                     const std::vector<int>& cells,
+                                     std::vector<int>& faces,
+                                     std::vector<int>& nodes);
+
 } // namespace Opm
 
 #endif // OPM_GRIDUTILITIES_HEADER_INCLUDED
@@ -0,0 +1,259 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/common/CellGraphPartition.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#if HAVE_MPI
+#include <opm/grid/common/MetisPartition.hpp>
+#include <opm/grid/common/ZoltanGraphFunctions.hpp>
+#endif
+
+#include <stdexcept>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+
+#if defined(HAVE_ZOLTAN) && HAVE_MPI
+/// \brief The graph as seen by the Zoltan callbacks.
+struct ZoltanCellGraph
+{
+    const std::vector<int>& offsets;
+    const std::vector<int>& neighbors;
+    bool partitionIsEmpty;
+    int root;
+};
+
+int getGraphNumCells(void* graphPointer, int* err)
+{
+    const auto& graph = *static_cast<const ZoltanCellGraph*>(graphPointer);
+    *err = ZOLTAN_OK;
+    return graph.partitionIsEmpty ? 0 : static_cast<int>(graph.offsets.size()) - 1;
+}
+
+void getGraphVertexList(void* graphPointer, int /* numGlobalIds */, int /* numLocalIds */,
+                        ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                        int /* wgtDim */, float* /* objWgts */, int* err)
+{
+    const auto& graph = *static_cast<const ZoltanCellGraph*>(graphPointer);
+    const int numCells = graph.partitionIsEmpty ? 0 : static_cast<int>(graph.offsets.size()) - 1;
+    for (int cell = 0; cell < numCells; ++cell) {
+        gids[cell] = cell;
+        lids[cell] = cell;
+    }
+    *err = ZOLTAN_OK;
+}
+
+void getGraphNumEdgesList(void* graphPointer, int /* sizeGID */, int /* sizeLID */,
+                          int numCells, ZOLTAN_ID_PTR /* globalID */, ZOLTAN_ID_PTR localID,
+                          int* numEdges, int* err)
+{
+    const auto& graph = *static_cast<const ZoltanCellGraph*>(graphPointer);
+    for (int i = 0; i < numCells; ++i) {
+        numEdges[i] = graph.offsets[localID[i] + 1] - graph.offsets[localID[i]];
+    }
+    *err = ZOLTAN_OK;
+}
+
+void getGraphEdgeList(void* graphPointer, int /* sizeGID */, int /* sizeLID */,
+                      int numCells, ZOLTAN_ID_PTR /* globalID */, ZOLTAN_ID_PTR localID,
+                      int* /* numEdges */, ZOLTAN_ID_PTR nborGID, int* nborProc,
+                      int /* wgtDim */, float* /* ewgts */, int* err)
+{
+    const auto& graph = *static_cast<const ZoltanCellGraph*>(graphPointer);
+    int idx = 0;
+    for (int i = 0; i < numCells; ++i) {
+        for (int j = graph.offsets[localID[i]]; j < graph.offsets[localID[i] + 1]; ++j, ++idx) {
+            nborGID[idx] = graph.neighbors[j];
+            nborProc[idx] = graph.root;
+        }
+    }
+    *err = ZOLTAN_OK;
+}
+
+std::vector<int> zoltanPartitionCellGraph(const std::vector<int>& offsets,
+                                          const std::vector<int>& neighbors,
+                                          const Communication<MPIHelper::MPICommunicator>& cc,
+                                          double imbalanceTol,
+                                          const std::map<std::string, std::string>& params,
+                                          int root)
+{
+    float ver = 0;
+    int argc = 0;
+    char** argv = nullptr;
+    int rc = Zoltan_Initialize(argc, argv, &ver);
+    if (rc != ZOLTAN_OK) {
+        OPM_THROW(std::runtime_error, "Could not initialize Zoltan!");
+    }
+    Zoltan_Struct* zz = Zoltan_Create(cc);
+    if (zz == nullptr) {
+        OPM_THROW(std::runtime_error, "Could not create Zoltan data structures!");
+    }
+    Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+    Zoltan_Set_Param(zz, "LB_METHOD", "GRAPH");
+    Zoltan_Set_Param(zz, "LB_APPROACH", "PARTITION");
+    Zoltan_Set_Param(zz, "NUM_GID_ENTRIES", "1");
+    Zoltan_Set_Param(zz, "NUM_LID_ENTRIES", "1");
+    Zoltan_Set_Param(zz, "RETURN_LISTS", "EXPORT");
+    Zoltan_Set_Param(zz, "EDGE_WEIGHT_DIM", "0");
+    Zoltan_Set_Param(zz, "OBJ_WEIGHT_DIM", "0");
+    Zoltan_Set_Param(zz, "IMBALANCE_TOL", std::to_string(imbalanceTol).c_str());
+    for (const auto& [key, value] : params) {
+        Zoltan_Set_Param(zz, key.c_str(), value.c_str());
+    }
+
+    // One process has the whole graph and all others an empty partition.
+    ZoltanCellGraph graph{offsets, neighbors, cc.rank() != root, root};
+    Zoltan_Set_Num_Obj_Fn(zz, getGraphNumCells, &graph);
+    Zoltan_Set_Obj_List_Fn(zz, getGraphVertexList, &graph);
+    Zoltan_Set_Num_Edges_Multi_Fn(zz, getGraphNumEdgesList, &graph);
+    Zoltan_Set_Edge_List_Multi_Fn(zz, getGraphEdgeList, &graph);
+
+    int changes, numGidEntries, numLidEntries, numImport, numExport;
+    ZOLTAN_ID_PTR importGlobalGids, importLocalGids, exportGlobalGids, exportLocalGids;
+    int *importProcs, *importToPart, *exportProcs, *exportToPart;
+    rc = Zoltan_LB_Partition(zz, &changes, &numGidEntries, &numLidEntries,
+                             &numImport, &importGlobalGids, &importLocalGids, &importProcs, &importToPart,
+                             &numExport, &exportGlobalGids, &exportLocalGids, &exportProcs, &exportToPart);
+    if (rc == ZOLTAN_WARN) {
+        Opm::OpmLog::warning("Zoltan_LB_Partition returned with warning");
+    } else if (rc == ZOLTAN_MEMERR) {
+        OPM_THROW(std::runtime_error, "Memory allocation failure in Zoltan_LB_Partition");
+    } else if (rc == ZOLTAN_FATAL) {
+        OPM_THROW(std::runtime_error, "Error returned from Zoltan_LB_Partition");
+    }
+
+    std::vector<int> parts;
+    if (cc.rank() == root) {
+        parts.assign(offsets.size() - 1, root);
+        for (int i = 0; i < numExport; ++i) {
+            parts[exportLocalGids[i]] = exportProcs[i];
+        }
+    }
+    Zoltan_LB_Free_Part(&exportGlobalGids, &exportLocalGids, &exportProcs, &exportToPart);
+    Zoltan_LB_Free_Part(&importGlobalGids, &importLocalGids, &importProcs, &importToPart);
+    Zoltan_Destroy(&zz);
+    return parts;
+}
+#endif // defined(HAVE_ZOLTAN) && HAVE_MPI
+
+#if defined(HAVE_METIS) && HAVE_MPI
+std::vector<int> metisPartitionCellGraph(const std::vector<int>& offsets,
+                                         const std::vector<int>& neighbors,
+                                         int numParts,
+                                         double imbalanceTol,
+                                         [[maybe_unused]] const std::map<std::string, std::string>& params)
+{
+    idx_t n = offsets.size() - 1;
+    idx_t ncon = 1;
+    idx_t nparts = numParts;
+    idx_t objval = 0;
+    std::vector<idx_t> xadj(offsets.begin(), offsets.end());
+    std::vector<idx_t> adjncy(neighbors.begin(), neighbors.end());
+    std::vector<idx_t> gpart(n);
+    real_t ubvec = imbalanceTol;
+    int manuallySelectedMethod = 0;
+#if IS_SCOTCH_METIS_HEADER
+    idx_t* options = nullptr;
+    if (ubvec >= 1.0) {
+        ubvec -= 1.0;
+    }
+#else
+    std::vector<idx_t> optionsVector(METIS_NOPTIONS);
+    idx_t* options = optionsVector.data();
+    setMetisOptions(params, manuallySelectedMethod, options);
+#endif
+    int rc = METIS_OK;
+    if (manuallySelectedMethod == 1 || (manuallySelectedMethod == 0 && nparts < 65 && ((nparts & (nparts - 1)) == 0))) {
+        rc = METIS_PartGraphRecursive(&n, &ncon, xadj.data(), adjncy.data(), nullptr, nullptr, nullptr,
+                                      &nparts, nullptr, &ubvec, options, &objval, gpart.data());
+    } else {
+        rc = METIS_PartGraphKway(&n, &ncon, xadj.data(), adjncy.data(), nullptr, nullptr, nullptr,
+                                 &nparts, nullptr, &ubvec, options, &objval, gpart.data());
+    }
+    if (rc != METIS_OK) {
+        OPM_THROW(std::runtime_error, "METIS failed to partition the cell graph!");
+    }
+    return std::vector<int>(gpart.begin(), gpart.end());
+}
+#endif // defined(HAVE_METIS) && HAVE_MPI
+
+} // anonymous namespace
+
+std::vector<int> partitionCellGraph(const std::vector<int>& offsets,
+                                    const std::vector<int>& neighbors,
+                                    const Communication<MPIHelper::MPICommunicator>& cc,
+                                    PartitionMethod method,
+                                    double imbalanceTol,
+                                    [[maybe_unused]] const std::map<std::string, std::string>& params,
+                                    int root)
+{
+    int numCells = cc.rank() == root ? static_cast<int>(offsets.size()) - 1 : 0;
+    cc.broadcast(&numCells, 1, root);
+    std::vector<int> parts;
+    if (cc.size() == 1) {
+        return std::vector<int>(numCells, 0);
+    }
+
+    if (method == PartitionMethod::zoltan || method == PartitionMethod::zoltanGoG) {
+#if defined(HAVE_ZOLTAN) && HAVE_MPI
+        parts = zoltanPartitionCellGraph(offsets, neighbors, cc, imbalanceTol, params, root);
+#else
+        OPM_THROW(std::runtime_error, "Parallel runs depend on ZOLTAN if useZoltan is true. Please install!");
+#endif
+    } else if (method == PartitionMethod::metis) {
+#if defined(HAVE_METIS) && HAVE_MPI
+        int ok = 1;
+        if (cc.rank() == root) {
+            try {
+                parts = metisPartitionCellGraph(offsets, neighbors, cc.size(), imbalanceTol, params);
+            } catch (const std::exception&) {
+                ok = 0;
+            }
+        }
+        if (!cc.min(ok)) {
+            OPM_THROW(std::runtime_error, "METIS failed to partition the cell graph!");
+        }
+#else
+        OPM_THROW(std::runtime_error, "Parallel runs depend on METIS if useMetis is true. Please install!");
+#endif
+    } else if (cc.rank() == root) {
+        // Chunks of consecutive cells of (almost) equal size.
+        parts.resize(numCells);
+        for (int cell = 0; cell < numCells; ++cell) {
+            parts[cell] = static_cast<long long>(cell) * cc.size() / numCells;
+        }
+    }
+
+    parts.resize(numCells);
+    cc.broadcast(parts.data(), numCells, root);
+    return parts;
+}
+
+} // namespace cpgrid
+} // namespace Dune
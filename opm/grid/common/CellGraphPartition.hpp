@@ -0,0 +1,65 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CELLGRAPHPARTITION_HEADER
+#define OPM_CELLGRAPHPARTITION_HEADER
+
+#include <opm/grid/common/GridEnums.hpp>
+
+#include <dune/common/parallel/communication.hh>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Partition a cell graph among the processes of a communicator.
+///
+/// Used for grids other than CpGrid. The graph is given in compressed
+/// sparse row format: the neighbors of cell i are
+/// neighbors[offsets[i]], ..., neighbors[offsets[i+1]-1]. Each edge
+/// needs to be stored in both directions.
+///
+/// \param offsets The row offsets of the graph, only used on root.
+/// \param neighbors The neighbors of the cells, only used on root.
+/// \param cc The communicator. Its size is the number of parts.
+/// \param method Zoltan, METIS, or simple. The latter splits the cells
+///               into chunks of consecutive indices. zoltanGoG is
+///               treated like zoltan.
+/// \param imbalanceTol The imbalance tolerance of Zoltan and METIS.
+/// \param params Additional parameters for Zoltan or METIS.
+/// \param root The process that has the graph.
+/// \return For each cell the process that owns it, on all processes.
+std::vector<int> partitionCellGraph(const std::vector<int>& offsets,
+                                    const std::vector<int>& neighbors,
+                                    const Communication<MPIHelper::MPICommunicator>& cc,
+                                    PartitionMethod method,
+                                    double imbalanceTol,
+                                    const std::map<std::string, std::string>& params = {},
+                                    int root = 0);
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_CELLGRAPHPARTITION_HEADER
@@ -198,6 +198,79 @@ namespace Dune
         }
 
 
+        /// @brief Computes centroid, unit normal and area of a polygon.
+        ///
+        /// Gives the same results as polygonCentroid() with the average()
+        /// of the points as inpoint, followed by polygonNormal() and
+        /// polygonArea() with that centroid, but visits the points twice
+        /// instead of four times and computes each triangle area once.
+        /// @param points  The polygon corners, in order.
+        /// @param centroid  The polygon centroid.
+        /// @param normal  The unit normal, zero for a degenerate polygon.
+        /// @return The polygon area.
+        template <class Point, template <class> class Vector>
+        double polygonGeometry(const Vector<Point>& points,
+                               Point& centroid,
+                               Point& normal)
+        {
+            centroid = polygonCentroid(points, average(points));
+            normal = 0.0;
+            double tot_area = 0.0;
+            int num_points = points.size();
+            for (int i = 0; i < num_points; ++i) {
+                const Point d0 = points[i] - centroid;
+                const Point d1 = points[i + 1 < num_points ? i + 1 : 0] - centroid;
+                Point w_normal = cross(d0, d1);
+                const double tri_area = 0.5 * w_normal.two_norm();
+                w_normal *= tri_area;
+                normal += w_normal;
+                tot_area += tri_area;
+            }
+
+            if (const auto length = normal.two_norm(); length > 0.0) {
+                normal /= length;
+            }
+
+            return tot_area;
+        }
+
+
+        /// @brief Computes volume and centroid of the part of a cell
+        /// spanned by one of its faces and a point inside the cell.
+        ///
+        /// Gives the same results as polygonCellVolume() and
+        /// polygonCellCentroid() in a single pass over the points.
+        /// @param points  The face corners, in order.
+        /// @param face_centroid  The face centroid.
+        /// @param cell_centroid  The apex point inside the cell.
+        /// @param centroid  The centroid of the cell part.
+        /// @return The volume of the cell part.
+        template <class Point, template <class> class Vector>
+        double polygonCellVolumeCentroid(const Vector<Point>& points,
+                                         const Point& face_centroid,
+                                         const Point& cell_centroid,
+                                         Point& centroid)
+        {
+            centroid = 0.0;
+            double tot_volume = 0.0;
+            int num_points = points.size();
+            for (int i = 0; i < num_points; ++i) {
+                const Point tet[4] = { cell_centroid, face_centroid, points[i],
+                                       points[i + 1 < num_points ? i + 1 : 0] };
+                double small_volume = std::fabs(simplex_volume(tet));
+                Point small_centroid = tet[0];
+                for(int j = 1; j < 4; ++j){
+                    small_centroid += tet[j];
+                }
+                small_centroid *= small_volume/4.0;
+                centroid += small_centroid;
+                tot_volume += small_volume;
+            }
+            centroid /= tot_volume;
+            return tot_volume;
+        }
+
+
     } // namespace GeometryHelpers
 
 } // namespace Dune
@@ -51,6 +51,14 @@ namespace Dune {
         /// \brief use Zoltan on GraphOfGrid for partitioning
         zoltanGoG=3
     };
+
+    /// \brief enum for choosing methods for renumbering the cells of a grid.
+    enum class CellOrdering {
+        /// \brief Order the cells along a Hilbert curve through their centroids.
+        hilbert=0,
+        /// \brief Use reverse Cuthill-McKee on the graph of cells connected by faces.
+        reverseCuthillMcKee=1
+    };
 }
 
 #endif
@@ -43,7 +43,11 @@
 #include <opm/grid/CpGrid.hpp>
 #include <opm/grid/cpgrid/CpGridDataTraits.hpp>
 #include <opm/grid/common/ZoltanPartition.hpp>
+#include <algorithm>
+#include <array>
+#include <numeric>
 #include <stack>
+#include <unordered_set>
 
 #ifdef HAVE_MPI
 #include "mpi.h"
@@ -248,223 +252,195 @@ namespace Dune
         }
     }
 
-/// \brief Adds cells to the overlap that just share a point with an owner cell.
-void addOverlapCornerCell(const CpGrid& grid, int owner,
-                          const CpGrid::Codim<0>::Entity& from,
-                          const CpGrid::Codim<0>::Entity& neighbor,
-                          const std::vector<int>& cell_part,
-                          std::vector<std::set<int> >& cell_overlap)
+namespace
 {
-    const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
-    int my_index = ix.index(from);
-    int nb_index = ix.index(neighbor);
-    const int num_from_subs = from.subEntities(CpGrid::dimension);
-    for ( int i = 0; i < num_from_subs ; i++ )
+
+/// \brief Breadth-first construction of the overlap layers of the partitions of a grid.
+///
+/// The overlap of a partition consists of the cells that are not owned by it but
+/// can be reached from its owned cells by crossing at most layers faces. With
+/// transmissibilities, faces with zero transmissibility are not crossed, as no flux
+/// passes them and the offdiagonal of the system matrix is zero anyway. Each cell is
+/// visited at most once per partition, and only cells next to the front of a
+/// partition are processed after the first layer.
+///
+/// With corner cells the last layer is extended by cells that share a corner with a
+/// cell of the previous layer (an owned cell for one layer) and that are
+/// neighbors of a cell of the last layer. Example of a subdomain of a 4x4 grid
+/// with and without corner cells in the overlap. Note that the corner cell is not
+/// needed for cell centered finite volume schemes.
+/// I = interior cells, O = overlap cells and E = exterior cells.
+///
+///  With corner     Without corner
+///  I I O E         I I O E
+///  I I O E         I I O E
+///  O O O E         O O E E
+///  E E E E         E E E E
+class OverlapBuilder
+{
+public:
+    OverlapBuilder(const CpGrid& grid, const std::vector<int>& cell_part,
+                   const double* trans, bool addCornerCells, int layers)
+        : grid_(grid), cell_part_(cell_part), trans_(trans),
+          addCornerCells_(addCornerCells), layers_(layers)
     {
-        int mypoint = ix.index(from.subEntity<CpGrid::dimension>(i));
-        const int num_nb_subs = neighbor.subEntities(CpGrid::dimension);
-        for ( int j = 0; j < num_nb_subs; j++)
-        {
-            int otherpoint = ix.index(neighbor.subEntity<CpGrid::dimension>(j));
-            if ( mypoint == otherpoint )
-            {
-                cell_overlap[nb_index].insert(owner);
-                cell_overlap[my_index].insert(cell_part[nb_index]);
-                return;
+        // Owned cells of each partition, bucketed by partition number.
+        int num_parts = 0;
+        for (const auto part : cell_part_)
+            num_parts = std::max(num_parts, part + 1);
+        part_start_.assign(num_parts + 1, 0);
+        for (const auto part : cell_part_)
+            ++part_start_[part + 1];
+        std::partial_sum(part_start_.begin(), part_start_.end(), part_start_.begin());
+        part_cells_.resize(cell_part_.size());
+        auto next = part_start_;
+        for (std::size_t cell = 0; cell < cell_part_.size(); ++cell)
+            part_cells_[next[cell_part_[cell]]++] = cell;
+
+        if (addCornerCells_) {
+            const auto& ix = grid_.leafIndexSet();
+            cell_corners_.resize(cell_part_.size());
+            for (const auto& element : elements(grid_.leafGridView())) {
+                auto& corners = cell_corners_[ix.index(element)];
+                corners.fill(-1);
+                const int num_corners = std::min(int(corners.size()),
+                                                 int(element.subEntities(CpGrid::dimension)));
+                for (int i = 0; i < num_corners; ++i)
+                    corners[i] = ix.index(element.subEntity<CpGrid::dimension>(i));
             }
         }
     }
-}
 
-/// \brief Adds cells to the overlap that just share a point with an owner cell.
-void addOverlapCornerCell(const CpGrid& grid, int owner,
-                          const CpGrid::Codim<0>::Entity& from,
-                          const CpGrid::Codim<0>::Entity& neighbor,
-                          const std::vector<int>& cell_part,
-                          std::vector<std::tuple<int,int,char>>& exportList)
-{
-    // Add corner cells to the overlap layer. Example of a subdomain of a 4x4 grid
-    // with and without corner cells in the overlap is given below. Note that the
-    // corner cell is not needed for cell centered finite volume schemes. 
-    // I = interior cells, O = overlap cells and E = exterior cells.
-    //
-    //  With corner     Without corner
-    //  I I O E         I I O E 
-    //  I I O E         I I O E 
-    //  O O O E         O O E E
-    //  E E E E         E E E E
-    using AttributeSet = Dune::cpgrid::CpGridDataTraits::AttributeSet;
-    const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
-    int my_index = ix.index(from);
-    int nb_index = ix.index(neighbor);
-    const int num_from_subs = from.subEntities(CpGrid::dimension);
-    for ( int i = 0; i < num_from_subs ; i++ )
+    int numParts() const
     {
-        int mypoint = ix.index(from.subEntity<CpGrid::dimension>(i));
-        const int num_nb_subs = neighbor.subEntities(CpGrid::dimension);
-        for ( int j = 0; j < num_nb_subs; j++)
-        {
-            int otherpoint = ix.index(neighbor.subEntity<CpGrid::dimension>(j));
-            if ( mypoint == otherpoint )
-            {
-                // Note: multiple adds for same process are possible
-                exportList.emplace_back(nb_index, owner, AttributeSet::copy);
-                exportList.emplace_back(my_index, cell_part[nb_index],  AttributeSet::copy);
-                return;
+        return part_start_.size() - 1;
+    }
+
+    /// \brief Whether partition part owns any cells.
+    bool hasCells(int part) const
+    {
+        return part_start_[part + 1] > part_start_[part];
+    }
+
+    /// \brief Computes the overlap cells of a partition.
+    /// \param part The number of the partition.
+    /// \param visited Scratch space for the cells added to the overlap, which is
+    ///                cleared first. Its size is that of the overlap only.
+    /// \param[out] overlap The overlap cells of the partition, each only once.
+    void build(int part, std::unordered_set<int>& visited, std::vector<int>& overlap) const
+    {
+        overlap.clear();
+        visited.clear();
+        std::vector<int> frontier(part_cells_.begin() + part_start_[part],
+                                  part_cells_.begin() + part_start_[part + 1]);
+        std::vector<int> next;
+        for (int layer = 1; layer <= layers_ && !frontier.empty(); ++layer) {
+            next.clear();
+            for (const int cell : frontier) {
+                forEachNeighbor(cell, true, [&](int neighbor) {
+                    if (cell_part_[neighbor] != part && visited.insert(neighbor).second)
+                        next.push_back(neighbor);
+                });
             }
+            overlap.insert(overlap.end(), next.begin(), next.end());
+            if (layer == layers_ && addCornerCells_)
+                addCornerCells(part, frontier, visited, overlap);
+            frontier.swap(next);
         }
     }
-}
 
-void addOverlapLayer(const CpGrid& grid, int index, const CpGrid::Codim<0>::Entity& e,
-                     const int owner, const std::vector<int>& cell_part,
-                     std::vector<std::set<int> >& cell_overlap, int recursion_deps)
+private:
+    /// \brief Calls f for each cell that shares a face with cell.
+    template<class F>
+    void forEachNeighbor(int cell, bool skipZeroTrans, F&& f) const
     {
-        const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
-        for (CpGrid::LeafIntersectionIterator iit = e.ileafbegin(); iit != e.ileafend(); ++iit) {
-            if ( iit->neighbor() ) {
-                int nb_index = ix.index(iit->outside());
-                if ( cell_part[nb_index]!=owner )
-                {
-                    cell_overlap[nb_index].insert(owner);
-                    cell_overlap[index].insert(cell_part[nb_index]);
-                    if ( recursion_deps>0 )
-                    {
-                        // Add another layer
-                        addOverlapLayer(grid, nb_index, iit->outside(), owner,
-                                        cell_part, cell_overlap, recursion_deps-1);
-                    }
-                    else
-                    {
-                        // Add cells to the overlap that just share a corner with e.
-                        for (CpGrid::LeafIntersectionIterator iit2 = iit->outside().ileafbegin();
-                             iit2 != iit->outside().ileafend(); ++iit2)
-                        {
-                           if ( iit2->neighbor() )
-                           {
-                               int nb_index2 = ix.index(iit2->outside( ));
-                               if( cell_part[nb_index2]==owner ) continue;
-                               addOverlapCornerCell(grid, owner, e, iit2->outside(),
-                                                    cell_part, cell_overlap);
-                           }
-                       }
-                    }
-                }
-            }
+        for (const auto& face : grid_.cellFaceRow(cell)) {
+            const int face_index = face.index();
+            if (skipZeroTrans && trans_ && trans_[face_index] == 0.0)
+                continue;
+            const int first = grid_.faceCell(face_index, 0);
+            const int neighbor = (first == cell) ? grid_.faceCell(face_index, 1) : first;
+            if (neighbor >= 0)
+                f(neighbor);
         }
     }
 
-    void addOverlapLayer(const CpGrid& grid, const std::vector<int>& cell_part,
-                         std::vector<std::set<int> >& cell_overlap, int mypart,
-                         int layers, bool all)
+    bool shareCorner(int cell1, int cell2) const
     {
-        cell_overlap.resize(cell_part.size());
-        const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
-        for (CpGrid::Codim<0>::LeafIterator it = grid.leafbegin<0>();
-             it != grid.leafend<0>(); ++it) {
-            int index = ix.index(*it);
-            int owner = -1;
-            if(cell_part[index]==mypart)
-                owner = mypart;
-            else
-            {
-                if(all)
-                    owner=cell_part[index];
-                else
-                    continue;
-            }
-            addOverlapLayer(grid, index, *it, owner, cell_part, cell_overlap, layers-1);
+        const auto& corners1 = cell_corners_[cell1];
+        const auto& corners2 = cell_corners_[cell2];
+        for (const int corner : corners1) {
+            if (corner >= 0 && std::find(corners2.begin(), corners2.end(), corner) != corners2.end())
+                return true;
         }
+        return false;
     }
 
-    void addOverlapLayer(const CpGrid& grid, int index, const CpGrid::Codim<0>::Entity& e,
-                         const int owner, const std::vector<int>& cell_part,
-                         std::vector<std::tuple<int,int,char>>& exportList,
-                         bool addCornerCells, int recursion_deps)
+    /// \brief Adds the cells that share a corner with a cell of frontier and
+    ///        neighbor a cell of the layer grown from it.
+    void addCornerCells(int part, const std::vector<int>& frontier,
+                        std::unordered_set<int>& visited, std::vector<int>& overlap) const
     {
-        using AttributeSet = Dune::cpgrid::CpGridDataTraits::AttributeSet;
-        const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
-        for (CpGrid::LeafIntersectionIterator iit = e.ileafbegin(); iit != e.ileafend(); ++iit) {
-            if ( iit->neighbor() ) {
-                int nb_index = ix.index(iit->outside());
-                if ( cell_part[nb_index]!=owner )
-                {
-                    // Note: multiple adds for same process are possible
-                    exportList.emplace_back(nb_index, owner, AttributeSet::copy);
-                    exportList.emplace_back(index, cell_part[nb_index],  AttributeSet::copy);
-                    if ( recursion_deps>0 )
-                    {
-                        // Add another layer
-                        addOverlapLayer(grid, nb_index, iit->outside(), owner,
-                                        cell_part, exportList, addCornerCells, recursion_deps-1);
-                    }
-                    else if (addCornerCells)
-                    {
-                        // Add cells to the overlap that just share a corner with e.
-                        for (CpGrid::LeafIntersectionIterator iit2 = iit->outside().ileafbegin();
-                             iit2 != iit->outside().ileafend(); ++iit2)
-                        {
-                            if ( iit2->neighbor() )
-                            {
-                                int nb_index2 = ix.index(iit2->outside());
-                                if( cell_part[nb_index2]!=owner ) {
-                                    addOverlapCornerCell(grid, owner, e, iit2->outside(),
-                                                         cell_part, exportList);
-                                }
-                            }
-                        }
+        for (const int cell : frontier) {
+            forEachNeighbor(cell, true, [&](int neighbor) {
+                if (cell_part_[neighbor] == part)
+                    return;
+                forEachNeighbor(neighbor, false, [&](int candidate) {
+                    if (cell_part_[candidate] != part && !visited.count(candidate)
+                        && shareCorner(cell, candidate)) {
+                        visited.insert(candidate);
+                        overlap.push_back(candidate);
                     }
-                }
-            }
+                });
+            });
         }
     }
 
-    void addOverlapLayerNoZeroTrans(const CpGrid& grid, int index, const CpGrid::Codim<0>::Entity& e,
-                                    const int owner, const std::vector<int>& cell_part,
-                                    std::vector<std::tuple<int,int,char>>& exportList,
-                                    bool addCornerCells, int recursion_deps, const double* trans)
+    const CpGrid& grid_;
+    const std::vector<int>& cell_part_;
+    const double* trans_;
+    bool addCornerCells_;
+    int layers_;
+    std::vector<int> part_start_;
+    std::vector<int> part_cells_;
+    std::vector<std::array<int,8>> cell_corners_;
+};
+
+/// \brief Computes the overlap of all partitions, in parallel if OpenMP is available.
+/// \return The overlap cells of each partition.
+std::vector<std::vector<int>> buildOverlaps(const OverlapBuilder& builder)
+{
+    const int num_parts = builder.numParts();
+    std::vector<std::vector<int>> overlaps(num_parts);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        using AttributeSet = Dune::OwnerOverlapCopyAttributeSet::AttributeSet;
-        const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
-        for (CpGrid::LeafIntersectionIterator iit = e.ileafbegin(); iit != e.ileafend(); ++iit) {
-            if ( iit->neighbor() ) {
-                int faceId = iit->id();
-
-                // If the transmissibility on a cell interface is zero we do not add the neighbor cell 
-                // to the overlap layer. The reason for this is that
-                // zero transmissibility -> no flux over the face -> zero offdiagonal.
-                // This is a reservoir simulation spesific thing that reduce parallel overhead.
-                if ( trans[faceId] != 0.0 ) {
-                    int nb_index = ix.index(iit->outside());
-                    if ( cell_part[nb_index]!=owner )
-                    {
-                        // Note: multiple adds for same process are possible
-                        exportList.emplace_back(nb_index, owner, AttributeSet::copy);
-                        exportList.emplace_back(index, cell_part[nb_index],  AttributeSet::copy);
-                        if ( recursion_deps>0 )
-                        {
-                            // Add another layer
-                            addOverlapLayerNoZeroTrans(grid, nb_index, e, owner, cell_part,
-                                                       exportList, addCornerCells, recursion_deps-1, trans);
-                        }
-                        else if (addCornerCells)
-                        {
-                            // Add cells to the overlap that just share a corner with e.
-                            for (CpGrid::LeafIntersectionIterator iit2 = iit->outside().ileafbegin();
-                                 iit2 != iit->outside().ileafend(); ++iit2)
-                            {
-                                if ( iit2->neighbor() )
-                                {
-                                    int nb_index2 = ix.index(iit2->outside());
-                                    if( cell_part[nb_index2]!=owner ) {
-                                        addOverlapCornerCell(grid, owner, e, iit2->outside(),
-                                                             cell_part, exportList);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+        std::unordered_set<int> visited;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int part = 0; part < num_parts; ++part)
+            builder.build(part, visited, overlaps[part]);
+    }
+    return overlaps;
+}
+
+} // anonymous namespace
+
+    void addOverlapLayer(const CpGrid& grid, const std::vector<int>& cell_part,
+                         std::vector<std::set<int> >& cell_overlap, int mypart,
+                         int layers, bool all)
+    {
+        cell_overlap.resize(cell_part.size());
+        const OverlapBuilder builder(grid, cell_part, nullptr, true, layers);
+        const auto overlaps = buildOverlaps(builder);
+        for (int part = 0; part < builder.numParts(); ++part) {
+            for (const int cell : overlaps[part]) {
+                // Without all, only the overlap of mypart and the partitions
+                // that mypart's cells are overlap of are of interest.
+                if (all || part == mypart || cell_part[cell] == mypart)
+                    cell_overlap[cell].insert(part);
             }
         }
     }
@@ -479,22 +455,22 @@ void addOverlapLayer(const CpGrid& grid, int index, const CpGrid::Codim<0>::Enti
 #ifdef HAVE_MPI
         using AttributeSet = Dune::cpgrid::CpGridData::AttributeSet;
         auto ownerSize = exportList.size();
-        const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
         std::map<int,int> exportProcs, importProcs;
 
-        for (CpGrid::Codim<0>::LeafIterator it = grid.leafbegin<0>();
-             it != grid.leafend<0>(); ++it) {
-            int index = ix.index(*it);
-            auto owner = cell_part[index];
-            exportProcs.insert(std::make_pair(owner, 0));
-            if ( trans ) {
-                addOverlapLayerNoZeroTrans(grid, index, *it, owner, cell_part, exportList, addCornerCells, layers-1, trans);
-            }
-            else {
-                addOverlapLayer(grid, index, *it, owner, cell_part, exportList, addCornerCells, layers-1);
-            }
+        const OverlapBuilder builder(grid, cell_part, trans, addCornerCells, layers);
+        const auto overlaps = buildOverlaps(builder);
+        std::size_t overlapSize = 0;
+        for (int part = 0; part < builder.numParts(); ++part) {
+            if (builder.hasCells(part))
+                exportProcs.insert(std::make_pair(part, 0));
+            overlapSize += overlaps[part].size();
+        }
+        exportList.reserve(ownerSize + overlapSize);
+        for (int part = 0; part < builder.numParts(); ++part) {
+            for (const int cell : overlaps[part])
+                exportList.emplace_back(cell, part, AttributeSet::copy);
         }
-        // remove multiple entries
+        // The entries are unique, sort them by cell and process.
         auto compare = [](const std::tuple<int,int,char>& t1, const std::tuple<int,int,char>& t2)
                        {
                            return (std::get<0>(t1) < std::get<0>(t2)) ||
@@ -505,9 +481,6 @@ void addOverlapLayer(const CpGrid& grid, int index, const CpGrid::Codim<0>::Enti
         auto ownerEnd = exportList.begin() + ownerSize;
         std::sort(ownerEnd, exportList.end(), compare);
 
-        auto newEnd = std::unique(ownerEnd, exportList.end());
-        exportList.resize(newEnd - exportList.begin());
-
         for(const auto& entry: importList)
             importProcs.insert(std::make_pair(std::get<1>(entry), 0));
         //count entries to send
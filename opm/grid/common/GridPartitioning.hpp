@@ -83,6 +83,8 @@ namespace Dune
     /// \param[out] cell_overlap a vector of sets that contains for each cell all
     ///             the partition numbers that it is an overlap cell of.
     /// \param[in] mypart The partition number of the processor.
+    /// \param[in] overlapLayers Number of overlap layers. Cells sharing a corner
+    ///            with the last layer but one are added, too.
     /// \param[in] all Whether to compute the overlap for all partions or just the
     ///            one associated by mypart.
     void addOverlapLayer(const CpGrid& grid,
@@ -102,6 +104,7 @@ namespace Dune
     /// \param[in] addCornerCells Switch for adding corner cells to overlap layer.
     /// \param[in] trans The transmissibilities on cell faces. When trans[i]==0, no overlap is added.
     /// \param[in] layer Number of overlap layers
+    /// \return The number of owner entries at the start of importList.
     int addOverlapLayer(const CpGrid& grid, const std::vector<int>& cell_part,
                         std::vector<std::tuple<int,int,char>>& exportList,
                         std::vector<std::tuple<int,int,char,int>>& importList,
@@ -69,6 +69,15 @@ namespace cpgrid
   #define METIS_OK 1
 #endif
 
+#if !IS_SCOTCH_METIS_HEADER
+/// \brief Translate the partitioning parameters into METIS options.
+/// \param[out] manuallySelectedMethod 0 if the method was not chosen, 1 for
+///             METIS_PartGraphRecursive, 2 for METIS_PartGraphKway.
+/// \param[out] options Array of size METIS_NOPTIONS.
+void setMetisOptions(const std::map<std::string, std::string>& optionsMap,
+                     int& manuallySelectedMethod, idx_t* options);
+#endif
+
 /// \brief Partition a CpGrid using METIS
 ///
 /// This function will extract graph information
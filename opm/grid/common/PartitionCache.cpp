@@ -0,0 +1,263 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/common/PartitionCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/WellConnections.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <type_traits>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+
+const char cacheMagic[8] = {'O', 'P', 'M', 'P', 'A', 'R', 'T', '1'};
+
+/// 64 bit FNV-1a hash.
+class Hasher
+{
+public:
+    void add(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash_ = (hash_ ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+
+    template <class T>
+    void add(const T& value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "Only arithmetic values are hashed by value");
+        add(&value, sizeof(T));
+    }
+
+    void add(const std::string& str)
+    {
+        add(static_cast<std::uint64_t>(str.size()));
+        add(str.data(), str.size());
+    }
+
+    std::uint64_t value() const
+    {
+        return hash_;
+    }
+
+private:
+    std::uint64_t hash_ = 14695981039346656037ULL;
+};
+
+template <class T>
+bool readValue(std::istream& in, T& value)
+{
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool readVector(std::istream& in, std::vector<int>& values)
+{
+    std::uint64_t size = 0;
+    if (!readValue(in, size)) {
+        return false;
+    }
+    std::vector<std::int32_t> buffer(size);
+    if (!in.read(reinterpret_cast<char*>(buffer.data()), size * sizeof(std::int32_t))) {
+        return false;
+    }
+    values.assign(buffer.begin(), buffer.end());
+    return true;
+}
+
+void writeVector(std::ostream& out, const std::vector<int>& values)
+{
+    const std::uint64_t size = values.size();
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    const std::vector<std::int32_t> buffer(values.begin(), values.end());
+    out.write(reinterpret_cast<const char*>(buffer.data()), size * sizeof(std::int32_t));
+}
+
+} // anonymous namespace
+
+std::uint64_t partitionCacheKey(const CpGrid& grid,
+                                const std::vector<OpmWellType>* wells,
+                                const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                                const double* transmissibilities,
+                                EdgeWeightMethod method,
+                                int partitionMethod,
+                                bool serialPartitioning,
+                                double imbalanceTol,
+                                bool allowDistributedWells,
+                                const std::map<std::string, std::string>& partitioningParams,
+                                int numProcesses)
+{
+    Hasher hasher;
+    hasher.add(cacheMagic, sizeof(cacheMagic));
+
+    // Partitioner and its input parameters
+    hasher.add(numProcesses);
+    hasher.add(static_cast<int>(method));
+    hasher.add(partitionMethod);
+    hasher.add(serialPartitioning);
+    hasher.add(imbalanceTol);
+    hasher.add(allowDistributedWells);
+    for (const auto& [name, value] : partitioningParams) {
+        hasher.add(name);
+        hasher.add(value);
+    }
+
+    // Grid
+    const auto& globalCell = grid.globalCell();
+    hasher.add(static_cast<std::uint64_t>(globalCell.size()));
+    hasher.add(globalCell.data(), globalCell.size() * sizeof(int));
+    const auto& cartDims = grid.logicalCartesianSize();
+    hasher.add(cartDims.data(), cartDims.size() * sizeof(int));
+    const int numFaces = grid.numFaces();
+    hasher.add(numFaces);
+    for (int face = 0; face < numFaces; ++face) {
+        hasher.add(grid.faceCell(face, 0));
+        hasher.add(grid.faceCell(face, 1));
+    }
+    // Cells refined into LGRs, weighted by their number of children
+    const int maxLevel = grid.maxLevel();
+    hasher.add(maxLevel);
+    if (maxLevel > 0) {
+        for (const auto& element : elements(grid.leafGridView())) {
+            if (element.isLeaf()) {
+                continue;
+            }
+            int children = 0;
+            for (auto child = element.hbegin(maxLevel); child != element.hend(maxLevel); ++child) {
+                ++children;
+            }
+            hasher.add(element.index());
+            hasher.add(children);
+        }
+    }
+    hasher.add(transmissibilities != nullptr && method != uniform);
+    if (transmissibilities && method != uniform) {
+        hasher.add(transmissibilities, numFaces * sizeof(double));
+    }
+
+    // Wells, including their possible future connections
+    hasher.add(wells != nullptr);
+    if (wells) {
+        const WellConnections wellConnections(*wells, possibleFutureConnections, grid);
+        hasher.add(static_cast<std::uint64_t>(wellConnections.size()));
+        for (std::size_t w = 0; w < wellConnections.size(); ++w) {
+#if HAVE_ECL_INPUT
+            hasher.add((*wells)[w].name());
+#endif
+            hasher.add(static_cast<std::uint64_t>(wellConnections[w].size()));
+            for (int cell : wellConnections[w]) {
+                hasher.add(cell);
+            }
+        }
+    }
+    return hasher.value();
+}
+
+std::vector<int> wellProcesses(const CpGrid& grid,
+                               const std::vector<OpmWellType>* wells,
+                               const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                               const std::vector<int>& parts)
+{
+    if (!wells) {
+        return {};
+    }
+    const WellConnections wellConnections(*wells, possibleFutureConnections, grid);
+    std::vector<int> procs(wellConnections.size(), -1);
+    for (std::size_t w = 0; w < wellConnections.size(); ++w) {
+        const auto& cells = wellConnections[w];
+        if (cells.empty()) {
+            continue;
+        }
+        const int proc = parts[*cells.begin()];
+        if (std::all_of(cells.begin(), cells.end(),
+                        [&parts, proc](int cell) { return parts[cell] == proc; })) {
+            procs[w] = proc;
+        }
+    }
+    return procs;
+}
+
+bool readPartitionCache(const std::string& fileName,
+                        std::uint64_t key,
+                        std::vector<int>& parts,
+                        std::vector<int>& wellProcs)
+{
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    char magic[sizeof(cacheMagic)];
+    std::uint64_t fileKey = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, cacheMagic, sizeof(magic)) != 0) {
+        Opm::OpmLog::warning("File " + fileName + " is not a partition cache, ignoring it.");
+        return false;
+    }
+    if (!readValue(in, fileKey) || fileKey != key) {
+        return false;
+    }
+    if (!readVector(in, parts) || !readVector(in, wellProcs)) {
+        Opm::OpmLog::warning("Partition cache " + fileName + " is truncated, ignoring it.");
+        return false;
+    }
+    return true;
+}
+
+void writePartitionCache(const std::string& fileName,
+                         std::uint64_t key,
+                         const std::vector<int>& parts,
+                         const std::vector<int>& wellProcs)
+{
+    // Write to a temporary file and move it in place, to never expose a partial file.
+    const std::string tmpName = fileName + ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream out(tmpName, std::ios::binary);
+        out.write(cacheMagic, sizeof(cacheMagic));
+        out.write(reinterpret_cast<const char*>(&key), sizeof(key));
+        writeVector(out, parts);
+        writeVector(out, wellProcs);
+        if (!out) {
+            Opm::OpmLog::warning("Could not write the partition cache " + fileName + ".");
+            std::remove(tmpName.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpName.c_str(), fileName.c_str()) != 0) {
+        Opm::OpmLog::warning("Could not write the partition cache " + fileName + ".");
+        std::remove(tmpName.c_str());
+    }
+}
+
+} // namespace cpgrid
+} // namespace Dune
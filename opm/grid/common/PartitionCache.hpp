@@ -0,0 +1,91 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PARTITIONCACHE_HEADER
+#define OPM_PARTITIONCACHE_HEADER
+
+#include <opm/grid/common/GridEnums.hpp>
+#include <opm/grid/utility/OpmWellType.hpp>
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Dune
+{
+
+class CpGrid;
+
+namespace cpgrid
+{
+
+/// \brief Key identifying the input of a partitioning computed by CpGrid::loadBalance().
+///
+/// Hash of the global cells and the face-cell connectivity of the grid, the cells
+/// refined into LGRs, the cells of the wells, the transmissibilities (unless the
+/// edge weights are uniform), the partitioning method and its parameters, and the
+/// number of processes.
+/// Only meaningful on the rank holding the whole grid.
+std::uint64_t partitionCacheKey(const CpGrid& grid,
+                                const std::vector<OpmWellType>* wells,
+                                const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                                const double* transmissibilities,
+                                EdgeWeightMethod method,
+                                int partitionMethod,
+                                bool serialPartitioning,
+                                double imbalanceTol,
+                                bool allowDistributedWells,
+                                const std::map<std::string, std::string>& partitioningParams,
+                                int numProcesses);
+
+/// \brief Process owning the cells of each well for the given partitioning.
+///
+/// \return For each well, the process of its cells, -1 if they are on
+///         several processes, or if the well has no active cells.
+std::vector<int> wellProcesses(const CpGrid& grid,
+                               const std::vector<OpmWellType>* wells,
+                               const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                               const std::vector<int>& parts);
+
+/// \brief Read a partitioning from a cache file.
+///
+/// \return false if the file does not exist, is not a partition cache,
+///         or was written for a different key.
+bool readPartitionCache(const std::string& fileName,
+                        std::uint64_t key,
+                        std::vector<int>& parts,
+                        std::vector<int>& wellProcs);
+
+/// \brief Write a partitioning to a cache file.
+///
+/// The file is replaced atomically, so that concurrent runs sharing the file
+/// read either the old or the new partitioning. Failure to write is logged,
+/// but does not throw.
+void writePartitionCache(const std::string& fileName,
+                         std::uint64_t key,
+                         const std::vector<int>& parts,
+                         const std::vector<int>& wellProcs);
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_PARTITIONCACHE_HEADER
@@ -21,6 +21,7 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <algorithm>
 #include <limits>
 
 
@@ -52,7 +53,6 @@ void getCpGridVertexList(void* cpGridPointer, int numGlobalIdEntries,
                          ZOLTAN_ID_PTR lids, int wgtDim,
                          float *objWgts, int *err)
 {
-    (void) wgtDim; (void) objWgts;
     const Dune::CpGrid&  grid = *static_cast<const Dune::CpGrid*>(cpGridPointer);
     auto& globalIdSet         =  grid.globalIdSet();
     auto& localIdSet          =  grid.localIdSet();
@@ -68,6 +68,17 @@ void getCpGridVertexList(void* cpGridPointer, int numGlobalIdEntries,
     for (auto cell = grid.leafbegin<0>(), cellEnd = grid.leafend<0>();
          cell != cellEnd; ++cell)
     {
+        if ( wgtDim == 1 )
+        {
+            // A cell refined into an LGR is weighted by its number of children.
+            int children = 0;
+            for (auto child = cell->hbegin(grid.maxLevel()), childEnd = cell->hend(grid.maxLevel());
+                 child != childEnd; ++child)
+            {
+                ++children;
+            }
+            objWgts[idx] = std::max(children, 1);
+        }
         gids[idx]   = globalIdSet.id(*cell);
         lids[idx++] = localIdSet.id(*cell);
     }
@@ -324,6 +324,11 @@ zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
     }
     setDefaultZoltanParameters(zz);
     Zoltan_Set_Param(zz, "IMBALANCE_TOL", std::to_string(zoltanImbalanceTol).c_str());
+    if (cpgrid.maxLevel() > 0)
+    {
+        // Cells refined into LGRs are weighted by their number of children.
+        Zoltan_Set_Param(zz, "OBJ_WEIGHT_DIM", "1");
+    }
     for (const auto& [key, value] : params)
         Zoltan_Set_Param(zz, key.c_str(), value.c_str());
 
@@ -521,6 +526,11 @@ private:
         else
             Zoltan_Set_Param(zz, "NUM_GLOBAL_PARTS", std::to_string(cc.size()).c_str());
 
+        if (cpgrid.maxLevel() > 0) {
+            // Cells refined into LGRs are weighted by their number of children.
+            Zoltan_Set_Param(zz, "OBJ_WEIGHT_DIM", "1");
+        }
+
         for (const auto& [key, value] : params)
             Zoltan_Set_Param(zz, key.c_str(), value.c_str());
 
@@ -42,6 +42,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "preprocess.h"
 #include "uniquepoints.h"
 #include "facetopology.h"
@@ -49,6 +53,9 @@
 #define MIN(i,j) ((i)<(j) ? (i) : (j))
 #define MAX(i,j) ((i)>(j) ? (i) : (j))
 
+/* Minimum number of cell rows per slab in threaded process_grdecl(). */
+#define MIN_SLAB_ROWS 8
+
 static void
 compute_cell_index(const int dims[3], int i, int j, int *neighbors, int len);
 
@@ -57,12 +64,14 @@ checkmemory(int nz, struct processed_grid *out, int **intersections);
 
 static void
 process_vertical_faces(int direction,
+                       int j_begin, int j_end,
                        int **intersections,
                        int *plist, int *work,
                        struct processed_grid *out);
 
 static void
-process_horizontal_faces(int **intersections,
+process_horizontal_faces(int j_begin, int j_end,
+                         int **intersections,
                          int *plist,
                          const int* is_aquifer_cell,
                          struct processed_grid *out,
@@ -215,9 +224,12 @@ checkmemory(int nz, struct processed_grid *out, int **intersections)
 
   direction == 0 : constant-i faces.
   direction == 1 : constant-j faces.
+
+  Only faces with j in [j_begin, j_end) are processed.
 */
 static void
 process_vertical_faces(int direction,
+                       int j_begin, int j_end,
                        int **intersections,
                        int *plist, int *work,
                        struct processed_grid *out)
@@ -242,7 +254,9 @@ process_vertical_faces(int direction,
     d[1] = 2 * (ny + 0);
     d[2] = 2 * (nz + 1);
 
-    for (j = 0; j < ny + direction; ++j) {
+    assert ((0 <= j_begin) && (j_end <= ny + direction));
+
+    for (j = j_begin; j < j_end; ++j) {
         for (i = 0; i < nx + (1 - direction); ++i) {
 
             if (! checkmemory(nz, out, intersections)) {
@@ -312,9 +326,11 @@ process_vertical_faces(int direction,
   cells that are have collapsed coordinates. (This includes cells with
   ACTNUM==0)
 
+  Only cell columns with j in [j_begin, j_end) are processed.
 */
 static void
-process_horizontal_faces(int **intersections,
+process_horizontal_faces(int j_begin, int j_end,
+                         int **intersections,
                          int *plist,
                          const int* is_aquifer_cell,
                          struct processed_grid *out,
@@ -339,7 +355,9 @@ process_horizontal_faces(int **intersections,
     d[2] = 2+2*nz;
 
 
-    for(j=0; j<ny; ++j) {
+    assert ((0 <= j_begin) && (j_end <= ny));
+
+    for(j=j_begin; j<j_end; ++j) {
         for (i=0; i<nx; ++i) {
 
 
@@ -524,9 +542,17 @@ compute_intersection_coordinates(int                   *intersections,
     int    k;
     double *pt;
     int    *itsct = intersections;
+    void   *p;
+
+    if (n == 0) {
+        /* No nodes at all, e.g., a slab of inactive cells.  Don't
+         * release the node array through realloc(ptr, 0). */
+        return;
+    }
+
     /* Make sure the space allocated for nodes match the number of
      * node. */
-    void *p = realloc (out->node_coordinates, 3*n*sizeof(double));
+    p = realloc (out->node_coordinates, 3*n*sizeof(double));
     if (p) {
         out->node_coordinates = p;
     }
@@ -1086,6 +1112,174 @@ reverse_face_nodes(struct processed_grid *out)
 }
 
 
+/* ---------------------------------------------------------------------- */
+/* Initialize output structure of the processing of a model with Cartesian
+ * dimensions "dims": allocate initial space for the grid topology (which
+ * may need to be increased) and set the Cartesian dimensions. */
+/* ---------------------------------------------------------------------- */
+static int
+allocate_processed_grid(const int              dims[3],
+                        const size_t           bignum,
+                        struct processed_grid *out)
+/* ---------------------------------------------------------------------- */
+{
+    const size_t nc = ((size_t) dims[0]) * ((size_t) dims[1]) * ((size_t) dims[2]);
+
+    out->m                = (int) (bignum / 3);
+    out->n                = (int) bignum;
+
+    out->face_neighbors   = malloc( bignum      * sizeof *out->face_neighbors);
+    out->face_nodes       = malloc( out->n      * sizeof *out->face_nodes);
+    out->face_ptr         = malloc((out->m + 1) * sizeof *out->face_ptr);
+    out->face_tag         = malloc( out->m      * sizeof *out->face_tag);
+
+    out->dimensions[0]    = dims[0];
+    out->dimensions[1]    = dims[1];
+    out->dimensions[2]    = dims[2];
+    out->number_of_faces  = 0;
+    out->number_of_nodes  = 0;
+    out->number_of_cells  = 0;
+
+    out->node_coordinates = NULL;
+    out->local_cell_index = malloc(nc * sizeof *out->local_cell_index);
+
+    if ((out->face_neighbors   == NULL) ||
+        (out->face_nodes       == NULL) ||
+        (out->face_ptr         == NULL) ||
+        (out->face_tag         == NULL) ||
+        (out->local_cell_index == NULL))
+    {
+        return 0;
+    }
+
+    out->face_ptr[0]      = 0;
+
+    return 1;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* Move the part of a processed window of cell rows that belongs to the
+ * slab [jb, je) (window-local row numbers) into "slab".  The window's node
+ * numbers are translated to slab node numbers and its cell numbers to
+ * Cartesian cell numbers of the whole model.  The arrays of "out" are
+ * reused in place, and ownership passes to "slab".
+ *
+ * @param[in,out] out Processed window.  Cell numbers in "face_neighbors"
+ *   are Cartesian cell numbers of the window and "local_cell_index" flags
+ *   the inactive cells by -1.
+ * @param[in] zptr First node on each of the window's pillars.
+ * @param[in] nint Number of intersection nodes of the I and J faces.
+ * @param[in] nfaces Number of I, J and K faces.
+ * @param[in] window_begin First cell row of the window in the model.
+ * @param[in,out] slab Slab whose dimensions and row range are set. */
+/* ---------------------------------------------------------------------- */
+static int
+extract_slab(struct processed_grid       *out,
+             const int                   *zptr,
+             const int                    nint[2],
+             const unsigned               nfaces[3],
+             const int                    window_begin,
+             struct processed_slab       *slab)
+/* ---------------------------------------------------------------------- */
+{
+    const int nx  = out->dimensions[0];
+    const int nyw = out->dimensions[1];
+    const int nz  = out->dimensions[2];
+    const int ny  = slab->dimensions[1];
+    const int jb  = slab->j_begin - window_begin;
+    const int je  = slab->j_end   - window_begin;
+    const int last = slab->j_end == ny;
+
+    const int np         = out->number_of_nodes_on_pillars;
+    const int own_begin  = zptr[(nx + 1)*jb];
+    const int own_end    = zptr[(nx + 1)*(je + last)];
+    const int halo_end   = last ? own_end : zptr[(nx + 1)*(je + 1)];
+    const int npo        = own_end  - own_begin;
+    const int nh         = halo_end - own_end;
+    const int nintersect = out->number_of_nodes - np;
+
+    const unsigned nf  = out->number_of_faces;
+    const unsigned nfn = out->face_ptr[nf];
+
+    unsigned f;
+    int      i, j, k, c, v, *cell;
+
+    slab->number_of_faces[0]         = nfaces[0];
+    slab->number_of_faces[1]         = nfaces[1];
+    slab->number_of_faces[2]         = nfaces[2];
+    slab->number_of_face_nodes[0]    = out->face_ptr[nfaces[0]];
+    slab->number_of_face_nodes[1]    = out->face_ptr[nfaces[0] + nfaces[1]] -
+                                       out->face_ptr[nfaces[0]];
+    slab->number_of_face_nodes[2]    = nfn - out->face_ptr[nfaces[0] + nfaces[1]];
+    slab->number_of_pillar_nodes     = npo;
+    slab->number_of_halo_nodes       = nh;
+    slab->number_of_intersections[0] = nint[0];
+    slab->number_of_intersections[1] = nint[1];
+
+    /* Slab node numbers: own pillar nodes, halo nodes, intersections. */
+    for (f = 0; f < nfn; ++f) {
+        v = out->face_nodes[f];
+
+        if (v >= np) {
+            v = npo + nh + (v - np);
+        }
+        else if ((own_begin <= v) && (v < halo_end)) {
+            v = v - own_begin;
+        }
+        else {
+            /* Face refers to a pillar outside the slab. */
+            return 0;
+        }
+
+        out->face_nodes[f] = v;
+    }
+
+    /* Window-local Cartesian cell numbers to those of the model. */
+    for (f = 0; f < 2*nf; ++f) {
+        c = out->face_neighbors[f];
+
+        if (c != -1) {
+            i = c % nx;  c /= nx;
+            j = c % nyw;
+            k = c / nyw;
+
+            out->face_neighbors[f] = i + nx*(j + window_begin + ny*k);
+        }
+    }
+
+    memmove(out->node_coordinates,
+            out->node_coordinates + ((size_t) 3)*own_begin,
+            ((size_t) 3) * npo * sizeof *out->node_coordinates);
+    memmove(out->node_coordinates + ((size_t) 3)*npo,
+            out->node_coordinates + ((size_t) 3)*np,
+            ((size_t) 3) * nintersect * sizeof *out->node_coordinates);
+
+    /* Active cells in increasing Cartesian order, compressed in place:
+     * no entry is overwritten before it has been read. */
+    cell = out->local_cell_index;
+    for (k = 0; k < nz; ++k) {
+        for (j = jb; j < je; ++j) {
+            for (i = 0; i < nx; ++i) {
+                if (out->local_cell_index[linearindex(out->dimensions, i, j, k)] != -1) {
+                    *cell++ = i + nx*(j + window_begin + ny*k);
+                }
+            }
+        }
+    }
+    slab->number_of_cells = (int) (cell - out->local_cell_index);
+
+    /* Hand over the arrays. */
+    slab->face_nodes       = out->face_nodes;        out->face_nodes       = NULL;
+    slab->face_ptr         = out->face_ptr;          out->face_ptr         = NULL;
+    slab->face_neighbors   = out->face_neighbors;    out->face_neighbors   = NULL;
+    slab->node_coordinates = out->node_coordinates;  out->node_coordinates = NULL;
+    slab->active_cells     = out->local_cell_index;  out->local_cell_index = NULL;
+
+    return 1;
+}
+
+
 /* ----------------------------------------------------------------------
  * Public interface
  * ---------------------------------------------------------------------- */
@@ -1094,6 +1288,29 @@ int process_grdecl(const struct grdecl   *in,
                    const int             *is_aquifer_cell,
                    struct processed_grid *out,
                    int                    pinchActive)
+{
+#ifdef _OPENMP
+    /* Each slab also processes the halo rows on either side, so don't
+     * split the model into too thin slabs. */
+    const int nslabs = MIN(omp_get_max_threads(), in->dims[1] / MIN_SLAB_ROWS);
+
+    if ((nslabs > 1) && !omp_in_parallel()) {
+        return process_grdecl_slabs(in, tolerance, is_aquifer_cell,
+                                    nslabs, out, pinchActive);
+    }
+#endif
+
+    return process_grdecl_serial(in, tolerance, is_aquifer_cell,
+                                 out, pinchActive);
+}
+
+/* ---------------------------------------------------------------------- */
+int process_grdecl_serial(const struct grdecl   *in,
+                          double                 tolerance,
+                          const int             *is_aquifer_cell,
+                          struct processed_grid *out,
+                          int                    pinchActive)
+/* ---------------------------------------------------------------------- */
 {
     struct grdecl g = {0};
 
@@ -1133,31 +1350,7 @@ int process_grdecl(const struct grdecl   *in,
           increased)
        2) set Cartesian imensions
     */
-    out->m                = (int) (BIGNUM / 3);
-    out->n                = (int) BIGNUM;
-
-    out->face_neighbors   = malloc( BIGNUM      * sizeof *out->face_neighbors);
-    out->face_nodes       = malloc( out->n      * sizeof *out->face_nodes);
-    out->face_ptr         = malloc((out->m + 1) * sizeof *out->face_ptr);
-    out->face_tag         = malloc( out->m      * sizeof *out->face_tag);
-    out->face_ptr[0]      = 0;
-
-    out->dimensions[0]    = in->dims[0];
-    out->dimensions[1]    = in->dims[1];
-    out->dimensions[2]    = in->dims[2];
-    out->number_of_faces  = 0;
-    out->number_of_nodes  = 0;
-    out->number_of_cells  = 0;
-
-    out->node_coordinates = NULL;
-    out->local_cell_index = malloc(nc * sizeof *out->local_cell_index);
-
-    if ((out->face_neighbors   == NULL) ||
-        (out->face_nodes       == NULL) ||
-        (out->face_ptr         == NULL) ||
-        (out->face_tag         == NULL) ||
-        (out->local_cell_index == NULL))
-    {
+    if (! allocate_processed_grid(in->dims, BIGNUM, out)) {
         return 0;
     }
 
@@ -1236,9 +1429,9 @@ int process_grdecl(const struct grdecl   *in,
         return 0;
     }
 
-    process_vertical_faces   (0, &intersections, plist, work, out);
-    process_vertical_faces   (1, &intersections, plist, work, out);
-    process_horizontal_faces (   &intersections, plist, is_aquifer_cell, out, pinchActive);
+    process_vertical_faces   (0, 0, ny    , &intersections, plist, work, out);
+    process_vertical_faces   (1, 0, ny + 1, &intersections, plist, work, out);
+    process_horizontal_faces (   0, ny    , &intersections, plist, is_aquifer_cell, out, pinchActive);
 
     free(work);   work  = NULL;
     free(plist);  plist = NULL;
@@ -1309,6 +1502,566 @@ int process_grdecl(const struct grdecl   *in,
     return 1;
 }
 
+/* ---------------------------------------------------------------------- */
+int process_grdecl_orientation(const struct grdecl *in,
+                               int                 *sign,
+                               int                 *left_handed)
+/* ---------------------------------------------------------------------- */
+{
+    int error;
+    enum CoordinateSystemType coord_sys_type;
+
+    *sign = get_zcorn_sign(in->dims[0], in->dims[1], in->dims[2],
+                           in->actnum, in->zcorn, &error);
+    coord_sys_type = grid_coordinate_system_type(in, *sign);
+
+    *left_handed = coord_sys_type == LeftHanded;
+
+    return (! error) && (coord_sys_type != Inconclusive);
+}
+
+/* ---------------------------------------------------------------------- */
+void grdecl_slab_window(int ny, int j_begin, int j_end,
+                        int *window_begin, int *window_end)
+/* ---------------------------------------------------------------------- */
+{
+    *window_begin = MAX(j_begin - 1, 0 );
+    *window_end   = MIN(j_end   + 1, ny);
+}
+
+/* ---------------------------------------------------------------------- */
+void extract_grdecl_window(const struct grdecl *g,
+                           const int           *is_aquifer_cell,
+                           int                  window_begin,
+                           int                  window_end,
+                           struct grdecl       *window,
+                           double              *zcorn,
+                           int                 *actnum,
+                           int                 *window_aquifer)
+/* ---------------------------------------------------------------------- */
+{
+    const size_t nx  = g->dims[0];
+    const size_t ny  = g->dims[1];
+    const size_t nz  = g->dims[2];
+    const size_t j0  = window_begin;
+    const size_t nyw = window_end - window_begin;
+    size_t k;
+
+    window->dims[0] = g->dims[0];
+    window->dims[1] = (int) nyw;
+    window->dims[2] = g->dims[2];
+
+    /* Pillar rows j0, ..., j0 + nyw are stored contiguously. */
+    window->coord = g->coord + 6*(nx + 1)*j0;
+
+    for (k = 0; k < 2*nz; ++k) {
+        memcpy(zcorn + (2*nx)*(2*nyw)*k,
+               g->zcorn + (2*nx)*(2*j0 + (2*ny)*k),
+               (2*nx)*(2*nyw) * sizeof *zcorn);
+    }
+    window->zcorn = zcorn;
+
+    if (g->actnum != NULL) {
+        for (k = 0; k < nz; ++k) {
+            memcpy(actnum + nx*nyw*k, g->actnum + nx*(j0 + ny*k),
+                   nx*nyw * sizeof *actnum);
+        }
+        window->actnum = actnum;
+    }
+    else {
+        window->actnum = NULL;
+    }
+
+    if (is_aquifer_cell != NULL) {
+        for (k = 0; k < nz; ++k) {
+            memcpy(window_aquifer + nx*nyw*k, is_aquifer_cell + nx*(j0 + ny*k),
+                   nx*nyw * sizeof *window_aquifer);
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+int process_grdecl_slab(const struct grdecl   *in,
+                        int                    window_begin,
+                        int                    j_begin,
+                        int                    j_end,
+                        int                    ny,
+                        int                    sign,
+                        int                    left_handed,
+                        double                 tolerance,
+                        const int             *is_aquifer_cell,
+                        struct processed_slab *slab,
+                        int                    pinchActive)
+/* ---------------------------------------------------------------------- */
+{
+    struct grdecl         g = {0};
+    struct processed_grid out;
+
+    size_t   i;
+    int      ok, nint[2];
+    unsigned nfaces[3];
+
+    const size_t BIGNUM = 64;
+    const int    nx  = in->dims[0];
+    const int    nyw = in->dims[1];
+    const int    nz  = in->dims[2];
+    const size_t nc  = ((size_t) nx) * ((size_t) nyw) * ((size_t) nz);
+    const int    jb  = j_begin - window_begin;
+    const int    je  = j_end   - window_begin;
+    const int    last = j_end == ny;
+
+    int    *actnum, *plist, *zptr, *work, *intersections;
+    double *zcorn;
+
+    memset(slab, 0, sizeof *slab);
+    slab->dimensions[0] = nx;
+    slab->dimensions[1] = ny;
+    slab->dimensions[2] = nz;
+    slab->j_begin       = j_begin;
+    slab->j_end         = j_end;
+
+    assert ((0 <= jb) && (jb <= je) && (je <= nyw));
+
+    memset(&out, 0, sizeof out);
+    ok = allocate_processed_grid(in->dims, BIGNUM, &out);
+
+    actnum        = malloc(nc * sizeof *actnum);
+    zcorn         = malloc(nc * 8 * sizeof *zcorn);
+    plist         = malloc(8 * (nc + ((size_t)nx)*((size_t)nyw)) * sizeof *plist);
+    zptr          = malloc((((size_t)(nx + 1))*((size_t)(nyw + 1)) + 1) * sizeof *zptr);
+    work          = malloc(2 * ((size_t) (2*nz + 2)) * sizeof *work);
+    intersections = malloc(BIGNUM* sizeof(*intersections));
+
+    ok = ok && (actnum != NULL) && (zcorn != NULL) && (plist != NULL) &&
+        (zptr != NULL) && (work != NULL) && (intersections != NULL);
+
+    if (ok) {
+        /* Same sequence of operations as in process_grdecl(), restricted
+         * to the faces and cells of the slab. */
+        g.dims[0] = nx;
+        g.dims[1] = nyw;
+        g.dims[2] = nz;
+        g.actnum  = copy_and_permute_actnum(nx, nyw, nz, in->actnum, actnum);
+        g.zcorn   = copy_and_permute_zcorn (nx, nyw, nz, in->zcorn, sign, zcorn);
+        g.coord   = in->coord;
+
+        ok = finduniquepoints_offsets(&g, plist, tolerance, zptr, &out);
+    }
+
+    free(zcorn);  zcorn  = NULL;
+    free(actnum); actnum = NULL;
+
+    if (ok) {
+        if (left_handed) {
+            for (i = 1; i < ((size_t) 3) * out.number_of_nodes; i += 3) {
+                out.node_coordinates[i] = -out.node_coordinates[i];
+            }
+        }
+
+        for (i = 0; i < ((size_t)4) * (nz + 1); ++i) { work[i] = -1; }
+
+        process_vertical_faces   (0, jb, je       , &intersections, plist, work, &out);
+        nfaces[0] = out.number_of_faces;
+        nint  [0] = out.number_of_nodes - out.number_of_nodes_on_pillars;
+
+        process_vertical_faces   (1, jb, je + last, &intersections, plist, work, &out);
+        nfaces[1] = out.number_of_faces - nfaces[0];
+        nint  [1] = out.number_of_nodes - out.number_of_nodes_on_pillars - nint[0];
+
+        process_horizontal_faces (   jb, je       , &intersections, plist, is_aquifer_cell, &out, pinchActive);
+        nfaces[2] = out.number_of_faces - nfaces[0] - nfaces[1];
+
+        free(work);   work  = NULL;
+        free(plist);  plist = NULL;
+
+        compute_intersection_coordinates(intersections, &out);
+
+        if (left_handed) {
+            for (i = 1; i < ((size_t) 3) * out.number_of_nodes; i += 3) {
+                out.node_coordinates[i] = -out.node_coordinates[i];
+            }
+        }
+
+        if (sign == -1) {
+            for (i = 2; i < ((size_t) 3) * out.number_of_nodes; i += 3) {
+                out.node_coordinates[i] *= sign;
+            }
+        }
+
+        if (left_handed ^ (sign == -1)) {
+            reverse_face_nodes(&out);
+        }
+
+        ok = extract_slab(&out, zptr, nint, nfaces, window_begin, slab);
+    }
+
+    free(intersections);
+    free(work);
+    free(zptr);
+    free(plist);
+    free_processed_grid(&out);
+
+    if (! ok) {
+        free_processed_slab(slab);
+    }
+
+    return ok;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Copy the faces of type "t" (I, J or K) of "slab" to positions "f" and
+ * "pos" of the face and face-node arrays of "out", translating slab node
+ * numbers to global node numbers. */
+/* ---------------------------------------------------------------------- */
+static void
+merge_slab_faces(const struct processed_slab *slab,
+                 int                          t,
+                 size_t                       f,
+                 size_t                       pos,
+                 int                          pillar_start,
+                 int                          halo_start,
+                 int                          isect_start_i,
+                 int                          isect_start_j,
+                 struct processed_grid       *out)
+/* ---------------------------------------------------------------------- */
+{
+    const int npo = slab->number_of_pillar_nodes;
+    const int nh  = slab->number_of_halo_nodes;
+    const int ni  = slab->number_of_intersections[0];
+
+    size_t   i, first, last;
+    unsigned k;
+    int      v;
+
+    first = 0;
+    for (k = 0; k < (unsigned) t; ++k) {
+        first += slab->number_of_faces[k];
+    }
+    last = first + slab->number_of_faces[t];
+
+    for (i = first; i < last; ++i, ++f) {
+        for (k = slab->face_ptr[i]; k < slab->face_ptr[i + 1]; ++k) {
+            v = slab->face_nodes[k];
+
+            if (v < npo) {
+                v = pillar_start + v;
+            }
+            else if (v < npo + nh) {
+                v = halo_start + (v - npo);
+            }
+            else if (v < npo + nh + ni) {
+                v = isect_start_i + (v - npo - nh);
+            }
+            else {
+                v = isect_start_j + (v - npo - nh - ni);
+            }
+
+            out->face_nodes[pos++] = v;
+        }
+        out->face_ptr[f + 1] = (unsigned) pos;
+        out->face_tag[f]     = (t == 0) ? I_FACE : ((t == 1) ? J_FACE : K_FACE);
+
+        out->face_neighbors[2*f + 0] = slab->face_neighbors[2*i + 0];
+        out->face_neighbors[2*f + 1] = slab->face_neighbors[2*i + 1];
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+int begin_slab_merge(int                          nslabs,
+                     const struct processed_slab *slabs,
+                     struct slab_merge           *m,
+                     struct processed_grid       *out)
+/* ---------------------------------------------------------------------- */
+{
+    const int    nx = slabs[0].dimensions[0];
+    const int    ny = slabs[0].dimensions[1];
+    const int    nz = slabs[0].dimensions[2];
+    const size_t nc = ((size_t) nx) * ((size_t) ny) * ((size_t) nz);
+
+    int    s, t, ts;
+    size_t i, nf, nfn, nnodes, ncells;
+
+    memset(m, 0, sizeof *m);
+    m->nslabs = nslabs;
+
+    /* Slabs must cover the cell rows consecutively, and only the last
+     * slab is without halo nodes. */
+    if ((slabs[0].j_begin != 0) || (slabs[nslabs - 1].j_end != ny) ||
+        (slabs[nslabs - 1].number_of_halo_nodes != 0)) {
+        return 0;
+    }
+    for (s = 1; s < nslabs; ++s) {
+        if (slabs[s].j_begin != slabs[s - 1].j_end) {
+            return 0;
+        }
+    }
+
+    m->pillar_start = malloc(3 * ((size_t) nslabs + 1) * sizeof *m->pillar_start);
+    m->face_start   = malloc(2 * (3 * ((size_t) nslabs) + 1) * sizeof *m->face_start);
+    m->cell         = malloc(nc * sizeof *m->cell);
+    if ((m->pillar_start == NULL) || (m->face_start == NULL) || (m->cell == NULL)) {
+        end_slab_merge(m, NULL);
+        return 0;
+    }
+    m->isect_start[0] = m->pillar_start   + (nslabs + 1);
+    m->isect_start[1] = m->isect_start[0] + (nslabs + 1);
+    m->pos_start      = m->face_start     + (3*nslabs + 1);
+
+    /* Node numbering: all pillar nodes by pillar, then the intersections
+     * of the I faces, then the intersections of the J faces. */
+    m->pillar_start[0] = 0;
+    ncells = 0;
+    for (s = 0; s < nslabs; ++s) {
+        m->pillar_start[s + 1] = m->pillar_start[s] + slabs[s].number_of_pillar_nodes;
+        ncells += slabs[s].number_of_cells;
+    }
+    m->isect_start[0][0] = m->pillar_start[nslabs];
+    for (s = 0; s < nslabs; ++s) {
+        m->isect_start[0][s + 1] = m->isect_start[0][s] + slabs[s].number_of_intersections[0];
+    }
+    m->isect_start[1][0] = m->isect_start[0][nslabs];
+    for (s = 0; s < nslabs; ++s) {
+        m->isect_start[1][s + 1] = m->isect_start[1][s] + slabs[s].number_of_intersections[1];
+    }
+    nnodes = m->isect_start[1][nslabs];
+
+    /* Face numbering: all I faces, then all J faces, then all K faces,
+     * each in slab order.  Block ts = t*nslabs + s starts at face
+     * face_start[ts] and at face-node position pos_start[ts]. */
+    m->face_start[0] = m->pos_start[0] = 0;
+    for (t = 0; t < 3; ++t) {
+        for (s = 0; s < nslabs; ++s) {
+            ts = t*nslabs + s;
+            m->face_start[ts + 1] = m->face_start[ts] + slabs[s].number_of_faces[t];
+            m->pos_start [ts + 1] = m->pos_start [ts] + slabs[s].number_of_face_nodes[t];
+        }
+    }
+    nf  = m->face_start[3*nslabs];
+    nfn = m->pos_start [3*nslabs];
+
+    out->m                = (int) nf;
+    out->n                = (int) nfn;
+    out->dimensions[0]    = nx;
+    out->dimensions[1]    = ny;
+    out->dimensions[2]    = nz;
+    out->number_of_faces  = (unsigned) nf;
+    out->number_of_nodes  = (int) nnodes;
+    out->number_of_nodes_on_pillars = m->pillar_start[nslabs];
+    out->number_of_cells  = (int) ncells;
+
+    out->face_nodes       = malloc(nfn      * sizeof *out->face_nodes);
+    out->face_ptr         = malloc((nf + 1) * sizeof *out->face_ptr);
+    out->face_neighbors   = malloc(2 * nf   * sizeof *out->face_neighbors);
+    out->face_tag         = malloc(nf       * sizeof *out->face_tag);
+    out->node_coordinates = malloc(3 * nnodes * sizeof *out->node_coordinates);
+    out->local_cell_index = malloc(ncells   * sizeof *out->local_cell_index);
+
+    if ((out->face_nodes       == NULL) ||
+        (out->face_ptr         == NULL) ||
+        (out->face_neighbors   == NULL) ||
+        (out->face_tag         == NULL) ||
+        (out->node_coordinates == NULL) ||
+        (out->local_cell_index == NULL))
+    {
+        end_slab_merge(m, NULL);
+        return 0;
+    }
+
+    out->face_ptr[0] = 0;
+    for (i = 0; i < nc; ++i) { m->cell[i] = -1; }
+
+    return 1;
+}
+
+/* ---------------------------------------------------------------------- */
+void merge_slab(const struct slab_merge     *m,
+                int                          s,
+                const struct processed_slab *slab,
+                struct processed_grid       *out)
+/* ---------------------------------------------------------------------- */
+{
+    const int    nslabs = m->nslabs;
+    const size_t npo    = slab->number_of_pillar_nodes;
+    const size_t ni     = slab->number_of_intersections[0];
+
+    int t, c;
+
+    /* The blocks of faces and nodes of different slabs are disjoint. */
+    for (t = 0; t < 3; ++t) {
+        merge_slab_faces(slab, t, m->face_start[t*nslabs + s], m->pos_start[t*nslabs + s],
+                         m->pillar_start[s], m->pillar_start[s + 1],
+                         m->isect_start[0][s], m->isect_start[1][s], out);
+    }
+
+    memcpy(out->node_coordinates + 3*((size_t) m->pillar_start[s]),
+           slab->node_coordinates,
+           3 * npo * sizeof *out->node_coordinates);
+    memcpy(out->node_coordinates + 3*((size_t) m->isect_start[0][s]),
+           slab->node_coordinates + 3*npo,
+           3 * ni * sizeof *out->node_coordinates);
+    memcpy(out->node_coordinates + 3*((size_t) m->isect_start[1][s]),
+           slab->node_coordinates + 3*(npo + ni),
+           3 * ((size_t) slab->number_of_intersections[1]) * sizeof *out->node_coordinates);
+
+    for (c = 0; c < slab->number_of_cells; ++c) {
+        m->cell[slab->active_cells[c]] = 0;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+int end_slab_merge(struct slab_merge     *m,
+                   struct processed_grid *out)
+/* ---------------------------------------------------------------------- */
+{
+    size_t i, nc, nf;
+    int    cellnum;
+
+    if (out != NULL) {
+        /* Enumerate compressed cells lexicographically and remap
+         * out->face_neighbors */
+        nc = ((size_t) out->dimensions[0]) * ((size_t) out->dimensions[1]) *
+             ((size_t) out->dimensions[2]);
+        nf = out->number_of_faces;
+
+        cellnum = 0;
+        for (i = 0; i < nc; ++i) {
+            if (m->cell[i] != -1) {
+                out->local_cell_index[cellnum] = (int) i;
+                m->cell[i] = cellnum++;
+            }
+        }
+        for (i = 0; i < 2 * nf; ++i) {
+            if (out->face_neighbors[i] != -1) {
+                out->face_neighbors[i] = m->cell[out->face_neighbors[i]];
+            }
+        }
+    }
+
+    free(m->cell);
+    free(m->face_start);
+    free(m->pillar_start);
+    memset(m, 0, sizeof *m);
+
+    return 1;
+}
+
+/* ---------------------------------------------------------------------- */
+int merge_processed_slabs(int                          nslabs,
+                          const struct processed_slab *slabs,
+                          struct processed_grid       *out)
+/* ---------------------------------------------------------------------- */
+{
+    struct slab_merge m;
+    int s;
+
+    if (! begin_slab_merge(nslabs, slabs, &m, out)) {
+        return 0;
+    }
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (s = 0; s < nslabs; ++s) {
+        merge_slab(&m, s, &slabs[s], out);
+    }
+
+    return end_slab_merge(&m, out);
+}
+
+/* ---------------------------------------------------------------------- */
+int process_grdecl_slabs(const struct grdecl   *in,
+                         double                 tolerance,
+                         const int             *is_aquifer_cell,
+                         int                    nslabs,
+                         struct processed_grid *out,
+                         int                    pinchActive)
+/* ---------------------------------------------------------------------- */
+{
+    struct processed_slab *slabs;
+
+    int s, ok, sign, left_handed;
+
+    const int nx = in->dims[0];
+    const int ny = in->dims[1];
+    const int nz = in->dims[2];
+
+    if (! process_grdecl_orientation(in, &sign, &left_handed)) {
+        return 0;
+    }
+
+    nslabs = MAX(1, MIN(nslabs, ny));
+    slabs  = calloc(nslabs, sizeof *slabs);
+    if (slabs == NULL) {
+        return 0;
+    }
+
+    /* The slabs are independent of each other. */
+    ok = 1;
+#pragma omp parallel for schedule(dynamic, 1) reduction(&&:ok)
+    for (s = 0; s < nslabs; ++s) {
+        const int j_begin = (int) ((((size_t) ny) * s      ) / nslabs);
+        const int j_end   = (int) ((((size_t) ny) * (s + 1)) / nslabs);
+
+        struct grdecl window;
+        int     window_begin, window_end, slab_ok;
+        int    *actnum, *aquifer;
+        double *zcorn;
+        size_t  nwc;
+
+        grdecl_slab_window(ny, j_begin, j_end, &window_begin, &window_end);
+        nwc = ((size_t) nx) * ((size_t) (window_end - window_begin)) * ((size_t) nz);
+
+        zcorn   = malloc(8 * nwc * sizeof *zcorn);
+        actnum  = malloc(    nwc * sizeof *actnum);
+        aquifer = malloc(    nwc * sizeof *aquifer);
+
+        slab_ok = (zcorn != NULL) && (actnum != NULL) && (aquifer != NULL);
+        if (slab_ok) {
+            extract_grdecl_window(in, is_aquifer_cell, window_begin, window_end,
+                                  &window, zcorn, actnum, aquifer);
+
+            slab_ok = process_grdecl_slab(&window, window_begin, j_begin, j_end, ny,
+                                          sign, left_handed, tolerance,
+                                          (is_aquifer_cell != NULL) ? aquifer : NULL,
+                                          &slabs[s], pinchActive);
+        }
+
+        free(aquifer);
+        free(actnum);
+        free(zcorn);
+
+        ok = ok && slab_ok;
+    }
+
+    if (ok) {
+        ok = merge_processed_slabs(nslabs, slabs, out);
+    }
+
+    for (s = 0; s < nslabs; ++s) {
+        free_processed_slab(&slabs[s]);
+    }
+    free(slabs);
+
+    return ok;
+}
+
+/* ---------------------------------------------------------------------- */
+void free_processed_slab(struct processed_slab *s)
+/* ---------------------------------------------------------------------- */
+{
+    if (s) {
+        free(s->face_nodes      );
+        free(s->face_ptr        );
+        free(s->face_neighbors  );
+        free(s->node_coordinates);
+        free(s->active_cells    );
+
+        s->face_nodes       = NULL;
+        s->face_ptr         = NULL;
+        s->face_neighbors   = NULL;
+        s->node_coordinates = NULL;
+        s->active_cells     = NULL;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 void free_processed_grid(struct processed_grid *g)
 /* ---------------------------------------------------------------------- */
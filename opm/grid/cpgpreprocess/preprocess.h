@@ -107,6 +107,49 @@ extern "C" {
     };
 
 
+    /**
+     * Partial result of processing the cell rows j_begin <= j < j_end of a
+     * corner-point model, see process_grdecl_slab().  Node numbers in
+     * "face_nodes" are local to the slab: the slab's own pillar nodes come
+     * first, followed by the nodes on the first pillar row of the next slab
+     * (halo nodes), the intersection nodes of the I faces and finally the
+     * intersection nodes of the J faces.  Function merge_processed_slabs()
+     * turns a complete set of slabs into the result of process_grdecl().
+     */
+    struct processed_slab {
+        int      dimensions[3];     /**< Cartesian box dimensions of the
+                                         whole model. */
+        int      j_begin;           /**< First cell row of the slab. */
+        int      j_end;             /**< One past the last cell row. */
+
+        unsigned number_of_faces[3]; /**< Number of I, J and K faces.  The
+                                          faces are stored in that order. */
+        unsigned number_of_face_nodes[3]; /**< Length of the `face_nodes'
+                                               of the I, J and K faces. */
+        int     *face_nodes;        /**< Slab node numbers of each face,
+                                         stored sequentially. */
+        unsigned int *face_ptr;     /**< Start position for each face's
+                                         `face_nodes'. */
+        int     *face_neighbors;    /**< Cartesian (uncompressed) cell
+                                         numbers.  Two elements per face,
+                                         -1 outside the model. */
+
+        int      number_of_pillar_nodes; /**< Unique vertices on the pillar
+                                              rows owned by the slab. */
+        int      number_of_halo_nodes;   /**< Unique vertices on the first
+                                              pillar row of the next slab. */
+        int      number_of_intersections[2]; /**< Fault intersection
+                                                  vertices on I and J faces. */
+        double  *node_coordinates;  /**< Coordinates of the slab's own pillar
+                                         nodes followed by its intersection
+                                         nodes.  Halo nodes are excluded. */
+
+        int      number_of_cells;   /**< Number of active cells. */
+        int     *active_cells;      /**< Increasing Cartesian indices of the
+                                         active cells of the slab. */
+    };
+
+
     /**
      * Construct a prototypical grid representation from a corner-point
      * specification.
@@ -128,6 +171,11 @@ extern "C" {
      * @param[in] pinchActive Whether cells with zero volume should be pinched out
      *                    and neighboring cells should be connected.
      *
+     * When built with OpenMP support and more than one thread is available,
+     * slabs of cell rows are processed concurrently, see
+     * process_grdecl_slabs().  The result is identical to that of
+     * process_grdecl_serial().
+     *
      * @return One (1, true) if grid successfully generated, zero (0, false)
      * otherwise.
      */
@@ -137,6 +185,187 @@ extern "C" {
                        struct processed_grid *out,
                        int                    pinchActive);
 
+    /**
+     * As process_grdecl(), but always processes the whole model on the
+     * calling thread.
+     */
+    int process_grdecl_serial(const struct grdecl   *g,
+                              double                 tol,
+                              const int             *is_aquifer_cell,
+                              struct processed_grid *out,
+                              int                    pinchActive);
+
+    /**
+     * Determine the ZCORN orientation and the handedness of the coordinate
+     * system of a corner-point specification.  These are global properties
+     * of the model which process_grdecl_slab() needs as input.
+     *
+     * @param[in]  g           Corner-point specification.
+     * @param[out] sign        One (1) if ZCORN is nondecreasing along the
+     *                         pillars, minus one (-1) if it is nonincreasing.
+     * @param[out] left_handed One (1, true) if the model is specified in a
+     *                         left-handed coordinate system.
+     *
+     * @return One (1, true) if the orientation could be established, zero
+     * (0, false) otherwise.  process_grdecl() fails in the latter case.
+     */
+    int process_grdecl_orientation(const struct grdecl *g,
+                                   int                 *sign,
+                                   int                 *left_handed);
+
+    /**
+     * Compute the range of cell rows [*window_begin, *window_end) needed to
+     * process the slab of cell rows [j_begin, j_end) of a model with "ny"
+     * cell rows.  The window contains one row of halo cells on either side
+     * of the slab, where present.
+     */
+    void grdecl_slab_window(int ny, int j_begin, int j_end,
+                            int *window_begin, int *window_end);
+
+    /**
+     * Extract the cell rows [window_begin, window_end) of a corner-point
+     * specification into a specification of its own.
+     *
+     * The window's "coord" points into the coordinates of "g".  The
+     * window's ZCORN values are copied to "zcorn", which must hold
+     * 8*nx*(window_end - window_begin)*nz values.  If "g" has an explicit
+     * "active" map, it is copied to "actnum" which must hold
+     * nx*(window_end - window_begin)*nz values.  Likewise, if
+     * "is_aquifer_cell" is not NULL it is copied to "window_aquifer".
+     */
+    void extract_grdecl_window(const struct grdecl *g,
+                               const int           *is_aquifer_cell,
+                               int                  window_begin,
+                               int                  window_end,
+                               struct grdecl       *window,
+                               double              *zcorn,
+                               int                 *actnum,
+                               int                 *window_aquifer);
+
+    /**
+     * Process the cell rows [j_begin, j_end) of a corner-point model.
+     *
+     * @param[in]  window      Corner-point specification of the cell rows
+     *                         returned by grdecl_slab_window().
+     * @param[in]  window_begin First cell row of the window in the model.
+     * @param[in]  j_begin     First cell row of the slab.
+     * @param[in]  j_end       One past the last cell row of the slab.
+     * @param[in]  ny          Number of cell rows in the model.
+     * @param[in]  sign        ZCORN orientation of the whole model.
+     * @param[in]  left_handed Handedness of the whole model.
+     * @param[in]  tol         Absolute tolerance of node-coincidence.
+     * @param[in]  is_aquifer_cell Aquifer cell flags of the window.  May
+     *                         be NULL.
+     * @param[out] out         Partial grid representation of the slab.
+     * @param[in] pinchActive  As for process_grdecl().
+     *
+     * @return One (1, true) if the slab was successfully processed, zero (0,
+     * false) otherwise.
+     */
+    int process_grdecl_slab(const struct grdecl    *window,
+                            int                     window_begin,
+                            int                     j_begin,
+                            int                     j_end,
+                            int                     ny,
+                            int                     sign,
+                            int                     left_handed,
+                            double                  tol,
+                            const int              *is_aquifer_cell,
+                            struct processed_slab  *out,
+                            int                     pinchActive);
+
+    /**
+     * Assemble a complete grid representation from the partial results of
+     * consecutive slabs covering all cell rows of a model.  The result is
+     * identical to that of process_grdecl() applied to the whole model.
+     *
+     * @param[in]  nslabs Number of slabs.
+     * @param[in]  slabs  Slabs, ordered by increasing cell rows.
+     * @param[out] out    Minimal grid representation.  Release with
+     *                    free_processed_grid().
+     *
+     * @return One (1, true) if the grid was successfully assembled, zero (0,
+     * false) otherwise.
+     */
+    int merge_processed_slabs(int                          nslabs,
+                              const struct processed_slab *slabs,
+                              struct processed_grid       *out);
+
+    /**
+     * Positions of the faces and nodes of each slab in a grid representation
+     * assembled by begin_slab_merge(), merge_slab() and end_slab_merge().
+     */
+    struct slab_merge {
+        int     nslabs;          /**< Number of slabs. */
+        int    *pillar_start;    /**< First pillar node of each slab. */
+        int    *isect_start[2];  /**< First I and J face intersection node
+                                      of each slab. */
+        size_t *face_start;      /**< First face of each block of I, J and
+                                      K faces, by face type and slab. */
+        size_t *pos_start;       /**< Start of each block in `face_nodes'. */
+        int    *cell;            /**< Compressed cell of each Cartesian
+                                      cell, -1 if inactive. */
+    };
+
+    /**
+     * Allocate a grid representation for the slabs and compute where each
+     * slab goes.  Only the dimensions, row ranges and numbers of the slabs
+     * are read, such that the slabs may be merged one at a time as they
+     * become available.
+     *
+     * @param[in]  nslabs Number of slabs.
+     * @param[in]  slabs  Slabs, ordered by increasing cell rows.  Their
+     *                    arrays need not be set.
+     * @param[out] m      Merge layout.  Released by end_slab_merge().
+     * @param[out] out    Minimal grid representation.
+     *
+     * @return One (1, true) if the slabs are consistent and the memory
+     * could be allocated, zero (0, false) otherwise.
+     */
+    int begin_slab_merge(int                          nslabs,
+                         const struct processed_slab *slabs,
+                         struct slab_merge           *m,
+                         struct processed_grid       *out);
+
+    /**
+     * Copy slab number "s" into the grid representation.  The slab may be
+     * released afterwards.  Different slabs may be merged concurrently.
+     */
+    void merge_slab(const struct slab_merge     *m,
+                    int                          s,
+                    const struct processed_slab *slab,
+                    struct processed_grid       *out);
+
+    /**
+     * Enumerate the active cells once all slabs have been merged, and
+     * release the merge layout.  If "out" is NULL, the merge is abandoned
+     * and only the layout is released.
+     *
+     * @return One (1, true) on success, zero (0, false) otherwise.
+     */
+    int end_slab_merge(struct slab_merge     *m,
+                       struct processed_grid *out);
+
+    /**
+     * Construct a prototypical grid representation from a corner-point
+     * specification by processing it in "nslabs" slabs of cell rows and
+     * merging the results.  The slabs are processed concurrently when built
+     * with OpenMP support.  The result is identical to that of
+     * process_grdecl().
+     */
+    int process_grdecl_slabs(const struct grdecl   *g,
+                             double                 tol,
+                             const int             *is_aquifer_cell,
+                             int                    nslabs,
+                             struct processed_grid *out,
+                             int                    pinchActive);
+
+    /**
+     * Release memory resources acquired in previous slab processing using
+     * function process_grdecl_slab().
+     */
+    void free_processed_slab(struct processed_slab *s);
+
     /**
      * Release memory resources acquired in previous grid processing using
      * function process_grdecl().
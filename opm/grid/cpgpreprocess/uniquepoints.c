@@ -272,6 +272,35 @@ int finduniquepoints(const struct grdecl *g,
                      double tolerance,
                      struct processed_grid *out)
 
+{
+    const int npillars = (out->dimensions[0]+1)*(out->dimensions[1]+1);
+
+    int *zptr = malloc((npillars+1)*sizeof *zptr);
+    int  ok;
+
+    if (zptr == NULL) {
+        return 0;
+    }
+
+    ok = finduniquepoints_offsets(g, plist, tolerance, zptr, out);
+
+    free(zptr);
+
+    return ok;
+}
+
+/*-----------------------------------------------------------------
+  As finduniquepoints(), but also report the start of each pillar's
+  unique points in the node numbering.  Pillar p, numbered with i
+  running faster than j, owns nodes zptr[p], ..., zptr[p+1]-1. */
+int finduniquepoints_offsets(const struct grdecl *g,
+                             /* return values: */
+                             int           *plist, /* list of point numbers on
+                                                    * each pillar*/
+                             double tolerance,
+                             int           *zptr,  /* (nx+1)*(ny+1) + 1 */
+                             struct processed_grid *out)
+
 {
 
     const int nx = out->dimensions[0];
@@ -283,10 +312,8 @@ int finduniquepoints(const struct grdecl *g,
     /* zlist may need extra space temporarily due to simple boundary
      * treatement  */
     int            npillarpoints = 8*(nx+1)*(ny+1)*nz;
-    int            npillars      = (nx+1)*(ny+1);
 
     double *zlist = malloc(npillarpoints*sizeof *zlist);
-    int     *zptr = malloc((npillars+1)*sizeof *zptr);
 
 
 
@@ -372,7 +399,6 @@ int finduniquepoints(const struct grdecl *g,
         }
     }
 
-    free(zptr);
     free(zlist);
 
     return 1;
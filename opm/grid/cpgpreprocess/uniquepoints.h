@@ -40,6 +40,12 @@ int finduniquepoints(const struct grdecl *g,  /* input */
                      double               t,  /* tolerance*/
                      struct processed_grid *out);
 
+int finduniquepoints_offsets(const struct grdecl *g,  /* input */
+                             int                 *p,  /* for each z0 in zcorn, z0 = z[p0] */
+                             double               t,  /* tolerance*/
+                             int              *zptr,  /* first node on each pillar */
+                             struct processed_grid *out);
+
 #endif /* OPM_UNIQUEPOINTS_HEADER */
 
 /* Local Variables:    */
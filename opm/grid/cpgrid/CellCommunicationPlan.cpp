@@ -0,0 +1,134 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/cpgrid/CellCommunicationPlan.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+#if HAVE_MPI
+
+CellCommunicationPlan::CellCommunicationPlan(MPI_Comm comm, const InterfaceMap& interface,
+                                             std::size_t numCells)
+    : numCells_(numCells)
+{
+    MPI_Comm_dup(comm, &comm_);
+    neighbors_.reserve(interface.size());
+    for (const auto& [rank, lists] : interface) {
+        Neighbor neighbor;
+        neighbor.rank = rank;
+        neighbor.sourceCells.resize(lists.first.size());
+        for (std::size_t i = 0; i < lists.first.size(); ++i) {
+            neighbor.sourceCells[i] = lists.first[i];
+        }
+        neighbor.targetCells.resize(lists.second.size());
+        for (std::size_t i = 0; i < lists.second.size(); ++i) {
+            neighbor.targetCells[i] = lists.second[i];
+        }
+        if (!neighbor.sourceCells.empty() || !neighbor.targetCells.empty()) {
+            neighbors_.push_back(std::move(neighbor));
+        }
+    }
+    requests_.reserve(2 * neighbors_.size());
+}
+
+CellCommunicationPlan::~CellCommunicationPlan()
+{
+    MPI_Comm_free(&comm_);
+}
+
+void CellCommunicationPlan::exchange(double* data, std::size_t size, std::size_t blockSize,
+                                     CommunicationDirection dir)
+{
+    if (blockSize == 0 || size != numCells_ * blockSize) {
+        OPM_THROW(std::invalid_argument,
+                  "Exchanging " + std::to_string(size) + " values with block size "
+                  + std::to_string(blockSize) + " on a grid with "
+                  + std::to_string(numCells_) + " cells.");
+    }
+    const bool forward = dir == ForwardCommunication;
+    constexpr int tag = 0;
+    requests_.clear();
+
+    // Post all receives before sending.
+    for (auto& neighbor : neighbors_) {
+        const auto& recvCells = forward ? neighbor.targetCells : neighbor.sourceCells;
+        if (recvCells.empty()) {
+            continue;
+        }
+        neighbor.recvBuffer.resize(recvCells.size() * blockSize);
+        requests_.emplace_back();
+        MPI_Irecv(neighbor.recvBuffer.data(), neighbor.recvBuffer.size(), MPI_DOUBLE,
+                  neighbor.rank, tag, comm_, &requests_.back());
+    }
+    const std::size_t numRecvs = requests_.size();
+
+    for (auto& neighbor : neighbors_) {
+        const auto& sendCells = forward ? neighbor.sourceCells : neighbor.targetCells;
+        if (sendCells.empty()) {
+            continue;
+        }
+        neighbor.sendBuffer.resize(sendCells.size() * blockSize);
+        double* out = neighbor.sendBuffer.data();
+        for (int cell : sendCells) {
+            const double* in = data + cell * blockSize;
+            for (std::size_t k = 0; k < blockSize; ++k) {
+                *out++ = in[k];
+            }
+        }
+        requests_.emplace_back();
+        MPI_Isend(neighbor.sendBuffer.data(), neighbor.sendBuffer.size(), MPI_DOUBLE,
+                  neighbor.rank, tag, comm_, &requests_.back());
+    }
+
+    MPI_Waitall(numRecvs, requests_.data(), MPI_STATUSES_IGNORE);
+    for (const auto& neighbor : neighbors_) {
+        const auto& recvCells = forward ? neighbor.targetCells : neighbor.sourceCells;
+        const double* in = neighbor.recvBuffer.data();
+        for (int cell : recvCells) {
+            double* out = data + cell * blockSize;
+            for (std::size_t k = 0; k < blockSize; ++k) {
+                out[k] = *in++;
+            }
+        }
+    }
+    MPI_Waitall(requests_.size() - numRecvs, requests_.data() + numRecvs, MPI_STATUSES_IGNORE);
+}
+
+#else
+
+CellCommunicationPlan::~CellCommunicationPlan() = default;
+
+void CellCommunicationPlan::exchange(double*, std::size_t, std::size_t, CommunicationDirection)
+{}
+
+#endif // HAVE_MPI
+
+} // namespace cpgrid
+} // namespace Dune
@@ -0,0 +1,108 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_CELLCOMMUNICATIONPLAN_HEADER
+#define OPM_CELLCOMMUNICATIONPLAN_HEADER
+
+#include <dune/grid/common/gridenums.hh>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include "CpGridDataTraits.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Exchange of fixed size double data of cells along one interface.
+///
+/// The plan keeps the indices of the cells to send to and receive from each
+/// neighboring process, as well as the message buffers, between calls. An
+/// exchange packs the values of those cells contiguously and sends them
+/// directly, without going through a data handle entity by entity. This is
+/// meant for fields that are exchanged over and over again, e.g. in every
+/// Newton iteration.
+///
+/// The values of cell i are expected at data[i*blockSize, (i+1)*blockSize).
+class CellCommunicationPlan
+{
+public:
+    using InterfaceMap = CpGridDataTraits::InterfaceMap;
+
+#if HAVE_MPI
+    /// \brief Set up the plan.
+    ///
+    /// This is collective on comm, as the plan uses its own duplicate of it.
+    /// \param comm The communicator of the grid.
+    /// \param interface The interface to communicate along.
+    /// \param numCells The number of cells of the grid.
+    CellCommunicationPlan(MPI_Comm comm, const InterfaceMap& interface, std::size_t numCells);
+#else
+    CellCommunicationPlan() = default;
+#endif
+
+    CellCommunicationPlan(const CellCommunicationPlan&) = delete;
+    CellCommunicationPlan& operator=(const CellCommunicationPlan&) = delete;
+    ~CellCommunicationPlan();
+
+    /// \brief Exchange the values of the cells.
+    /// \param data Pointer to numCells*blockSize values.
+    /// \param size The number of values, must be numCells*blockSize.
+    /// \param blockSize The number of values per cell.
+    /// \param dir The direction of the communication along the interface.
+    void exchange(double* data, std::size_t size, std::size_t blockSize,
+                  CommunicationDirection dir = ForwardCommunication);
+
+    /// \brief Exchange the values of the cells.
+    void exchange(std::vector<double>& data, std::size_t blockSize,
+                  CommunicationDirection dir = ForwardCommunication)
+    {
+        exchange(data.data(), data.size(), blockSize, dir);
+    }
+
+private:
+#if HAVE_MPI
+    /// \brief Cells and buffers for one neighboring process.
+    struct Neighbor
+    {
+        int rank;
+        /// Cells of the first list of the interface, sent when communicating forward.
+        std::vector<int> sourceCells;
+        /// Cells of the second list of the interface, received when communicating forward.
+        std::vector<int> targetCells;
+        std::vector<double> sendBuffer;
+        std::vector<double> recvBuffer;
+    };
+
+    MPI_Comm comm_;
+    std::size_t numCells_;
+    std::vector<Neighbor> neighbors_;
+    std::vector<MPI_Request> requests_;
+#endif
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_CELLCOMMUNICATIONPLAN_HEADER
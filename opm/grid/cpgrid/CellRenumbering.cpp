@@ -0,0 +1,458 @@
+//===========================================================================
+//
+// File: CellRenumbering.cpp
+//
+// Created: October 2026
+//
+// $Date$
+//
+// $Revision$
+//
+//===========================================================================
+
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "CpGridData.hpp"
+#include "Geometry.hpp"
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/grid/cpgrid/Indexsets.hpp>
+#include <opm/grid/cpgrid/PartitionTypeIndicator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+
+/// Position of a point on the Hilbert curve through the cube with 2^bits
+/// points per direction (Skilling, "Programming the Hilbert curve", 2004).
+std::uint64_t hilbertKey(std::array<std::uint32_t, 3> x, int bits)
+{
+    const std::uint32_t m = 1u << (bits - 1);
+    // Inverse undo of the excess work
+    for (std::uint32_t q = m; q > 1; q >>= 1) {
+        const std::uint32_t p = q - 1;
+        for (int i = 0; i < 3; ++i) {
+            if (x[i] & q) {
+                x[0] ^= p;
+            } else {
+                const std::uint32_t t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+    // Gray encode
+    for (int i = 1; i < 3; ++i) {
+        x[i] ^= x[i - 1];
+    }
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1) {
+        if (x[2] & q) {
+            t ^= q - 1;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        x[i] ^= t;
+    }
+    // Interleave the transposed bits into one key.
+    std::uint64_t key = 0;
+    for (int b = bits - 1; b >= 0; --b) {
+        for (int i = 0; i < 3; ++i) {
+            key = (key << 1) | ((x[i] >> b) & 1u);
+        }
+    }
+    return key;
+}
+
+std::vector<int> hilbertOrder(const std::vector<FieldVector<double, 3>>& centroids)
+{
+    constexpr int bits = 21;
+    const int num_cells = centroids.size();
+    FieldVector<double, 3> lower(std::numeric_limits<double>::max());
+    FieldVector<double, 3> upper(std::numeric_limits<double>::lowest());
+    for (const auto& c : centroids) {
+        for (int d = 0; d < 3; ++d) {
+            lower[d] = std::min(lower[d], c[d]);
+            upper[d] = std::max(upper[d], c[d]);
+        }
+    }
+    // Scale all directions alike, such that the curve does not favour thin directions.
+    double extent = 0.0;
+    for (int d = 0; d < 3; ++d) {
+        extent = std::max(extent, upper[d] - lower[d]);
+    }
+    const double scale = extent > 0.0 ? ((1u << bits) - 1) / extent : 0.0;
+
+    std::vector<std::uint64_t> keys(num_cells);
+    for (int cell = 0; cell < num_cells; ++cell) {
+        std::array<std::uint32_t, 3> x;
+        for (int d = 0; d < 3; ++d) {
+            x[d] = static_cast<std::uint32_t>((centroids[cell][d] - lower[d]) * scale);
+        }
+        keys[cell] = hilbertKey(x, bits);
+    }
+    std::vector<int> order(num_cells);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](int a, int b) { return keys[a] < keys[b]; });
+    return order;
+}
+
+/// Reverse Cuthill-McKee order of a graph in CSR format, component by
+/// component, each started from a pseudo-peripheral vertex.
+std::vector<int> reverseCuthillMcKeeOrder(const std::vector<int>& offsets,
+                                          const std::vector<int>& neighbors)
+{
+    const int num_cells = offsets.size() - 1;
+    const auto degree = [&offsets](int cell) { return offsets[cell + 1] - offsets[cell]; };
+
+    std::vector<int> level(num_cells, -1);
+    std::vector<int> visit;
+    visit.reserve(num_cells);
+    // Breadth first search from start, returns the number of levels and
+    // leaves the visited cells in visit. Marks them in level, which the
+    // caller has to reset.
+    const auto bfs = [&](int start, const std::vector<char>& done) {
+        visit.clear();
+        visit.push_back(start);
+        level[start] = 0;
+        for (std::size_t i = 0; i < visit.size(); ++i) {
+            const int cell = visit[i];
+            for (int n = offsets[cell]; n < offsets[cell + 1]; ++n) {
+                const int neighbor = neighbors[n];
+                if (level[neighbor] < 0 && !done[neighbor]) {
+                    level[neighbor] = level[cell] + 1;
+                    visit.push_back(neighbor);
+                }
+            }
+        }
+        return level[visit.back()] + 1;
+    };
+    const auto resetLevels = [&]() {
+        for (int cell : visit) {
+            level[cell] = -1;
+        }
+    };
+
+    std::vector<int> candidates(num_cells);
+    std::iota(candidates.begin(), candidates.end(), 0);
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&degree](int a, int b) { return degree(a) < degree(b); });
+
+    std::vector<char> done(num_cells, false);
+    std::vector<int> order;
+    order.reserve(num_cells);
+    std::vector<int> sorted;
+    for (int candidate : candidates) {
+        if (done[candidate]) {
+            continue;
+        }
+        // Find a pseudo-peripheral start by moving to the lowest degree cell
+        // of the last level as long as the eccentricity grows.
+        int start = candidate;
+        int eccentricity = bfs(start, done);
+        for (;;) {
+            const int last_level = eccentricity - 1;
+            int next = start;
+            for (int cell : visit) {
+                if (level[cell] == last_level && (next == start || degree(cell) < degree(next))) {
+                    next = cell;
+                }
+            }
+            resetLevels();
+            if (next == start) {
+                break;
+            }
+            const int next_eccentricity = bfs(next, done);
+            if (next_eccentricity <= eccentricity) {
+                resetLevels();
+                break;
+            }
+            start = next;
+            eccentricity = next_eccentricity;
+        }
+
+        // Cuthill-McKee from start, neighbors by increasing degree.
+        const std::size_t first = order.size();
+        order.push_back(start);
+        done[start] = true;
+        for (std::size_t i = first; i < order.size(); ++i) {
+            const int cell = order[i];
+            sorted.clear();
+            for (int n = offsets[cell]; n < offsets[cell + 1]; ++n) {
+                if (!done[neighbors[n]]) {
+                    done[neighbors[n]] = true;
+                    sorted.push_back(neighbors[n]);
+                }
+            }
+            std::stable_sort(sorted.begin(), sorted.end(),
+                             [&degree](int a, int b) { return degree(a) < degree(b); });
+            order.insert(order.end(), sorted.begin(), sorted.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+template <class Variable>
+void permute(Variable& variable, const std::vector<int>& new_to_old)
+{
+    if (variable.empty()) {
+        return;
+    }
+    std::vector<typename Variable::value_type> values;
+    values.reserve(new_to_old.size());
+    for (int old : new_to_old) {
+        values.push_back(variable.get(old));
+    }
+    variable.assign(values.begin(), values.end());
+}
+
+std::vector<int> invert(const std::vector<int>& new_to_old)
+{
+    std::vector<int> old_to_new(new_to_old.size());
+    for (std::size_t i = 0; i < new_to_old.size(); ++i) {
+        old_to_new[new_to_old[i]] = i;
+    }
+    return old_to_new;
+}
+
+} // anonymous namespace
+
+
+void CpGridData::renumberCells(CellOrdering ordering)
+{
+    if (level_data_ptr_ && level_data_ptr_->size() > 1) {
+        OPM_THROW(std::logic_error, "Renumbering the cells of a grid with LGRs is not supported.");
+    }
+
+    const int num_cells = size(0);
+    std::vector<int> new_to_old;
+    if (ordering == CellOrdering::hilbert) {
+        std::vector<FieldVector<double, 3>> centroids(num_cells);
+        for (int cell = 0; cell < num_cells; ++cell) {
+            centroids[cell] = geometry_.cellCentroid(cell);
+        }
+        new_to_old = hilbertOrder(centroids);
+    } else {
+        // Cells connected by a face, including NNCs. Faces on the process
+        // boundary have an invalid neighbor.
+        std::vector<int> offsets(num_cells + 1, 0);
+        const auto valid = [](const EntityRep<0>& cell) {
+            return cell.index() != std::numeric_limits<int>::max();
+        };
+        for (int face = 0; face < face_to_cell_.size(); ++face) {
+            const auto cells = face_to_cell_[EntityRep<1>(face, true)];
+            if (cells.size() == 2 && valid(cells[0]) && valid(cells[1])) {
+                ++offsets[cells[0].index() + 1];
+                ++offsets[cells[1].index() + 1];
+            }
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        std::vector<int> neighbors(offsets.back());
+        auto position = offsets;
+        for (int face = 0; face < face_to_cell_.size(); ++face) {
+            const auto cells = face_to_cell_[EntityRep<1>(face, true)];
+            if (cells.size() == 2 && valid(cells[0]) && valid(cells[1])) {
+                neighbors[position[cells[0].index()]++] = cells[1].index();
+                neighbors[position[cells[1].index()]++] = cells[0].index();
+            }
+        }
+        new_to_old = reverseCuthillMcKeeOrder(offsets, neighbors);
+    }
+
+#if HAVE_MPI
+    // Keep owner cells in front of the overlap cells.
+    const auto& indicator = partition_type_indicator_->cell_indicator_;
+    if (!indicator.empty()) {
+        const auto interior = [&indicator](int cell) { return indicator[cell] == InteriorEntity; };
+        const auto first_overlap = std::find_if_not(indicator.begin(), indicator.end(),
+                                                    [](char type) { return type == InteriorEntity; });
+        if (std::all_of(first_overlap, indicator.end(),
+                        [](char type) { return type != InteriorEntity; })) {
+            std::stable_partition(new_to_old.begin(), new_to_old.end(), interior);
+        }
+    }
+#endif
+
+    permuteCells(new_to_old);
+    if (intersection_table_) {
+        buildIntersectionTable();
+    }
+}
+
+
+void CpGridData::permuteCells(const std::vector<int>& new_to_old_cell)
+{
+    const int num_cells = size(0);
+    const int num_faces = face_to_cell_.size();
+    const std::vector<int> old_to_new_cell = invert(new_to_old_cell);
+
+    // Faces follow the first of their cells in the new order.
+    std::vector<int> face_key(num_faces, num_cells);
+    for (int face = 0; face < num_faces; ++face) {
+        const auto cells = face_to_cell_[EntityRep<1>(face, true)];
+        for (int i = 0; i < cells.size(); ++i) {
+            if (cells[i].index() != std::numeric_limits<int>::max()) {
+                face_key[face] = std::min(face_key[face], old_to_new_cell[cells[i].index()]);
+            }
+        }
+    }
+    std::vector<int> new_to_old_face(num_faces);
+    std::iota(new_to_old_face.begin(), new_to_old_face.end(), 0);
+    std::stable_sort(new_to_old_face.begin(), new_to_old_face.end(),
+                     [&face_key](int a, int b) { return face_key[a] < face_key[b]; });
+    const std::vector<int> old_to_new_face = invert(new_to_old_face);
+
+    // Topology
+    {
+        std::vector<EntityRep<1>> faces;
+        std::vector<int> row_sizes;
+        faces.reserve(cell_to_face_.dataSize());
+        row_sizes.reserve(num_cells);
+        for (int old : new_to_old_cell) {
+            const auto row = static_cast<const Opm::SparseTable<EntityRep<1>>&>(cell_to_face_)[old];
+            for (const auto& face : row) {
+                faces.emplace_back(old_to_new_face[face.index()], face.orientation());
+            }
+            row_sizes.push_back(row.size());
+        }
+        cell_to_face_ = OrientedEntityTable<0, 1>(faces.begin(), faces.end(), row_sizes.begin(), row_sizes.end());
+    }
+    {
+        std::vector<EntityRep<0>> cells;
+        std::vector<int> row_sizes;
+        cells.reserve(face_to_cell_.dataSize());
+        row_sizes.reserve(num_faces);
+        for (int old : new_to_old_face) {
+            const auto row = static_cast<const Opm::SparseTable<EntityRep<0>>&>(face_to_cell_)[old];
+            for (const auto& cell : row) {
+                // Keep the marker of cells on other processes.
+                const int index = cell.index() == std::numeric_limits<int>::max()
+                    ? cell.index() : old_to_new_cell[cell.index()];
+                cells.emplace_back(index, cell.orientation());
+            }
+            row_sizes.push_back(row.size());
+        }
+        face_to_cell_ = OrientedEntityTable<1, 0>(cells.begin(), cells.end(), row_sizes.begin(), row_sizes.end());
+    }
+    {
+        std::vector<int> points;
+        std::vector<int> row_sizes;
+        points.reserve(face_to_point_.dataSize());
+        row_sizes.reserve(num_faces);
+        for (int old : new_to_old_face) {
+            const auto row = face_to_point_[old];
+            points.insert(points.end(), row.begin(), row.end());
+            row_sizes.push_back(row.size());
+        }
+        face_to_point_.assign(points.begin(), points.end(), row_sizes.begin(), row_sizes.end());
+    }
+    {
+        std::vector<std::array<int, 8>> cell_to_point(num_cells);
+        std::vector<int> global_cell(num_cells);
+        for (int cell = 0; cell < num_cells; ++cell) {
+            cell_to_point[cell] = cell_to_point_[new_to_old_cell[cell]];
+            global_cell[cell] = global_cell_[new_to_old_cell[cell]];
+        }
+        cell_to_point_.swap(cell_to_point);
+        global_cell_.swap(global_cell);
+    }
+    permute(face_tag_, new_to_old_face);
+    permute(unique_boundary_ids_, new_to_old_face);
+    permute(face_normals_, new_to_old_face);
+    if (!mark_.empty()) {
+        std::vector<int> mark(num_cells);
+        for (int cell = 0; cell < num_cells; ++cell) {
+            mark[cell] = mark_[new_to_old_cell[cell]];
+        }
+        mark_.swap(mark);
+    }
+    for (auto& cell : aquifer_cells_) {
+        cell = old_to_new_cell[cell];
+    }
+    std::sort(aquifer_cells_.begin(), aquifer_cells_.end());
+
+    // Geometry. The cell geometries refer to their corners in cell_to_point_.
+    // Compact cell geometry is reordered as is, instead of being expanded.
+    permute(*geometry_.geomVector(std::integral_constant<int, 1>()), new_to_old_face);
+    if (geometry_.hasCompactCellGeometry()) {
+        geometry_.permuteCompactCellGeometry(new_to_old_cell);
+    } else {
+        auto& cell_geom = *geometry_.geomVector(std::integral_constant<int, 0>());
+        const auto& point_geom = geomVector<3>();
+        std::vector<Geometry<3, 3>> geometries;
+        geometries.reserve(num_cells);
+        for (int cell = 0; cell < num_cells; ++cell) {
+            const auto& old = cell_geom.get(new_to_old_cell[cell]);
+            geometries.emplace_back(old.center(), old.volume(), point_geom, cell_to_point_[cell].data());
+        }
+        cell_geom.assign(geometries.begin(), geometries.end());
+    }
+
+#if HAVE_MPI
+    // Global ids are stored explicitly on distributed grids, keep them.
+    if (!global_id_set_->getMapping<0>().empty()) {
+        std::vector<int> cell_ids(num_cells);
+        std::vector<int> face_ids(num_faces);
+        std::vector<int> point_ids = global_id_set_->getMapping<3>();
+        for (int cell = 0; cell < num_cells; ++cell) {
+            cell_ids[cell] = global_id_set_->getMapping<0>()[new_to_old_cell[cell]];
+        }
+        for (int face = 0; face < num_faces; ++face) {
+            face_ids[face] = global_id_set_->getMapping<1>()[new_to_old_face[face]];
+        }
+        global_id_set_->swap(cell_ids, face_ids, point_ids);
+    }
+
+    for (auto& index : cellIndexSet()) {
+        index.local() = old_to_new_cell[index.local().local()];
+    }
+    // Only distributed grids have partition types and communication interfaces.
+    if (!partition_type_indicator_->cell_indicator_.empty()) {
+        cellRemoteIndices().template rebuild<false>();
+        clearCommunicationInterfaces();
+        computeCellPartitionType();
+        computeCommunicationInterfaces(size(3));
+    }
+#endif
+
+    cell_renumbering_ = new_to_old_cell;
+    face_renumbering_ = std::move(new_to_old_face);
+}
+
+} // namespace cpgrid
+} // namespace Dune
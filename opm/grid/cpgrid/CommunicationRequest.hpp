@@ -0,0 +1,360 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_COMMUNICATIONREQUEST_HEADER
+#define OPM_COMMUNICATIONREQUEST_HEADER
+
+#include <dune/grid/common/gridenums.hh>
+
+#if HAVE_MPI
+#include <mpi.h>
+#include <dune/common/parallel/mpitraits.hh>
+#include <dune/common/parallel/variablesizecommunicator.hh>
+#endif
+
+#include "Entity2IndexDataHandle.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+#if HAVE_MPI
+
+/// \brief Message buffers of split-phase communications.
+///
+/// Each communication takes a set of buffers when it is started and hands
+/// them back when it is finished, such that repeated halo exchanges reuse the
+/// memory of the previous ones. The pool also owns a duplicate of the grid's
+/// communicator, which keeps the messages apart from any other traffic.
+class CommunicationBufferPool
+{
+public:
+    /// \brief The buffers of one communication.
+    struct Buffers
+    {
+        std::vector<std::vector<char>> send;
+        std::vector<std::vector<char>> recv;
+        std::vector<std::vector<std::size_t>> sendSizes;
+        std::vector<std::vector<std::size_t>> recvSizes;
+        std::vector<MPI_Request> sendRequests;
+        std::vector<MPI_Request> recvRequests;
+    };
+
+    explicit CommunicationBufferPool(MPI_Comm comm)
+    {
+        MPI_Comm_dup(comm, &comm_);
+    }
+
+    CommunicationBufferPool(const CommunicationBufferPool&) = delete;
+    CommunicationBufferPool& operator=(const CommunicationBufferPool&) = delete;
+
+    ~CommunicationBufferPool()
+    {
+        MPI_Comm_free(&comm_);
+    }
+
+    MPI_Comm communicator() const
+    {
+        return comm_;
+    }
+
+    /// \brief Get a free set of buffers.
+    std::unique_ptr<Buffers> acquire()
+    {
+        if (free_.empty()) {
+            return std::make_unique<Buffers>();
+        }
+        auto buffers = std::move(free_.back());
+        free_.pop_back();
+        return buffers;
+    }
+
+    /// \brief Hand buffers back for reuse.
+    void release(std::unique_ptr<Buffers> buffers)
+    {
+        free_.push_back(std::move(buffers));
+    }
+
+    /// \brief Get a tag for the next communication.
+    ///
+    /// All processes start their communications in the same order, so the
+    /// tags agree, and communications that are pending at the same time
+    /// never receive each other's messages.
+    int nextTag()
+    {
+        const int tag = 2 * sequence_;
+        sequence_ = (sequence_ + 1) % maxPending;
+        return tag;
+    }
+
+private:
+    static constexpr int maxPending = 1024;
+    MPI_Comm comm_;
+    std::vector<std::unique_ptr<Buffers>> free_;
+    int sequence_ = 0;
+};
+
+/// \brief The pending exchange of one codimension along an interface.
+///
+/// \tparam IndexDataHandle A data handle addressing the entities by index,
+///         e.g. Entity2IndexDataHandle.
+template<class IndexDataHandle>
+class IndexedExchange
+{
+public:
+    using DataType = typename IndexDataHandle::DataType;
+    using InterfaceMap = VariableSizeCommunicator<>::InterfaceMap;
+
+    static_assert(std::is_trivially_copyable_v<DataType>,
+                  "Split-phase communication needs a trivially copyable DataType");
+
+    /// \brief Gather and send the data, and post the receives.
+    IndexedExchange(const InterfaceMap& interface, CommunicationDirection dir,
+                    const IndexDataHandle& handle, CommunicationBufferPool& pool)
+        : interface_(interface), forward_(dir == ForwardCommunication),
+          handle_(handle), pool_(pool), buffers_(pool.acquire()),
+          tag_(pool.nextTag()), fixedSize_(handle_.fixedSize())
+    {
+        const std::size_t numProcs = interface_.size();
+        buffers_->send.resize(numProcs);
+        buffers_->recv.resize(numProcs);
+        buffers_->sendSizes.resize(numProcs);
+        buffers_->recvSizes.resize(numProcs);
+        buffers_->sendRequests.clear();
+        buffers_->recvRequests.clear();
+
+        const MPI_Comm comm = pool_.communicator();
+        const auto dataType = MPITraits<DataType>::getType();
+        const auto sizeType = MPITraits<std::size_t>::getType();
+
+        std::size_t p = 0;
+        for (const auto& [proc, lists] : interface_) {
+            const auto& sendList = forward_ ? lists.first : lists.second;
+            const auto& recvList = forward_ ? lists.second : lists.first;
+
+            if (sendList.size() > 0) {
+                auto& sizes = buffers_->sendSizes[p];
+                std::size_t total = 0;
+                if (fixedSize_) {
+                    total = sendList.size() * handle_.size(sendList[0]);
+                } else {
+                    sizes.resize(sendList.size());
+                    for (std::size_t i = 0; i < sendList.size(); ++i) {
+                        sizes[i] = handle_.size(sendList[i]);
+                        total += sizes[i];
+                    }
+                }
+                auto& buffer = buffers_->send[p];
+                buffer.resize(total * sizeof(DataType));
+                Writer writer{reinterpret_cast<DataType*>(buffer.data())};
+                for (std::size_t i = 0; i < sendList.size(); ++i) {
+                    handle_.gather(writer, sendList[i]);
+                }
+                if (!fixedSize_) {
+                    buffers_->sendRequests.emplace_back();
+                    MPI_Isend(sizes.data(), sizes.size(), sizeType, proc, tag_,
+                              comm, &buffers_->sendRequests.back());
+                }
+                buffers_->sendRequests.emplace_back();
+                MPI_Isend(buffer.data(), total, dataType, proc, tag_ + 1,
+                          comm, &buffers_->sendRequests.back());
+            }
+
+            if (recvList.size() > 0) {
+                buffers_->recvRequests.emplace_back();
+                if (fixedSize_) {
+                    // The number of items is known, the data can arrive while we compute.
+                    const std::size_t total = recvList.size() * handle_.size(recvList[0]);
+                    buffers_->recv[p].resize(total * sizeof(DataType));
+                    MPI_Irecv(buffers_->recv[p].data(), total, dataType, proc, tag_ + 1,
+                              comm, &buffers_->recvRequests.back());
+                } else {
+                    buffers_->recvSizes[p].resize(recvList.size());
+                    MPI_Irecv(buffers_->recvSizes[p].data(), recvList.size(), sizeType, proc, tag_,
+                              comm, &buffers_->recvRequests.back());
+                }
+            }
+            ++p;
+        }
+    }
+
+    IndexedExchange(const IndexedExchange&) = delete;
+    IndexedExchange& operator=(const IndexedExchange&) = delete;
+
+    /// \brief Wait for the messages and scatter the received data.
+    void finish()
+    {
+        auto& requests = buffers_->recvRequests;
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+        if (!fixedSize_) {
+            // Now that the sizes are known, receive the data itself.
+            const MPI_Comm comm = pool_.communicator();
+            const auto dataType = MPITraits<DataType>::getType();
+            requests.clear();
+            std::size_t p = 0;
+            for (const auto& [proc, lists] : interface_) {
+                const auto& recvList = forward_ ? lists.second : lists.first;
+                if (recvList.size() > 0) {
+                    std::size_t total = 0;
+                    for (std::size_t size : buffers_->recvSizes[p]) {
+                        total += size;
+                    }
+                    buffers_->recv[p].resize(total * sizeof(DataType));
+                    requests.emplace_back();
+                    MPI_Irecv(buffers_->recv[p].data(), total, dataType, proc, tag_ + 1,
+                              comm, &requests.back());
+                }
+                ++p;
+            }
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        std::size_t p = 0;
+        for (const auto& entry : interface_) {
+            const auto& recvList = forward_ ? entry.second.second : entry.second.first;
+            if (recvList.size() > 0) {
+                Reader reader{reinterpret_cast<const DataType*>(buffers_->recv[p].data())};
+                const std::size_t fixed = fixedSize_ ? handle_.size(recvList[0]) : 0;
+                for (std::size_t i = 0; i < recvList.size(); ++i) {
+                    handle_.scatter(reader, recvList[i],
+                                    fixedSize_ ? fixed : buffers_->recvSizes[p][i]);
+                }
+            }
+            ++p;
+        }
+
+        auto& sendRequests = buffers_->sendRequests;
+        MPI_Waitall(sendRequests.size(), sendRequests.data(), MPI_STATUSES_IGNORE);
+        pool_.release(std::move(buffers_));
+    }
+
+private:
+    struct Writer
+    {
+        DataType* position;
+        void write(const DataType& value)
+        {
+            *position++ = value;
+        }
+    };
+
+    struct Reader
+    {
+        const DataType* position;
+        void read(DataType& value)
+        {
+            value = *position++;
+        }
+    };
+
+    const InterfaceMap& interface_;
+    bool forward_;
+    IndexDataHandle handle_;
+    CommunicationBufferPool& pool_;
+    std::unique_ptr<CommunicationBufferPool::Buffers> buffers_;
+    int tag_;
+    bool fixedSize_;
+};
+
+#endif // HAVE_MPI
+
+/// \brief A communication started with CpGrid::startCommunicate.
+///
+/// The data is gathered and sent when the communication is started. finish()
+/// waits for the messages and scatters the received data. In between, the
+/// data handle, the data it refers to and the grid must stay alive, and the
+/// data sent must not be modified. The destructor finishes a communication
+/// that is still pending.
+template<class DataHandle>
+class CommunicationRequest
+{
+public:
+    CommunicationRequest() = default;
+    CommunicationRequest(CommunicationRequest&&) = default;
+    CommunicationRequest(const CommunicationRequest&) = delete;
+    CommunicationRequest& operator=(const CommunicationRequest&) = delete;
+
+    CommunicationRequest& operator=(CommunicationRequest&& other)
+    {
+        finish();
+#if HAVE_MPI
+        cells_ = std::move(other.cells_);
+        faces_ = std::move(other.faces_);
+        points_ = std::move(other.points_);
+#endif
+        (void) other;
+        return *this;
+    }
+
+    ~CommunicationRequest()
+    {
+        finish();
+    }
+
+    /// \brief Complete the communication.
+    ///
+    /// Calling it again does nothing.
+    void finish()
+    {
+#if HAVE_MPI
+        if (cells_) {
+            cells_->finish();
+            cells_.reset();
+        }
+        if (faces_) {
+            faces_->finish();
+            faces_.reset();
+        }
+        if (points_) {
+            points_->finish();
+            points_.reset();
+        }
+#endif
+    }
+
+    /// \brief Whether the communication still needs to be finished.
+    bool pending() const
+    {
+#if HAVE_MPI
+        return cells_ || faces_ || points_;
+#else
+        return false;
+#endif
+    }
+
+private:
+    friend class CpGridData;
+#if HAVE_MPI
+    std::unique_ptr<IndexedExchange<Entity2IndexDataHandle<DataHandle, 0>>> cells_;
+    std::unique_ptr<IndexedExchange<Entity2IndexDataHandle<DataHandle, 1>>> faces_;
+    std::unique_ptr<IndexedExchange<Entity2IndexDataHandle<DataHandle, 3>>> points_;
+#endif
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_COMMUNICATIONREQUEST_HEADER
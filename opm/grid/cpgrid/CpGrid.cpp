@@ -57,14 +57,18 @@
 #include <opm/grid/GraphOfGridWrappers.hpp>
 //#include <opm/grid/common/ZoltanGraphFunctions.hpp>
 #include <opm/grid/common/GridPartitioning.hpp>
+#include <opm/grid/common/PartitionCache.hpp>
 //#include <opm/grid/common/WellConnections.hpp>
 #include <opm/grid/common/CommunicationUtils.hpp>
 
-//#include <fstream>
 //#include <iostream>
 #include <algorithm>
+#include <exception>
+#include <fstream>
 #include <iomanip>
 #include <numeric>
+#include <optional>
+#include <sstream>
 #include <tuple>
 
 namespace
@@ -121,6 +125,42 @@ void setupRecvInterface(const std::vector<std::tuple<int, int, char, int> >& lis
         interface[std::get<1>(entry)].second.add(index);
     }
 }
+
+/// \brief Handle communicating one integer per cell, e.g. the new process of each cell.
+class CellValueHandle
+{
+public:
+    using DataType = int;
+
+    explicit CellValueHandle(std::vector<int>& values)
+        : values_(values)
+    {}
+    bool fixedSize(std::size_t, std::size_t)
+    {
+        return true;
+    }
+    bool contains(std::size_t, std::size_t codim)
+    {
+        return codim == 0;
+    }
+    template<class T>
+    std::size_t size(const T&)
+    {
+        return 1;
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        buffer.write(values_[t.index()]);
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t)
+    {
+        buffer.read(values_[t.index()]);
+    }
+private:
+    std::vector<int>& values_;
+};
 #endif // HAVE_MPI
 
 /// Release memory resources from CpGrid::InterfaceMap.  Used as custom
@@ -168,9 +208,11 @@ CpGrid::CpGrid()
       distributed_data_(),
       cell_scatter_gather_interfaces_(new InterfaceMap, FreeInterfaces{}),
       point_scatter_gather_interfaces_(new InterfaceMap, FreeInterfaces{}),
-      global_id_set_ptr_()
+      global_id_set_ptr_(),
+      setup_timings_(std::make_shared<Opm::PhaseTimings>())
 {
     data_.push_back(std::make_shared<cpgrid::CpGridData>(data_));
+    data_[0]->setup_timings_ = setup_timings_;
     current_view_data_ = data_[0].get();
     current_data_ = &data_;
     global_id_set_ptr_ = std::make_shared<cpgrid::GlobalIdSet>(*current_view_data_);
@@ -182,9 +224,11 @@ CpGrid::CpGrid(MPIHelper::MPICommunicator comm)
       distributed_data_(),
       cell_scatter_gather_interfaces_(new InterfaceMap, FreeInterfaces{}),
       point_scatter_gather_interfaces_(new InterfaceMap, FreeInterfaces{}),
-      global_id_set_ptr_()
+      global_id_set_ptr_(),
+      setup_timings_(std::make_shared<Opm::PhaseTimings>())
 {
     data_.push_back(std::make_shared<cpgrid::CpGridData>(comm, data_));
+    data_[0]->setup_timings_ = setup_timings_;
     current_view_data_ = data_[0].get();
     current_data_ = &data_;
     global_id_set_ptr_ = std::make_shared<cpgrid::GlobalIdSet>(*current_view_data_);
@@ -218,7 +262,7 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
                     [[maybe_unused]] bool serialPartitioning,
                     const double* transmissibilities,
                     [[maybe_unused]] bool addCornerCells,
-                    int overlapLayers,
+                    [[maybe_unused]] int overlapLayers,
                     [[maybe_unused]] int partitionMethod,
                     double imbalanceTol,
                     [[maybe_unused]] bool allowDistributedWells,
@@ -227,7 +271,6 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
     // Silence any unused argument warnings that could occur with various configurations.
     static_cast<void>(wells);
     static_cast<void>(transmissibilities);
-    static_cast<void>(overlapLayers);
     static_cast<void>(method);
     static_cast<void>(imbalanceTol);
 
@@ -237,33 +280,72 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
                  << " Maybe scatterGrid was called before?"<<std::endl;
         return std::make_pair(false, std::vector<std::pair<std::string,bool> >());
     }
-
-    if (data_.size() > 1)
-    {
-        if (comm().rank() == 0)
-        {
-            OPM_THROW(std::logic_error, "Loadbalancing a grid with local grid refinement is not supported, yet.");
-        }
-        else
-        {
-            OPM_THROW_NOLOG(std::logic_error, "Loadbalancing a grid with local grid refinement is not supported, yet.");
-        }
-    }
+    // Distribution copies the cell geometry objects.
+    setCompactCellGeometry(false);
+    setIntersectionTable(false);
 
 #if HAVE_MPI
     auto& cc = data_[0]->ccobj_;
 
     if (cc.size() > 1)
     {
+        Opm::PhaseTimings::Scope loadBalancePhase(setup_timings_.get(), "loadBalance");
+        loadBalancePhase.setItems(data_[0]->size(0));
+
+        // A grid with LGRs is distributed via its level zero grid, where each parent cell
+        // is weighted by its number of children. The LGRs are then refined again on the
+        // distributed level zero grid, hence children live on the process of their parent.
+        std::vector<std::array<int,3>> lgrCellsPerDim;
+        std::vector<std::array<int,3>> lgrStartIJK;
+        std::vector<std::array<int,3>> lgrEndIJK;
+        std::vector<std::string> lgrNames;
+        if (data_.size() > 1)
+        {
+            getLgrBlocksOfGlobalGrid(lgrCellsPerDim, lgrStartIJK, lgrEndIJK, lgrNames);
+            current_view_data_ = data_[0].get();
+            global_id_set_ptr_ = std::make_shared<cpgrid::GlobalIdSet>(*data_[0]);
+        }
+
         std::vector<int> computedCellPart;
         std::vector<std::pair<std::string,bool>> wells_on_proc;
         std::vector<std::tuple<int,int,char>> exportList;
         std::vector<std::tuple<int,int,char,int>> importList;
         cpgrid::WellConnections wellConnections;
 
+        Opm::PhaseTimings::Scope partitionPhase(setup_timings_.get(), "partition");
+        partitionPhase.setItems(data_[0]->size(0));
         auto inputNumParts = input_cell_part.size();
         inputNumParts = this->comm().max(inputNumParts);
 
+        // Reuse the partitioning of an earlier run with the same input, if cached.
+        std::vector<int> cachedCellPart;
+        std::uint64_t cacheKey = 0;
+        bool useCachedPart = false;
+        if ( inputNumParts == 0 && !partition_cache_file_.empty() )
+        {
+            if (comm().rank() == 0)
+            {
+                cacheKey = cpgrid::partitionCacheKey(*this, wells, possibleFutureConnections, transmissibilities,
+                                                     method, partitionMethod, serialPartitioning, imbalanceTol,
+                                                     allowDistributedWells, partitioningParams, cc.size());
+                std::vector<int> cachedWellProcs;
+                useCachedPart = cpgrid::readPartitionCache(partition_cache_file_, cacheKey,
+                                                           cachedCellPart, cachedWellProcs)
+                    && std::size_t(size(0)) == cachedCellPart.size()
+                    && std::all_of(cachedCellPart.begin(), cachedCellPart.end(),
+                                   [&cc](int part) { return part >= 0 && part < cc.size(); })
+                    && cachedWellProcs == cpgrid::wellProcesses(*this, wells, possibleFutureConnections,
+                                                                cachedCellPart);
+                if (useCachedPart)
+                {
+                    Opm::OpmLog::info("Using the partitioning cached in " + partition_cache_file_ + ".");
+                }
+            }
+            int cacheHit = useCachedPart;
+            comm().broadcast(&cacheHit, 1, 0);
+            useCachedPart = cacheHit;
+        }
+
         if ( inputNumParts > 0 )
         {
             std::vector<int> errors;
@@ -330,6 +412,13 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
                 cpgrid::createListsFromParts(*this, wells, possibleFutureConnections, nullptr, input_cell_part,
                                                    true);
         }
+        else if (useCachedPart)
+        {
+            // Partitioning read from the cache
+            std::tie(computedCellPart, wells_on_proc, exportList, importList, wellConnections) =
+                cpgrid::createListsFromParts(*this, wells, possibleFutureConnections, transmissibilities,
+                                             cachedCellPart, allowDistributedWells);
+        }
         else
         {
             if (partitionMethod == Dune::PartitionMethod::zoltan)
@@ -370,12 +459,24 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
                 std::tie(computedCellPart, wells_on_proc, exportList, importList, wellConnections) =
                     cpgrid::vanillaPartitionGridOnRoot(*this, wells, possibleFutureConnections, transmissibilities, allowDistributedWells);
             }
+
+            if (inputNumParts == 0 && !partition_cache_file_.empty() && comm().rank() == 0
+                && std::size_t(size(0)) == computedCellPart.size())
+            {
+                cpgrid::writePartitionCache(partition_cache_file_, cacheKey, computedCellPart,
+                                            cpgrid::wellProcesses(*this, wells, possibleFutureConnections,
+                                                                  computedCellPart));
+            }
         }
+        partitionPhase.stop();
         comm().barrier();
 
         // first create the overlap
+        Opm::PhaseTimings::Scope overlapPhase(setup_timings_.get(), "addOverlapLayer");
         auto noImportedOwner = addOverlapLayer(*this, computedCellPart, exportList, importList, cc, addCornerCells,
-                                               transmissibilities);
+                                               transmissibilities, overlapLayers);
+        overlapPhase.setItems(importList.size());
+        overlapPhase.stop();
         // importList contains all the indices that will be here.
         auto compareImport = [](const std::tuple<int,int,char,int>& t1,
                                 const std::tuple<int,int,char,int>&t2)
@@ -514,6 +615,7 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
 
         // distributed_data should be empty at this point.
         distributed_data_.push_back(std::make_shared<cpgrid::CpGridData>(cc, distributed_data_));
+        distributed_data_[0]->setup_timings_ = setup_timings_;
         distributed_data_[0]->setUniqueBoundaryIds(data_[0]->uniqueBoundaryIds());
 
         // Just to be sure we assume that only master knows
@@ -543,6 +645,13 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
 
         current_view_data_ = distributed_data_[0].get();
         current_data_ = &distributed_data_;
+
+        if (!lgrCellsPerDim.empty())
+        {
+            addLgrsUpdateLeafView(lgrCellsPerDim, lgrStartIJK, lgrEndIJK, lgrNames);
+            // Refinement resets the id set, which still has to know the global grid.
+            global_id_set_ptr_->insertIdSet(*data_[0]);
+        }
         return std::make_pair(true, wells_on_proc);
     }
     else
@@ -559,6 +668,201 @@ CpGrid::scatterGrid(EdgeWeightMethod method,
 #endif
 }
 
+void CpGrid::repartition(const std::vector<int>& parts)
+{
+    repartitionGrid(parts);
+}
+
+void CpGrid::repartitionGrid([[maybe_unused]] const std::vector<int>& parts,
+                             [[maybe_unused]] const std::function<void(const cpgrid::CpGridData&,
+                                                                       const InterfaceMap&,
+                                                                       const InterfaceMap&)>& migrateData)
+{
+    if (distributed_data_.empty())
+    {
+        OPM_THROW(std::logic_error, "Only a grid distributed by loadBalance can be repartitioned.");
+    }
+    if (maxLevel() > 0)
+    {
+        OPM_THROW(std::logic_error, "Repartitioning a grid with local grid refinement is not supported, yet.");
+    }
+    // Distribution copies the cell geometry objects.
+    setCompactCellGeometry(false);
+    setIntersectionTable(false);
+
+#if HAVE_MPI
+    auto oldData = distributed_data_[0];
+    auto cellMigration = std::shared_ptr<InterfaceMap>(new InterfaceMap, FreeInterfaces{});
+    auto pointMigration = std::shared_ptr<InterfaceMap>(new InterfaceMap, FreeInterfaces{});
+    auto& cc = oldData->ccobj_;
+    const auto& oldIndexSet = oldData->cellIndexSet();
+
+    // The new process of the overlap cells is the one given by their owner.
+    std::vector<int> newParts(parts);
+    int invalidParts = newParts.size() != std::size_t(oldData->size(0));
+    if (!invalidParts)
+    {
+        for (const auto& index : oldIndexSet)
+        {
+            const int part = newParts[index.local()];
+            invalidParts = invalidParts || (index.local().attribute() == AttributeSet::owner
+                                            && (part < 0 || part >= cc.size()));
+        }
+    }
+    if (cc.max(invalidParts))
+    {
+        OPM_THROW(std::invalid_argument, "Repartition: Each owned cell needs a process between 0 and the number of processes.");
+    }
+    CellValueHandle partHandle(newParts);
+    oldData->communicate(partHandle, InteriorBorder_All_Interface, ForwardCommunication);
+
+    // Each owned cell is sent to its new owner, and as overlap cell to the new owners
+    // of the cells sharing a face with it. Entries: global id, process, attribute, local index.
+    std::vector<std::tuple<int,int,char,int>> exportList;
+    exportList.reserve(oldIndexSet.size());
+    for (const auto& index : oldIndexSet)
+    {
+        if (index.local().attribute() != AttributeSet::owner)
+        {
+            continue;
+        }
+        const int cell = index.local();
+        const int part = newParts[cell];
+        exportList.emplace_back(index.global(), part, AttributeSet::owner, cell);
+        for (int localFace = 0; localFace < numCellFaces(cell); ++localFace)
+        {
+            const int face = cellFace(cell, localFace);
+            for (int side = 0; side < 2; ++side)
+            {
+                const int neighbor = faceCell(face, side);
+                if (neighbor >= 0 && newParts[neighbor] != part)
+                {
+                    exportList.emplace_back(index.global(), newParts[neighbor], AttributeSet::copy, cell);
+                }
+            }
+        }
+    }
+    std::sort(exportList.begin(), exportList.end());
+    exportList.erase(std::unique(exportList.begin(), exportList.end()), exportList.end());
+
+    // Tell each process which cells it receives.
+    const int noProcs = cc.size();
+    std::vector<int> sendCounts(noProcs, 0);
+    for (const auto& entry : exportList)
+    {
+        sendCounts[std::get<1>(entry)] += 2;
+    }
+    std::vector<int> recvCounts(noProcs);
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, cc);
+    std::vector<int> sendDispl(noProcs + 1, 0);
+    std::vector<int> recvDispl(noProcs + 1, 0);
+    std::partial_sum(sendCounts.begin(), sendCounts.end(), sendDispl.begin() + 1);
+    std::partial_sum(recvCounts.begin(), recvCounts.end(), recvDispl.begin() + 1);
+    std::vector<int> sendBuffer(sendDispl.back());
+    std::vector<int> recvBuffer(recvDispl.back());
+    auto sendPos = sendDispl;
+    for (const auto& entry : exportList)
+    {
+        auto& pos = sendPos[std::get<1>(entry)];
+        sendBuffer[pos++] = std::get<0>(entry);
+        sendBuffer[pos++] = std::get<2>(entry);
+    }
+    MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDispl.data(), MPI_INT,
+                  recvBuffer.data(), recvCounts.data(), recvDispl.data(), MPI_INT, cc);
+
+    std::vector<std::tuple<int,int,char,int>> importList;
+    importList.reserve(recvBuffer.size() / 2);
+    for (int proc = 0; proc < noProcs; ++proc)
+    {
+        for (int pos = recvDispl[proc]; pos < recvDispl[proc + 1]; pos += 2)
+        {
+            importList.emplace_back(recvBuffer[pos], proc, recvBuffer[pos + 1], -1);
+        }
+    }
+    std::sort(importList.begin(), importList.end());
+    int localIndex = 0;
+    for (auto& entry : importList)
+    {
+        std::get<3>(entry) = localIndex++;
+    }
+
+    const int ownedCells = std::count_if(importList.begin(), importList.end(),
+                                         [](const auto& entry)
+                                         { return std::get<2>(entry) == AttributeSet::owner; });
+    if (cc.min(ownedCells) == 0)
+    {
+        const std::string msg = "Repartition: At least one process would have zero cells.";
+        if (cc.rank() == 0)
+        {
+            OPM_THROW(std::runtime_error, msg);
+        }
+        else
+        {
+            OPM_THROW_NOLOG(std::runtime_error, msg);
+        }
+    }
+    const int movedCells = std::count_if(exportList.begin(), exportList.end(),
+                                         [&cc](const auto& entry)
+                                         { return std::get<2>(entry) == AttributeSet::owner
+                                                  && std::get<1>(entry) != cc.rank(); });
+    const int totalMovedCells = cc.sum(movedCells);
+    if (cc.rank() == 0)
+    {
+        Opm::OpmLog::info("\nRepartitioning moves " + std::to_string(totalMovedCells)
+                          + " owned cells between processes.\n");
+    }
+
+    // Interfaces from the cells of the current grid to the ones of the new grid.
+    // Both sides list the cells exchanged with a process ordered by global id.
+    reserveInterface(exportList, *cellMigration, std::integral_constant<bool, true>());
+    for (const auto& entry : exportList)
+    {
+        (*cellMigration)[std::get<1>(entry)].first.add(std::get<3>(entry));
+    }
+    setupRecvInterface(importList, *cellMigration);
+
+    auto newData = std::make_shared<cpgrid::CpGridData>(cc, distributed_data_);
+    newData->setup_timings_ = setup_timings_;
+    newData->use_unique_boundary_ids_ = oldData->use_unique_boundary_ids_;
+    newData->cellIndexSet().beginResize();
+    for (const auto& entry : importList)
+    {
+        newData->cellIndexSet()
+            .add(std::get<0>(entry), ParallelIndexSet::LocalIndex(std::get<3>(entry), AttributeSet(std::get<2>(entry)), true));
+    }
+    newData->cellIndexSet().endResize();
+
+    // distributeGlobalGrid moves the grid in data_[0] to distributed_data_[0] using the scatter
+    // interfaces. Let it move the current distributed grid with the migration interfaces instead.
+    auto globalData = data_[0];
+    data_[0] = oldData;
+    distributed_data_[0] = newData;
+    cell_scatter_gather_interfaces_.swap(cellMigration);
+    point_scatter_gather_interfaces_.swap(pointMigration);
+    newData->distributeGlobalGrid(*this, *oldData, newParts);
+    data_[0] = globalData;
+    cell_scatter_gather_interfaces_.swap(cellMigration);
+    point_scatter_gather_interfaces_.swap(pointMigration);
+
+    // The interfaces from the global grid are stale now.
+    cell_scatter_gather_interfaces_.reset(new InterfaceMap, FreeInterfaces{});
+    point_scatter_gather_interfaces_.reset(new InterfaceMap, FreeInterfaces{});
+
+    newData->index_set_.reset(new cpgrid::IndexSet(newData->cell_to_face_.size(),
+                                                   newData->geomVector<3>().size()));
+    current_view_data_ = newData.get();
+
+    // The id set knows the entities of the previous grid while migrating data.
+    global_id_set_ptr_->insertIdSet(*newData);
+    if (migrateData)
+    {
+        migrateData(*oldData, *cellMigration, *pointMigration);
+    }
+    global_id_set_ptr_ = std::make_shared<cpgrid::GlobalIdSet>(*data_[0]);
+    global_id_set_ptr_->insertIdSet(*newData);
+#endif // HAVE_MPI
+}
+
 
 void CpGrid::createCartesian(const std::array<int, 3>& dims,
                              const std::array<double, 3>& cellsize,
@@ -566,6 +870,7 @@ void CpGrid::createCartesian(const std::array<int, 3>& dims,
 {
     if ( current_view_data_->ccobj_.rank() != 0 )
     {
+        current_view_data_->joinDistributedPreprocessing();
         // global grid only on rank 0
         current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
                                              current_view_data_->logical_cartesian_size_.size(),
@@ -728,6 +1033,58 @@ void CpGrid::setUniqueBoundaryIds(bool uids)
     current_view_data_->setUniqueBoundaryIds(uids);
 }
 
+bool CpGrid::distributedPreprocessing() const
+{
+    return current_view_data_->distributedPreprocessing();
+}
+
+void CpGrid::setDistributedPreprocessing(bool distributed)
+{
+    current_view_data_->setDistributedPreprocessing(distributed);
+}
+
+bool CpGrid::compactCellGeometry() const
+{
+    return current_view_data_->geometry_.hasCompactCellGeometry();
+}
+
+void CpGrid::setCompactCellGeometry(bool compact)
+{
+    for (auto* all_data : { &data_, &distributed_data_ }) {
+        for (auto& data : *all_data) {
+            if (!data) {
+                continue;
+            }
+            if (compact) {
+                data->geometry_.compactCellGeometry(data->cell_to_point_);
+            } else {
+                data->geometry_.expandCellGeometry();
+            }
+        }
+    }
+}
+
+bool CpGrid::hasIntersectionTable() const
+{
+    return current_view_data_->intersectionTable() != nullptr;
+}
+
+void CpGrid::setIntersectionTable(bool enable)
+{
+    for (auto* all_data : { &data_, &distributed_data_ }) {
+        for (auto& data : *all_data) {
+            if (!data) {
+                continue;
+            }
+            if (enable) {
+                data->buildIntersectionTable();
+            } else {
+                data->clearIntersectionTable();
+            }
+        }
+    }
+}
+
 std::string CpGrid::name() const
 {
     return "CpGrid";
@@ -1108,11 +1465,26 @@ void CpGrid::setPartitioningParams(const std::map<std::string,std::string>& para
     partitioningParams = params;
 }
 
+void CpGrid::setPartitionCacheFile(const std::string& fileName)
+{
+    partition_cache_file_ = fileName;
+}
+
+const std::string& CpGrid::partitionCacheFile() const
+{
+    return partition_cache_file_;
+}
+
 const typename CpGridTraits::Communication& Dune::CpGrid::comm () const
 {
     return current_view_data_->ccobj_;
 }
 
+cpgrid::CellCommunicationPlan& CpGrid::cellCommunicationPlan(InterfaceType iftype) const
+{
+    return current_view_data_->cellCommunicationPlan(iftype);
+}
+
 //
 
 const std::vector<double>& CpGrid::zcornData() const {
@@ -1230,6 +1602,66 @@ Dune::cpgrid::Intersection CpGrid::getParentIntersectionFromLgrBoundaryFace(cons
     OPM_THROW(std::invalid_argument, "Face is on the boundary of the grid");
 }
 
+void CpGrid::getLgrBlocksOfGlobalGrid(std::vector<std::array<int,3>>& cells_per_dim_vec,
+                                      std::vector<std::array<int,3>>& startIJK_vec,
+                                      std::vector<std::array<int,3>>& endIJK_vec,
+                                      std::vector<std::string>& lgr_name_vec) const
+{
+    // data_ = {level zero grid, LGR1, ..., LGRn, leaf grid view}
+    const int levels = data_.size() - 2;
+    cells_per_dim_vec.resize(levels);
+    startIJK_vec.resize(levels);
+    endIJK_vec.resize(levels);
+    lgr_name_vec.resize(levels);
+    for (const auto& [name, level] : lgr_names_) {
+        if (level > 0 && level <= levels) {
+            lgr_name_vec[level-1] = name;
+        }
+    }
+
+    // Per LGR: {status, cells_per_dim, startIJK, endIJK}. Status is 0 for a block,
+    // 1 if the LGR has not been created from a block, and 2 if it has no cells.
+    std::vector<int> blocks(10*levels, 0);
+    if (comm().rank() == 0) {
+        for (int level = 1; level <= levels; ++level) {
+            const auto& lgr = *data_[level];
+            auto* block = blocks.data() + 10*(level-1);
+            // Blocks are recorded by addLgrsUpdateLeafView().
+            if (!lgr.refines_block_) {
+                block[0] = 1;
+                continue;
+            }
+            if (lgr.size(0) == 0) {
+                block[0] = 2;
+                continue;
+            }
+            for (int c = 0; c < 3; ++c) {
+                block[1+c] = lgr.cells_per_dim_[c];
+                block[4+c] = lgr.block_start_ijk_[c];
+                block[7+c] = lgr.block_end_ijk_[c];
+            }
+        }
+    }
+    comm().broadcast(blocks.data(), blocks.size(), 0);
+
+    for (int level = 0; level < levels; ++level) {
+        const auto* block = blocks.data() + 10*level;
+        if (block[0] != 0) {
+            const std::string message = "Loadbalancing a grid with local grid refinement is only supported for LGRs "
+                "created from blocks of cells. " + lgr_name_vec[level] + (block[0] == 1 ? " is not a block." : " has no active cells.");
+            if (comm().rank() == 0) {
+                OPM_THROW(std::logic_error, message);
+            }
+            else {
+                OPM_THROW_NOLOG(std::logic_error, message);
+            }
+        }
+        std::copy(block+1, block+4, cells_per_dim_vec[level].begin());
+        std::copy(block+4, block+7, startIJK_vec[level].begin());
+        std::copy(block+7, block+10, endIJK_vec[level].begin());
+    }
+}
+
 bool CpGrid::nonNNCsSelectedCellsLGR(const std::vector<std::array<int,3>>& startIJK_vec,
                                      const std::vector<std::array<int,3>>& endIJK_vec) const
 {
@@ -1746,16 +2178,19 @@ const Dune::FieldVector<double,3>& CpGrid::faceNormal(int face) const
 
 double CpGrid::cellVolume(int cell) const
 {
-    return current_view_data_->geomVector<0>()[cpgrid::EntityRep<0>(cell, true)].volume();
+    return current_view_data_->geometry_.cellVolume(cell);
 }
 
 const Dune::FieldVector<double,3>& CpGrid::cellCentroid(int cell) const
 {
-    return current_view_data_->geomVector<0>()[cpgrid::EntityRep<0>(cell, true)].center();
+    return current_view_data_->geometry_.cellCentroid(cell);
 }
 
 CpGrid::CentroidIterator<0> CpGrid::beginCellCentroids() const
 {
+    if (compactCellGeometry()) {
+        OPM_THROW(std::logic_error, "Cell centroid iterators are not available with compact cell geometry.");
+    }
     return CentroidIterator<0>(current_view_data_->geomVector<0>().begin());
 }
 
@@ -1871,8 +2306,10 @@ CpGrid::processEclipseFormat(const Opm::EclipseGrid* ecl_grid,
                              bool turn_normals, bool clip_z,
                              bool pinchActive)
 {
+    Opm::PhaseTimings::Scope phase(setup_timings_.get(), "processEclipseFormat");
     auto removed_cells = current_view_data_->processEclipseFormat(ecl_grid, ecl_state, periodic_extension,
                                                                   turn_normals, clip_z, pinchActive);
+    phase.setItems(current_view_data_->size(0));
     current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
                                          current_view_data_->logical_cartesian_size_.size(),
                                          0);
@@ -1893,6 +2330,7 @@ CpGrid::processEclipseFormat(const Opm::EclipseGrid* ecl_grid_ptr,
 void CpGrid::processEclipseFormat(const grdecl& input_data,
                                   bool remove_ij_boundary, bool turn_normals)
 {
+    Opm::PhaseTimings::Scope phase(setup_timings_.get(), "processEclipseFormat");
     using NNCMap = std::set<std::pair<int, int>>;
     using NNCMaps = std::array<NNCMap, 2>;
     NNCMaps nnc;
@@ -1902,11 +2340,153 @@ void CpGrid::processEclipseFormat(const grdecl& input_data,
 #endif
                                              nnc,
                                              remove_ij_boundary, turn_normals, false, 0.0);
+    phase.setItems(current_view_data_->size(0));
+    current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
+                                         current_view_data_->logical_cartesian_size_.size(),
+                                         0);
+}
+
+void CpGrid::saveProcessedGrid(const std::string& fileName) const
+{
+    if (data_.size() > 1 || !distributed_data_.empty()) {
+        OPM_THROW(std::logic_error, "Only a grid without refinement that has not been distributed can be saved.");
+    }
+    if (current_view_data_->ccobj_.rank() != 0) {
+        return;
+    }
+    std::ofstream out(fileName, std::ios::binary);
+    if (!out) {
+        OPM_THROW(std::runtime_error, "Could not open " + fileName + " for writing.");
+    }
+    current_view_data_->saveProcessedGrid(out);
+    if (!out) {
+        OPM_THROW(std::runtime_error, "Could not write the processed grid to " + fileName + ".");
+    }
+}
+
+void CpGrid::loadProcessedGrid(const std::string& fileName)
+{
+    if (current_view_data_->ccobj_.rank() == 0) {
+        std::ifstream in(fileName, std::ios::binary);
+        if (!in) {
+            OPM_THROW(std::runtime_error, "Could not open " + fileName + " for reading.");
+        }
+        current_view_data_->loadProcessedGrid(in);
+    }
+    // global grid only on rank 0
     current_view_data_->ccobj_.broadcast(current_view_data_->logical_cartesian_size_.data(),
                                          current_view_data_->logical_cartesian_size_.size(),
                                          0);
 }
 
+void CpGrid::saveDistributedGrid(const std::string& fileName) const
+{
+    if (distributed_data_.size() != 1) {
+        OPM_THROW(std::logic_error, "Only a distributed grid without refinement can be saved per process.");
+    }
+    const auto rankFileName = fileName + "." + std::to_string(comm().rank());
+    std::ofstream out(rankFileName, std::ios::binary);
+    if (!out) {
+        OPM_THROW(std::runtime_error, "Could not open " + rankFileName + " for writing.");
+    }
+    distributed_data_[0]->saveDistributedGrid(out);
+    if (!out) {
+        OPM_THROW(std::runtime_error, "Could not write the distributed grid to " + rankFileName + ".");
+    }
+}
+
+void CpGrid::loadDistributedGrid(const std::string& fileName)
+{
+    if (!distributed_data_.empty() || data_.size() > 1 || data_[0]->size(0) != 0) {
+        OPM_THROW(std::logic_error, "A distributed grid can only be loaded into an empty grid.");
+    }
+    const auto rankFileName = fileName + "." + std::to_string(comm().rank());
+    std::ifstream in(rankFileName, std::ios::binary);
+    // Throw on all ranks if any of them misses its file.
+    const bool opened = static_cast<bool>(in);
+    if (comm().min(opened ? 1 : 0) == 0) {
+        OPM_THROW(std::runtime_error, opened
+                  ? "Could not open the distributed grid file of another process."
+                  : "Could not open " + rankFileName + " for reading.");
+    }
+    distributed_data_.push_back(std::make_shared<cpgrid::CpGridData>(data_[0]->ccobj_, distributed_data_));
+    distributed_data_[0]->setup_timings_ = setup_timings_;
+    try {
+        distributed_data_[0]->loadDistributedGrid(in);
+    } catch (...) {
+        // Leave the grid empty, the other ranks have thrown as well.
+        distributed_data_.clear();
+        throw;
+    }
+    data_[0]->logical_cartesian_size_ = distributed_data_[0]->logical_cartesian_size_;
+    global_id_set_ptr_->insertIdSet(*distributed_data_[0]);
+
+    current_view_data_ = distributed_data_[0].get();
+    current_data_ = &distributed_data_;
+}
+
+void CpGrid::renumberCells(CellOrdering ordering)
+{
+    if (currentData().size() > 1) {
+        OPM_THROW(std::logic_error, "Renumbering the cells of a grid with LGRs is not supported.");
+    }
+    if (!distributed_data_.empty() && current_view_data_ == data_[0].get()) {
+        OPM_THROW(std::logic_error, "The global view of a distributed grid cannot be renumbered.");
+    }
+    current_view_data_->renumberCells(ordering);
+
+#if HAVE_MPI
+    // The receiving side of the scatter interface refers to the distributed cells.
+    if (current_view_data_ != data_[0].get()) {
+        const auto& new_to_old = current_view_data_->cellRenumbering();
+        std::vector<std::size_t> old_to_new(new_to_old.size());
+        for (std::size_t cell = 0; cell < new_to_old.size(); ++cell) {
+            old_to_new[new_to_old[cell]] = cell;
+        }
+        for (auto& entry : *cell_scatter_gather_interfaces_) {
+            auto& recv = entry.second.second;
+            for (std::size_t i = 0; i < recv.size(); ++i) {
+                recv[i] = old_to_new[recv[i]];
+            }
+        }
+    }
+#endif
+}
+
+const std::vector<int>& CpGrid::cellRenumbering() const
+{
+    return current_view_data_->cellRenumbering();
+}
+
+const std::vector<int>& CpGrid::faceRenumbering() const
+{
+    return current_view_data_->faceRenumbering();
+}
+
+const Opm::PhaseTimings& CpGrid::setupTimings() const
+{
+    return *setup_timings_;
+}
+
+void CpGrid::writeSetupTimings(std::ostream& os) const
+{
+    std::ostringstream phases;
+    setup_timings_->writeJson(phases);
+    const auto str = phases.str();
+    const auto [chars, offsets] = Opm::gatherv(std::vector<char>(str.begin(), str.end()), comm(), 0);
+    if (comm().rank() != 0) {
+        return;
+    }
+    os << "{\"ranks\": [";
+    for (int rank = 0; rank < comm().size(); ++rank) {
+        os << (rank == 0 ? "\n" : ",\n")
+           << "  {\"rank\": " << rank << ", \"phases\": ";
+        os.write(chars.data() + offsets[rank], offsets[rank + 1] - offsets[rank]);
+        os << "}";
+    }
+    os << "\n]}\n";
+}
+
 template<int dim>
 cpgrid::Entity<dim> createEntity(const CpGrid& grid,int index,bool orientation)
 {
@@ -1996,6 +2576,9 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     // To do: support coarsening.
     assert( static_cast<int>(assignRefinedLevel.size()) == current_view_data_->size(0));
     assert(cells_per_dim_vec.size() == lgr_name_vec.size());
+    // Refinement reads the cell geometry objects of all levels.
+    setCompactCellGeometry(false);
+    setIntersectionTable(false);
 
     // Each marked element has its assigned level where its refined entities belong.
     const int& levels = cells_per_dim_vec.size();
@@ -2088,7 +2671,7 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     // Following the example above,
     // markedElemAndEquivRefinedCorner_to_corner[{0, 8}] = 5;
     // markedElemAndEquivRefinedCorner_to_corner[{1, 2}] = 5;
-    std::map< std::array<int,2>, int > markedElemAndEquivRefinedCorn_to_corner;
+    cpgrid::IndexPairMap<int> markedElemAndEquivRefinedCorn_to_corner;
     // -- faceInMarkedElemAndRefinedFaces :
     // For each face from level zero, we store the marked elements where the face appears (maximum 2 cells)
     // and its new-born refined faces from each auxiliary marked-element-lgr. Example: face with index 9
@@ -2100,8 +2683,8 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     faceInMarkedElemAndRefinedFaces.resize(current_view_data_->face_to_cell_.size());
     // ------------------------ Refined cells parameters
     // --- Refined cells and PreAdapt cells relations ---
-    std::map<std::array<int,2>,std::array<int,2>> elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell;
-    std::map<std::array<int,2>,std::array<int,2>> refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell;
+    cpgrid::IndexPairMap<std::array<int,2>> elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell;
+    cpgrid::IndexPairMap<std::array<int,2>> refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell;
     // Integer to count only REFINED cells (new-born refined cells from ANY marked element).
     std::vector<int> refined_cell_count_vec(levels, 0);
     // -- Parent-child relations --
@@ -2109,8 +2692,8 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     std::vector<std::vector<std::tuple<int,std::vector<int>>>> preAdapt_parent_to_children_cells_vec(preAdaptMaxLevel +1);
     // ------------------------ Adapted cells parameters
     // --- Adapted cells and PreAdapt cells relations ---
-    std::map<std::array<int,2>,int>           elemLgrAndElemLgrCell_to_adaptedCell;
-    std::unordered_map<int,std::array<int,2>> adaptedCell_to_elemLgrAndElemLgrCell;
+    cpgrid::IndexPairMap<int>                elemLgrAndElemLgrCell_to_adaptedCell;
+    cpgrid::DenseIndexMap<std::array<int,2>> adaptedCell_to_elemLgrAndElemLgrCell;
     // Integer to count adapted cells (mixed between cells from level0 (not involved in LGRs), and (new-born) refined cells).
     int cell_count = 0;
     // -- Some extra indices relations between preAdapt-grid and adapted-grid --
@@ -2185,9 +2768,9 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     // Stablish relationships between PreAdapt corners and refined or adapted ones ---
     //
     // --- Refined corners and PreAdapt corners relations ---
-    std::map<std::array<int,2>,std::array<int,2>> elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner;
-    std::map<std::array<int,2>,std::array<int,2>> refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner;
-    std::map<std::array<int,2>,std::array<int,2>> vanishedRefinedCorner_to_itsLastAppearance;
+    cpgrid::IndexPairMap<std::array<int,2>> elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner;
+    cpgrid::IndexPairMap<std::array<int,2>> refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner;
+    cpgrid::IndexPairMap<std::array<int,2>> vanishedRefinedCorner_to_itsLastAppearance;
     // Integer to count only refined corners.
     std::vector<int> refined_corner_count_vec(levels, 0);
     identifyRefinedCornersPerLevel(/* Refined grid parameters */
@@ -2203,8 +2786,8 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                    cells_per_dim_vec);
 
     // --- Adapted corners and PreAdapt corners relations ---
-    std::map<std::array<int,2>,int>           elemLgrAndElemLgrCorner_to_adaptedCorner;
-    std::unordered_map<int,std::array<int,2>> adaptedCorner_to_elemLgrAndElemLgrCorner;
+    cpgrid::IndexPairMap<int>                elemLgrAndElemLgrCorner_to_adaptedCorner;
+    cpgrid::DenseIndexMap<std::array<int,2>> adaptedCorner_to_elemLgrAndElemLgrCorner;
     // Integer to count adapted corners (mixed between corners from current_view_data_ (not involved in LGRs), and (new-born) refined corners).
     int corner_count = 0;
     identifyLeafGridCorners(/* Adapted grid parameters */
@@ -2222,8 +2805,8 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     // FACES
     // Stablish relationships between PreAdapt faces and refined or adapted ones ---
     // --- Refined faces and PreAdapt faces relations ---
-    std::map<std::array<int,2>,std::array<int,2>> elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace;
-    std::map<std::array<int,2>,std::array<int,2>> refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace;
+    cpgrid::IndexPairMap<std::array<int,2>> elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace;
+    cpgrid::IndexPairMap<std::array<int,2>> refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace;
     // Integer to count adapted faces (mixed between faces from level0 (not involved in LGRs), and (new-born) refined faces).
     std::vector<int> refined_face_count_vec(levels, 0);
     identifyRefinedFacesPerLevel( elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
@@ -2235,8 +2818,8 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                   cells_per_dim_vec);
 
     // --- Adapted faces and PreAdapt faces relations ---
-    std::map< std::array<int,2>, int >           elemLgrAndElemLgrFace_to_adaptedFace;
-    std::unordered_map< int, std::array<int,2> > adaptedFace_to_elemLgrAndElemLgrFace;
+    cpgrid::IndexPairMap<int>                elemLgrAndElemLgrFace_to_adaptedFace;
+    cpgrid::DenseIndexMap<std::array<int,2>> adaptedFace_to_elemLgrAndElemLgrFace;
     // Integer to count adapted faces (mixed between faces from current_view_data_ (not involved in LGRs), and (new-born) refined faces).
     int face_count = 0;
     identifyLeafGridFaces(elemLgrAndElemLgrFace_to_adaptedFace,
@@ -2346,6 +2929,15 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
         (*data[refinedLevelGridIdx]).face_to_point_.swap(refined_face_to_point_vec[level]);
         (*data[refinedLevelGridIdx]).face_to_cell_.swap(refined_face_to_cell_vec[level]);
 
+        // The refined cells do not own their corners. Now that the level grid owns
+        // them, let the cells refer to the corners of the level grid.
+        const auto& level_all_corners = *(refinedLevel_geometries.geomVector(std::integral_constant<int,3>()));
+        for (std::size_t cell = 0; cell < level_cells.size(); ++cell) {
+            const auto& cellGeom = level_cells[cell];
+            level_cells[cell] = cpgrid::Geometry<3,3>(cellGeom.center(), cellGeom.volume(), level_all_corners,
+                                                      (*data[refinedLevelGridIdx]).cell_to_point_[cell].data());
+        }
+
         cpgrid::EntityVariable<enum face_tag,1>& level_face_tags =   (*data[refinedLevelGridIdx]).face_tag_;
         Dune::cpgrid::EntityVariableBase<enum face_tag>& level_mutable_face_tags = level_face_tags;
         level_mutable_face_tags.swap(mutable_refined_face_tags_vec[level]);
@@ -2438,7 +3030,8 @@ bool CpGrid::adapt(const std::vector<std::array<int,3>>& cells_per_dim_vec,
     // - Define global ids for refined level grids (level 1, 2, ..., maxLevel)
     // - Define GlobalIdMapping (cellMapping, faceMapping, pointMapping required per level)
     // - Define ParallelIndex for overlap cells and their neighbors
-    if(comm().size()>1) {
+    // A grid that has not been distributed yet lives on rank 0 only, and is refined as in a serial run.
+    if(comm().size()>1 && !distributed_data_.empty()) {
 #if HAVE_MPI
         // Prediction min cell and point global ids per process
         //
@@ -2586,6 +3179,10 @@ void CpGrid::addLgrsUpdateLeafView(const std::vector<std::array<int,3>>& cells_p
     // For serial run, level zero grid is stored in data_[0]. In this case, current_view_data_ == data_[0].
     // Note: currentData() returns data_ (if grid is not distributed) or distributed_data_ otherwise.
 
+    // Refinement reads the cell geometry objects of all levels.
+    setCompactCellGeometry(false);
+    setIntersectionTable(false);
+
     // Check startIJK_vec and endIJK_vec have same size, and "startIJK[patch][coordinate] < endIJK[patch][coordinate]"
     current_view_data_->validStartEndIJKs(startIJK_vec, endIJK_vec);
 
@@ -2658,6 +3255,14 @@ void CpGrid::addLgrsUpdateLeafView(const std::vector<std::array<int,3>>& cells_p
     adapt(cells_per_dim_vec, assignRefinedLevel, lgr_name_vec, true, startIJK_vec, endIJK_vec);
     postAdapt();
 
+    // Record the refined blocks, such that the LGRs can be recreated on a distributed grid.
+    for (std::size_t lgr = 0; lgr < startIJK_vec.size(); ++lgr) {
+        auto& levelData = *currentData()[lgr_names_.at(lgr_name_vec[lgr])];
+        levelData.refines_block_ = true;
+        levelData.block_start_ijk_ = startIJK_vec[lgr];
+        levelData.block_end_ijk_ = endIJK_vec[lgr];
+    }
+
     // Print total refined level grids and total cells on the leaf grid view
     Opm::OpmLog::info(std::to_string(non_empty_lgrs) + " (new) refined level grid(s) (in " + std::to_string(comm().rank()) + " rank).\n");
     Opm::OpmLog::info(std::to_string(current_view_data_->size(0)) + " total cells on the leaf grid view (in " + std::to_string(comm().rank()) + " rank).\n");
@@ -2682,17 +3287,17 @@ void CpGrid::refineAndProvideMarkedRefinedRelations( /* Marked elements paramete
                                                      std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                                      int& markedElem_count,
                                                      std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                                     std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                                     cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                                      std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                                      /* Refined cells parameters */
-                                                     std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
-                                                     std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                                     cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
+                                                     cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                                      std::vector<int>& refined_cell_count_vec,
                                                      const std::vector<int>& assignRefinedLevel,
                                                      std::vector<std::vector<std::tuple<int,std::vector<int>>>>& preAdapt_parent_to_children_cells_vec,
                                                      /* Adapted cells parameters */
-                                                     std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                                     std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                                     cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                                     cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                                      int& cell_count,
                                                      std::vector<std::vector<int>>& preAdapt_level_to_leaf_cells_vec,
                                                      /* Additional parameters */
@@ -2708,6 +3313,41 @@ void CpGrid::refineAndProvideMarkedRefinedRelations( /* Marked elements paramete
     // Max level before calling adapt.
     const int& preAdaptMaxLevel = this->maxLevel();
 
+    // Refine the marked elements. Each refinement only reads the grid to be adapted, so they are
+    // computed concurrently. Their entities get numbered below, in the order of the element indices.
+    // The auxiliary grids are created beforehand, since their construction involves the communicator.
+    std::vector<int> markedElems;
+    for (int elemIdx = 0; elemIdx < current_view_data_->size(0); ++elemIdx) {
+        if (getMark(Dune::cpgrid::Entity<0>(*current_view_data_, elemIdx, true)) == 1) {
+            markedElems.push_back(elemIdx);
+        }
+    }
+    std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>> markedElemLgrs(markedElems.size());
+    for (auto& elemLgr_ptr : markedElemLgrs) {
+        std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>> refined_data;
+        elemLgr_ptr = std::make_shared<Dune::cpgrid::CpGridData>(refined_data);
+    }
+    using RefinementType = decltype(current_view_data_->refineSingleCell(cells_per_dim_vec[0], 0));
+    std::vector<std::optional<RefinementType>> refinements(markedElems.size());
+    std::exception_ptr refinement_error;
+#pragma omp parallel for schedule(dynamic)
+    for (std::size_t marked = 0; marked < markedElems.size(); ++marked) {
+        const int elemIdx = markedElems[marked];
+        const auto& shiftedLevel = assignRefinedLevel[elemIdx] - preAdaptMaxLevel-1;
+        try {
+            refinements[marked].emplace(current_view_data_->refineSingleCell(cells_per_dim_vec[shiftedLevel], elemIdx,
+                                                                             markedElemLgrs[marked]));
+        }
+        catch (...) {
+#pragma omp critical
+            refinement_error = std::current_exception();
+        }
+    }
+    if (refinement_error) {
+        std::rethrow_exception(refinement_error);
+    }
+
+    std::size_t marked = 0;
     for (int elemIdx = 0; elemIdx < current_view_data_->size(0); ++elemIdx) {
         const auto& element = Dune::cpgrid::Entity<0>(*current_view_data_, elemIdx, true);
         // When the element is marked with 0 ("doing nothing"), it will appear in the adapted grid with same geometrical features (center, volume).
@@ -2726,14 +3366,14 @@ void CpGrid::refineAndProvideMarkedRefinedRelations( /* Marked elements paramete
             assert(markedElemLevel > preAdaptMaxLevel);
             // Shift the markedElemRefinedLevel to access data containers
             const auto& shiftedLevel = markedElemLevel - preAdaptMaxLevel-1;
-            // Build auxiliary LGR for the refinement of this element
+            // Auxiliary LGR for the refinement of this element
+            assert(markedElems[marked] == elemIdx);
             const auto& [elemLgr_ptr,
                          parentCorners_to_equivalentRefinedCorners,
                          parentFace_to_itsRefinedFaces,
                          parentCell_to_itsRefinedCells,
                          refinedFace_to_itsParentFace,
-                         refinedCell_to_itsParentCell]
-                = current_view_data_->refineSingleCell(cells_per_dim_vec[shiftedLevel], elemIdx);
+                         refinedCell_to_itsParentCell] = *refinements[marked++];
             markedElem_to_itsLgr[ elemIdx ] = elemLgr_ptr;
 
             const auto& childrenCount = cells_per_dim_vec[shiftedLevel][0]*cells_per_dim_vec[shiftedLevel][1]*cells_per_dim_vec[shiftedLevel][2];
@@ -2767,9 +3407,9 @@ void CpGrid::refineAndProvideMarkedRefinedRelations( /* Marked elements paramete
 }
 
 std::tuple<std::vector<std::vector<std::array<int,2>>>, std::vector<std::vector<int>>, std::vector<std::array<int,2>>, std::vector<int>>
-CpGrid::defineChildToParentAndIdxInParentCell(const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+CpGrid::defineChildToParentAndIdxInParentCell(const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                               const std::vector<int>& refined_cell_count_vec,
-                                              const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                              const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                               const int& cell_count) const
 {
     // If the (level zero) grid has been distributed, then the preAdaptGrid is data_[0]. Otherwise, preApaptGrid is current_view_data_.
@@ -2840,11 +3480,11 @@ CpGrid::defineChildToParentAndIdxInParentCell(const std::map<std::array<int,2>,s
 }
 
 std::pair<std::vector<std::vector<int>>, std::vector<std::array<int,2>>>
-CpGrid::defineLevelToLeafAndLeafToLevelCells(const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+CpGrid::defineLevelToLeafAndLeafToLevelCells(const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCell_to_refinedLevelAndRefinedCell,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
                                              const std::vector<int>& refined_cell_count_vec,
-                                             const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCell_to_adaptedCell,
-                                             const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                             const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCell_to_adaptedCell,
+                                             const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
                                              const int& cell_count) const
 {
     // If the (level zero) grid has been distributed, then the preAdaptGrid is data_[0]. Otherwise, preApaptGrid is current_view_data_.
@@ -2883,10 +3523,10 @@ CpGrid::defineLevelToLeafAndLeafToLevelCells(const std::map<std::array<int,2>,st
     return std::make_pair<std::vector<std::vector<int>>, std::vector<std::array<int,2>>>(std::move(refined_level_to_leaf_cells_vec), std::move(leaf_to_level_cells));
 }
 
-void CpGrid::identifyRefinedCornersPerLevel(std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                            std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
+void CpGrid::identifyRefinedCornersPerLevel(cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                            cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
                                             std::vector<int>& refined_corner_count_vec,
-                                            std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                            cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                             const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                             const std::vector<int>& assignRefinedLevel,
                                             const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
@@ -3058,8 +3698,8 @@ void CpGrid::identifyRefinedCornersPerLevel(std::map<std::array<int,2>,std::arra
     } // end-elem-for-loop
 }
 
-void CpGrid::identifyRefinedFacesPerLevel(std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
-                                          std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+void CpGrid::identifyRefinedFacesPerLevel(cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                          cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
                                           std::vector<int>& refined_face_count_vec,
                                           const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                           const std::vector<int>& assignRefinedLevel,
@@ -3132,13 +3772,13 @@ void CpGrid::identifyRefinedFacesPerLevel(std::map<std::array<int,2>,std::array<
     } // end-elem-for-loop
 }
 
-void CpGrid::identifyLeafGridCorners(std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                     std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+void CpGrid::identifyLeafGridCorners(cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                     cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                                      int& corner_count,
                                      const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                      const std::vector<int>& assignRefinedLevel,
                                      const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                     std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                     cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                      const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                      const std::vector<std::array<int,3>>& cells_per_dim_vec) const
 {
@@ -3286,8 +3926,8 @@ void CpGrid::identifyLeafGridCorners(std::map<std::array<int,2>,int>& elemLgrAnd
     } // end-elem-for-loop
 }
 
-void CpGrid::identifyLeafGridFaces(std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
-                                   std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+void CpGrid::identifyLeafGridFaces(cpgrid::IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                                   cpgrid::DenseIndexMap<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
                                    int& face_count,
                                    const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                    const std::vector<int>& assignRefinedLevel,
@@ -3356,7 +3996,7 @@ void CpGrid::identifyLeafGridFaces(std::map<std::array<int,2>,int>& elemLgrAndEl
 void CpGrid::populateLeafGridCorners(Dune::cpgrid::EntityVariableBase<cpgrid::Geometry<0,3>>& adapted_corners,
                                      const int& corner_count,
                                      const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
-                                     const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner) const
+                                     const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner) const
 {
     // If the (level zero) grid has been distributed, then the preAdaptGrid is data_[0]. Otherwise, preApaptGrid is current_view_data_.
     
@@ -3373,7 +4013,7 @@ void CpGrid::populateRefinedCorners(std::vector<Dune::cpgrid::EntityVariableBase
                                     const std::vector<int>& refined_corner_count_vec,
                                     const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                     const int& preAdaptMaxLevel,
-                                    const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner) const
+                                    const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner) const
 {
     for (std::size_t shiftedLevel = 0; shiftedLevel < refined_corner_count_vec.size(); ++shiftedLevel) {
         refined_corners_vec[shiftedLevel].resize(refined_corner_count_vec[shiftedLevel]);
@@ -3389,12 +4029,12 @@ void CpGrid::populateLeafGridFaces(Dune::cpgrid::EntityVariableBase<cpgrid::Geom
                                    Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>& mutable_face_normals,
                                    Opm::SparseTable<int>& adapted_face_to_point,
                                    const int& face_count,
-                                   const std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
-                                   const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                   const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                   const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                                   const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                   const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                    const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                    const std::vector<int>& assignRefinedLevel,
-                                   const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                   const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                    const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                    const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                    const int& preAdaptMaxLevel) const
@@ -3481,13 +4121,13 @@ void CpGrid::populateRefinedFaces(std::vector<Dune::cpgrid::EntityVariableBase<c
                                   std::vector<Dune::cpgrid::EntityVariableBase<Dune::FieldVector<double,3>>>& mutable_refined_face_normals_vec,
                                   std::vector<Opm::SparseTable<int>>& refined_face_to_point_vec,
                                   const std::vector<int>& refined_face_count_vec,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                  const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                   const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                   const int& preAdaptMaxLevel,
                                   const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                  const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner) const
+                                  const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner) const
 {
     for (std::size_t shiftedLevel = 0; shiftedLevel < refined_face_count_vec.size(); ++shiftedLevel) {
 
@@ -3566,15 +4206,15 @@ void CpGrid::populateLeafGridCells(Dune::cpgrid::EntityVariableBase<cpgrid::Geom
                                    const int& cell_count,
                                    cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                    cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
-                                   const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
-                                   const std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                                   const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                   const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
                                    const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                    const Dune::cpgrid::DefaultGeometryPolicy& adapted_geometries,
-                                   const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                   const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                   const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                   const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                    const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                    const std::vector<int>& assignRefinedLevel,
-                                   const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                   const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                    const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                    const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                    const int& preAdaptMaxLevel) const
@@ -3684,7 +4324,7 @@ void CpGrid::populateLeafGridCells(Dune::cpgrid::EntityVariableBase<cpgrid::Geom
 
         // Create a pointer to the first element of "adapted_cell_to_point" (required as the fourth argement to construct a Geometry<3,3> type object).
         int* indices_storage_ptr = adapted_cell_to_point[cell].data();
-        adapted_cells[cell] = cpgrid::Geometry<3,3>(cellGeom.center(), cellGeom.volume(), allCorners, indices_storage_ptr);
+        adapted_cells[cell] = cpgrid::Geometry<3,3>(cellGeom.center(), cellGeom.volume(), *allCorners, indices_storage_ptr);
     } // adapted_cells
 
     // Adapted/Leaf-grid-view face to cell.
@@ -3698,16 +4338,16 @@ void CpGrid::populateRefinedCells(std::vector<Dune::cpgrid::EntityVariableBase<c
                                   const std::vector<int>& refined_cell_count_vec,
                                   std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
                                   std::vector<cpgrid::OrientedEntityTable<1,0>>& refined_face_to_cell_vec,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
                                   const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                   const std::vector<Dune::cpgrid::DefaultGeometryPolicy>& refined_geometries_vec,
-                                  const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                  const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                  const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                   const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                   const std::vector<int>& assignRefinedLevel,
                                   const int& preAdaptMaxLevel,
-                                  const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                  const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                   const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                   const std::vector<std::array<int,3>>&  cells_per_dim_vec) const
 {   
@@ -3718,6 +4358,7 @@ void CpGrid::populateRefinedCells(std::vector<Dune::cpgrid::EntityVariableBase<c
         refined_cell_to_point_vec[shiftedLevel].resize(refined_cell_count_vec[shiftedLevel]);
         refined_global_cell_vec[shiftedLevel].resize(refined_cell_count_vec[shiftedLevel]);
 
+        // Placeholder corners, adapt() rebinds the cells to the corners of the level grid.
         const auto& allLevelCorners = refined_geometries_vec[shiftedLevel].geomVector(std::integral_constant<int,3>());
 
         for (int cell = 0; cell < refined_cell_count_vec[shiftedLevel]; ++cell) {
@@ -3805,7 +4446,7 @@ void CpGrid::populateRefinedCells(std::vector<Dune::cpgrid::EntityVariableBase<c
 
             // Create a pointer to the first element of "refined_cell_to_point" (required as the fourth argement to construct a Geometry<3,3> type object).
             int* indices_storage_ptr = refined_cell_to_point_vec[shiftedLevel][cell].data();
-            refined_cells_vec[shiftedLevel][cell] = cpgrid::Geometry<3,3>(elemLgrGeom.center(), elemLgrGeom.volume(), allLevelCorners, indices_storage_ptr);
+            refined_cells_vec[shiftedLevel][cell] = cpgrid::Geometry<3,3>(elemLgrGeom.center(), elemLgrGeom.volume(), *allLevelCorners, indices_storage_ptr);
         } // refined_cells
         // Refined face to cell.
         refined_cell_to_face_vec[shiftedLevel].makeInverseRelation(refined_face_to_cell_vec[shiftedLevel]);
@@ -3829,18 +4470,18 @@ void CpGrid::setRefinedLevelGridsGeometries( /* Refined corner arguments */
                                              std::vector<cpgrid::OrientedEntityTable<0,1>>& refined_cell_to_face_vec,
                                              std::vector<cpgrid::OrientedEntityTable<1,0>>& refined_face_to_cell_vec,
                                              /* Auxiliary arguments */
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                             const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCell_to_elemLgrAndElemLgrCell,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedFace_to_elemLgrAndElemLgrFace,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& refinedLevelAndRefinedCorner_to_elemLgrAndElemLgrCorner,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrFace_to_refinedLevelAndRefinedFace,
                                              const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                              const std::vector<Dune::cpgrid::DefaultGeometryPolicy>& refined_geometries_vec,
-                                             const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                             const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                              const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                              const std::vector<int>& assignRefinedLevel,
                                              const int& preAdaptMaxLevel,
-                                             const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                             const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                              const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                              const std::vector<std::array<int,3>>&  cells_per_dim_vec) const
 {
@@ -3901,17 +4542,17 @@ void CpGrid::updateLeafGridViewGeometries( /* Leaf grid View Corners arguments *
                                            cpgrid::OrientedEntityTable<0,1>& adapted_cell_to_face,
                                            cpgrid::OrientedEntityTable<1,0>& adapted_face_to_cell,
                                            /* Auxiliary arguments */
-                                           const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
-                                           const std::unordered_map<int,std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
-                                           const std::unordered_map<int,std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
-                                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrFace_to_adaptedFace,
+                                           const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                                           const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedFace_to_elemLgrAndElemLgrFace,
+                                           const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCell_to_elemLgrAndElemLgrCell,
+                                           const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrFace_to_adaptedFace,
                                            const std::vector<std::vector<std::pair<int, std::vector<int>>>>& faceInMarkedElemAndRefinedFaces,
                                            const Dune::cpgrid::DefaultGeometryPolicy& adapted_geometries,
-                                           const std::map<std::array<int,2>,int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
-                                           const std::map<std::array<int,2>, std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
+                                           const cpgrid::IndexPairMap<int>& elemLgrAndElemLgrCorner_to_adaptedCorner,
+                                           const cpgrid::IndexPairMap<std::array<int,2>>& vanishedRefinedCorner_to_itsLastAppearance,
                                            const std::vector<std::shared_ptr<Dune::cpgrid::CpGridData>>& markedElem_to_itsLgr,
                                            const std::vector<int>& assignRefinedLevel,
-                                           const std::map<std::array<int,2>,int>& markedElemAndEquivRefinedCorn_to_corner,
+                                           const cpgrid::IndexPairMap<int>& markedElemAndEquivRefinedCorn_to_corner,
                                            const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
                                            const std::vector<std::array<int,3>>& cells_per_dim_vec,
                                            const int& preAdaptMaxLevel) const
@@ -3957,8 +4598,8 @@ void CpGrid::updateLeafGridViewGeometries( /* Leaf grid View Corners arguments *
 }
 
 void CpGrid::updateCornerHistoryLevels(const std::vector<std::vector<std::array<int,2>>>& cornerInMarkedElemWithEquivRefinedCorner,
-                                       const std::map<std::array<int,2>,std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
-                                       const std::unordered_map<int,std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
+                                       const cpgrid::IndexPairMap<std::array<int,2>>& elemLgrAndElemLgrCorner_to_refinedLevelAndRefinedCorner,
+                                       const cpgrid::DenseIndexMap<std::array<int,2>>& adaptedCorner_to_elemLgrAndElemLgrCorner,
                                        const int& corner_count,
                                        const std::vector<std::array<int,2>>& preAdaptGrid_corner_history,
                                        const int& preAdaptMaxLevel,
@@ -1,8 +1,10 @@
 #include"config.h"
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <map>
 #include <set>
+#include <type_traits>
 #include <vector>
 #include <utility>
 #include"CpGridData.hpp"
@@ -33,7 +35,8 @@ CpGridData::CpGridData(const CpGridData& g)
     : index_set_(new IndexSet(g.cell_to_face_.size(), g.geomVector<3>().size())),
       local_id_set_(new IdSet(*this)),
       global_id_set_(new LevelGlobalIdSet(local_id_set_, this)), partition_type_indicator_(new PartitionTypeIndicator(*this)),
-      ccobj_(g.ccobj_), use_unique_boundary_ids_(g.use_unique_boundary_ids_)
+      ccobj_(g.ccobj_), use_unique_boundary_ids_(g.use_unique_boundary_ids_),
+      distributed_preprocessing_(g.distributed_preprocessing_)
 #if HAVE_MPI
     , cell_comm_(g.ccobj_)
 #endif
@@ -47,7 +50,8 @@ CpGridData::CpGridData(std::vector<std::shared_ptr<CpGridData>>& data)
     : index_set_(new IndexSet()), local_id_set_(new IdSet(*this)),
       global_id_set_(new LevelGlobalIdSet(local_id_set_, this)), partition_type_indicator_(new PartitionTypeIndicator(*this)),
       level_data_ptr_(),
-      ccobj_(Dune::MPIHelper::getCommunicator()), use_unique_boundary_ids_(false)
+      ccobj_(Dune::MPIHelper::getCommunicator()), use_unique_boundary_ids_(false),
+      distributed_preprocessing_(false)
 #if HAVE_MPI
     , cell_comm_(Dune::MPIHelper::getCommunicator())
 #endif
@@ -62,7 +66,8 @@ CpGridData::CpGridData(MPIHelper::MPICommunicator comm,  std::vector<std::shared
     : index_set_(new IndexSet()), local_id_set_(new IdSet(*this)),
       global_id_set_(new LevelGlobalIdSet(local_id_set_, this)), partition_type_indicator_(new PartitionTypeIndicator(*this)),
       level_data_ptr_(),
-      ccobj_(comm), use_unique_boundary_ids_(false)
+      ccobj_(comm), use_unique_boundary_ids_(false),
+      distributed_preprocessing_(false)
 #if HAVE_MPI
     , cell_comm_(comm)
 #endif
@@ -100,9 +105,7 @@ void freeInterfaces(std::tuple<InterfaceMap,InterfaceMap,InterfaceMap,InterfaceM
 CpGridData::~CpGridData()
 {
 #if HAVE_MPI
-    // code deactivated, because users cannot access face indices and therefore
-    // communication on faces makes no sense!
-    //freeInterfaces(face_interfaces_);
+    freeInterfaces(face_interfaces_);
     freeInterfaces(point_interfaces_);
 #endif
 }
@@ -144,6 +147,24 @@ void CpGridData::computeUniqueBoundaryIds()
 #endif
 }
 
+CellCommunicationPlan& CpGridData::cellCommunicationPlan(InterfaceType iftype)
+{
+#if HAVE_MPI
+    auto& plan = cell_communication_plans_.at(iftype);
+    if (!plan) {
+        plan = std::make_unique<CellCommunicationPlan>(ccobj_,
+                                                       getInterface(iftype, cell_interfaces_).interfaces(),
+                                                       size(0));
+    }
+    return *plan;
+#else
+    // Without MPI there is nothing to exchange.
+    (void) iftype;
+    static CellCommunicationPlan plan;
+    return plan;
+#endif
+}
+
 int CpGridData::size(int codim) const
 {
     switch (codim) {
@@ -559,7 +580,7 @@ struct CellGeometryHandle
             buffer.read(pos[i]);
 
         buffer.read(vol);
-        scatterCont_[t] = Geom(pos, vol, pointGeom_, cell2Points_[t.index()].data());
+        scatterCont_[t] = Geom(pos, vol, *pointGeom_, cell2Points_[t.index()].data());
         double isAquifer;
         buffer.read(isAquifer);
         if (isAquifer == 1.0)
@@ -948,7 +969,8 @@ struct AttributeDataHandle
 
     bool fixedSize()
     {
-        return true;
+        // Cells always have 8 corners, but the number of faces varies.
+        return std::is_same_v<T, std::vector<std::array<int,8> > >;
     }
     std::size_t size(std::size_t i)
     {
@@ -1514,6 +1536,7 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
                                       const std::vector<int>& /* cell_part */)
 {
 #if HAVE_MPI
+    Opm::PhaseTimings::Scope phase(setup_timings_.get(), "distributeGlobalGrid");
     auto& cell_indexset = cellIndexSet();
     auto& cell_remote_indices = cellRemoteIndices();
     // setup the remote indices.
@@ -1603,6 +1626,7 @@ void CpGridData::distributeGlobalGrid(CpGrid& grid,
     computePointPartitionType();
    
     computeCommunicationInterfaces(noExistingPoints);   
+    phase.setItems(size(0));
 #else // #if HAVE_MPI
     static_cast<void>(grid);
     static_cast<void>(view_data);
@@ -1654,9 +1678,88 @@ void CpGridData::computePointPartitionType()
 #endif
 }
 
+void CpGridData::buildIntersectionTable()
+{
+    auto table = std::make_unique<cpgrid::IntersectionTable>();
+    const int num_cells = cell_to_face_.size();
+    table->cell_start.resize(num_cells + 1);
+    table->cell_start[0] = 0;
+    for (int cell = 0; cell < num_cells; ++cell) {
+        table->cell_start[cell + 1] = table->cell_start[cell] + cell_to_face_[EntityRep<0>(cell, true)].size();
+    }
+    const int num_entries = table->cell_start.back();
+    table->neighbor.resize(num_entries);
+    table->face.resize(num_entries);
+    table->index_in_inside.resize(num_entries);
+    table->boundary.resize(num_entries);
+
+    // The same values as computed by Intersection::update() and
+    // Intersection::indexInInside().
+    constexpr int invalid = std::numeric_limits<int>::max();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int cell = 0; cell < num_cells; ++cell) {
+        int entry = table->cell_start[cell];
+        for (const auto& face : cell_to_face_[EntityRep<0>(cell, true)]) {
+            const auto cells_of_face = face_to_cell_[face];
+            const bool boundary = cells_of_face.size() == 1;
+            int neighbor = invalid;
+            if (!boundary && cells_of_face[0].index() != invalid && cells_of_face[1].index() != invalid) {
+                neighbor = cells_of_face[0].index() == cell ? cells_of_face[1].index() : cells_of_face[0].index();
+            }
+            const int normal_is_in = face.orientation() ? 0 : 1;
+            int index_in_inside = -1;
+            switch (face_tag_[face]) {
+            case I_FACE:
+                index_in_inside = 1 - normal_is_in;
+                break;
+            case J_FACE:
+                index_in_inside = 3 - normal_is_in;
+                break;
+            case K_FACE:
+                index_in_inside = 5 - normal_is_in;
+                break;
+            default:
+                break;
+            }
+            table->neighbor[entry] = neighbor;
+            table->face[entry] = face.index();
+            table->index_in_inside[entry] = index_in_inside;
+            table->boundary[entry] = boundary;
+            ++entry;
+        }
+    }
+    intersection_table_ = std::move(table);
+}
+
+void CpGridData::clearCommunicationInterfaces()
+{
+#if HAVE_MPI
+    std::get<0>(cell_interfaces_).free();
+    std::get<1>(cell_interfaces_).free();
+    std::get<2>(cell_interfaces_).free();
+    std::get<3>(cell_interfaces_).free();
+    std::get<4>(cell_interfaces_).free();
+    for (auto* interfaces : {&face_interfaces_, &point_interfaces_}) {
+        freeInterfaces(*interfaces);
+        std::get<0>(*interfaces).clear();
+        std::get<1>(*interfaces).clear();
+        std::get<2>(*interfaces).clear();
+        std::get<3>(*interfaces).clear();
+        std::get<4>(*interfaces).clear();
+    }
+    for (auto& plan : cell_communication_plans_) {
+        plan.reset();
+    }
+#endif
+}
+
 void CpGridData::computeCommunicationInterfaces([[maybe_unused]] int noExistingPoints)
 {
 #if HAVE_MPI
+    Opm::PhaseTimings::Scope phase(setup_timings_.get(), "computeCommunicationInterfaces");
+    phase.setItems(size(0));
     // Compute the interface information for cells
     std::get<InteriorBorder_All_Interface>(cell_interfaces_)
         .build(cellRemoteIndices(), EnumItem<AttributeSet, AttributeSet::owner>(),
@@ -1677,22 +1780,21 @@ void CpGridData::computeCommunicationInterfaces([[maybe_unused]] int noExistingP
     Communicator comm(all_all_cell_interface.communicator(),
                       all_all_cell_interface.interfaces());
 
-    /*
-    // code deactivated, because users cannot access face indices and therefore
-    // communication on faces makes no sense!
-    std::vector<std::map<int,char> > face_attributes(noExistingFaces);
+    // The faces of a cell are stored in the same order on all processes.
+    std::vector<std::map<int,char> > face_attributes(face_to_cell_.size());
     AttributeDataHandle<Opm::SparseTable<EntityRep<1> > >
-    face_handle(ccobj_.rank(), *partition_type_indicator_,
-    face_attributes, static_cast<Opm::SparseTable<EntityRep<1> >&>(cell_to_face_),
-    *this);
-    if( std::get<All_All_Interface>(cell_interfaces_).interfaces().size() )
+        face_handle(ccobj_.rank(), *partition_type_indicator_,
+                    face_attributes, static_cast<const Opm::SparseTable<EntityRep<1> >&>(cell_to_face_),
+                    *this);
+    if( static_cast<const Dune::Interface&>(std::get<All_All_Interface>(cell_interfaces_))
+        .interfaces().size() )
     {
-    comm.forward(face_handle);
+        comm.forward(face_handle);
     }
-    createInterfaces(face_attributes, FacePartitionTypeIterator(partition_type_indicator_),
-    face_interfaces_);
+    createInterfaces(face_attributes, FacePartitionTypeIterator(partition_type_indicator_.get()),
+                     face_interfaces_);
     std::vector<std::map<int,char> >().swap(face_attributes);
-    */
+
     std::vector<std::map<int,char> > point_attributes(noExistingPoints);
     AttributeDataHandle<std::vector<std::array<int,8> > >
         point_handle(ccobj_.rank(), *partition_type_indicator_,
@@ -2345,7 +2447,18 @@ CpGridData::refineSingleCell(const std::array<int,3>& cells_per_dim, const int&
 {
     // To store the LGR/refined-grid.
     std::vector<std::shared_ptr<CpGridData>> refined_data;
-    std::shared_ptr<CpGridData> refined_grid_ptr = std::make_shared<CpGridData>(refined_data); // ccobj_
+    return refineSingleCell(cells_per_dim, parent_idx, std::make_shared<CpGridData>(refined_data)); // ccobj_
+}
+
+std::tuple< const std::shared_ptr<CpGridData>,
+            const std::vector<std::array<int,2>>,                // parent_to_refined_corners(~boundary_old_to_new_corners)
+            const std::vector<std::tuple<int,std::vector<int>>>, // parent_to_children_faces (~boundary_old_to_new_faces)
+            const std::tuple<int, std::vector<int>>,             // parent_to_children_cells
+            const std::vector<std::array<int,2>>,                // child_to_parent_faces
+            const std::vector<std::array<int,2>>>                // child_to_parent_cells
+CpGridData::refineSingleCell(const std::array<int,3>& cells_per_dim, const int& parent_idx,
+                             const std::shared_ptr<CpGridData>& refined_grid_ptr) const
+{
     auto& refined_grid = *refined_grid_ptr;
     DefaultGeometryPolicy& refined_geometries = refined_grid.geometry_;
     std::vector<std::array<int,8>>& refined_cell_to_point = refined_grid.cell_to_point_;
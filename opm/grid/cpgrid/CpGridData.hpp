@@ -63,8 +63,13 @@
 #endif
 
 #include <opm/grid/cpgpreprocess/preprocess.h>
+#include <opm/grid/common/GridEnums.hpp>
+#include <opm/grid/utility/PhaseTimings.hpp>
 
 #include "Entity2IndexDataHandle.hpp"
+#include "CellCommunicationPlan.hpp"
+#include "IntersectionTable.hpp"
+#include "CommunicationRequest.hpp"
 #include "CpGridDataTraits.hpp"
 //#include "DataHandleWrappers.hpp"
 //#include "GlobalIdMapping.hpp"
@@ -72,6 +77,7 @@
 
 #include <array>
 #include <initializer_list>
+#include <iosfwd>
 #include <set>
 #include <vector>
 
@@ -288,6 +294,9 @@ public:
     /// \param pinchActive If true, we will add faces between vertical cells that have only inactive cells or cells
     ///            with zero volume between them. If false these cells will not be connected.
     /// \param tolerance_unique_points Tolerance used to identify points based on their cooridinate
+    ///
+    /// Only rank 0 builds the grid. With distributed preprocessing the other
+    /// ranks take part in the processing instead, otherwise they must not call this.
     void processEclipseFormat(const grdecl& input_data,
 #if HAVE_ECL_INPUT
                               Opm::EclipseState* ecl_state,
@@ -296,6 +305,75 @@ public:
                               bool remove_ij_boundary, bool turn_normals, bool pinchActive,
                               double tolerance_unique_points);
 
+    /// Take part in the distributed preprocessing of a grid built on rank 0,
+    /// see setDistributedPreprocessing(). Does nothing on rank 0, on a single
+    /// rank or if the preprocessing is not distributed.
+    ///
+    /// Has to be called on the other ranks whenever rank 0 calls
+    /// processEclipseFormat(), which does the same on ranks other than 0.
+    void joinDistributedPreprocessing();
+
+    /// Write the topology, geometry, face tags, global cells, zcorn and aquifer
+    /// cells of the processed grid in the binary format read by loadProcessedGrid().
+    /// \param out the stream to write to, opened in binary mode.
+    void saveProcessedGrid(std::ostream& out) const;
+
+    /// Read a grid written by saveProcessedGrid() into this empty grid data,
+    /// instead of processing the Eclipse grid format.
+    /// \param in the stream to read from, opened in binary mode.
+    void loadProcessedGrid(std::istream& in);
+
+    /// Write the part of a distributed grid on this process, i.e. the processed
+    /// grid together with the global ids and the parallel index set of the cells.
+    /// \param out the stream to write to, opened in binary mode.
+    void saveDistributedGrid(std::ostream& out) const;
+
+    /// Read the part of a distributed grid written by saveDistributedGrid() on
+    /// this rank into this empty grid data, and set up the communication.
+    /// \param in the stream to read from, opened in binary mode.
+    void loadDistributedGrid(std::istream& in);
+
+    /// Renumber the cells to improve memory locality, and the faces such that
+    /// they follow their cells. All cell and face data, the global cells, the
+    /// parallel index set and the communication interfaces are updated. On a
+    /// distributed grid the global ids are kept, and owner cells stay in front
+    /// of the overlap cells if they were before. Collective on distributed grids.
+    /// Not supported for grids with LGRs.
+    /// \param ordering the method computing the new order.
+    void renumberCells(CellOrdering ordering);
+
+    /// For each cell, its index before the last renumberCells(). Empty if the
+    /// cells were never renumbered.
+    const std::vector<int>& cellRenumbering() const
+    {
+        return cell_renumbering_;
+    }
+
+    /// For each face, its index before the last renumberCells(). Empty if the
+    /// cells were never renumbered.
+    const std::vector<int>& faceRenumbering() const
+    {
+        return face_renumbering_;
+    }
+
+    /// Build the table of precomputed intersection data, which the
+    /// intersection iterators of this grid read from afterwards.
+    void buildIntersectionTable();
+
+    /// Drop the table of precomputed intersection data.
+    void clearIntersectionTable()
+    {
+        intersection_table_.reset();
+    }
+
+    /// The table of precomputed intersection data, null if not built.
+    const cpgrid::IntersectionTable* intersectionTable() const
+    {
+        assert(!intersection_table_
+               || intersection_table_->cell_start.size() == static_cast<std::size_t>(cell_to_face_.size()) + 1);
+        return intersection_table_.get();
+    }
+
     /// @brief
     ///    Extract Cartesian index triplet (i,j,k) of an active cell.
     ///
@@ -417,6 +495,16 @@ public:
     void postAdapt();
 
 private:
+    /// Read the arrays written by saveProcessedGrid() into this empty grid data.
+    void readProcessedGrid(std::istream& in);
+
+    /// Apply a permutation of the cells, given as the old index of each new cell.
+    void permuteCells(const std::vector<int>& new_to_old_cell);
+
+    /// Free the communication interfaces, such that computeCommunicationInterfaces()
+    /// can set them up anew.
+    void clearCommunicationInterfaces();
+
     /// @brief Check compatibility of number of subdivisions of neighboring LGRs.
     ///
     /// Check shared faces on boundaries of LGRs. Not optimal since the code below does not take into account
@@ -571,6 +659,20 @@ public:
                 const std::vector<std::array<int,2>>>                // child_to_parent_cells
     refineSingleCell(const std::array<int,3>& cells_per_dim, const int& parent_idx) const;
 
+    /// @brief Refine a single cell into a grid provided by the caller.
+    ///
+    /// As refineSingleCell() above, with refined_grid_ptr pointing at an empty CpGridData that gets
+    /// populated and returned. Creating a CpGridData involves the communicator. This function does not,
+    /// so different cells can be refined concurrently once their refined grids have been created.
+    std::tuple< const std::shared_ptr<CpGridData>,
+                const std::vector<std::array<int,2>>,                // parent_to_refined_corners(~boundary_old_to_new_corners)
+                const std::vector<std::tuple<int,std::vector<int>>>, // parent_to_children_faces (~boundary_old_to_new_faces)
+                const std::tuple<int, std::vector<int>>,             // parent_to_children_cells
+                const std::vector<std::array<int,2>>,                // child_to_parent_faces
+                const std::vector<std::array<int,2>>>                // child_to_parent_cells
+    refineSingleCell(const std::array<int,3>& cells_per_dim, const int& parent_idx,
+                     const std::shared_ptr<CpGridData>& refined_grid_ptr) const;
+
     /// @brief Refine a (connected block-shaped) patch of cells. Based on the patch, a Geometry<3,3> object is created and refined.
     ///
     /// @param [in] cells_per_dim            Number of (refined) cells in each direction that each parent cell should be refined to.
@@ -629,6 +731,25 @@ public:
         }
     }
 
+    /// Is the corner-point preprocessing shared among all ranks?
+    bool distributedPreprocessing() const
+    {
+        return distributed_preprocessing_;
+    }
+
+    /// Set whether the corner-point preprocessing of processEclipseFormat()
+    /// is shared among all ranks of the communicator.
+    ///
+    /// Each rank processes a slab of cell rows of the model and rank 0
+    /// merges the results.  The resulting grid is identical to the one
+    /// produced by rank 0 alone.  Has to be set consistently on all ranks,
+    /// and has no effect without MPI or on a single rank.
+    /// \param distributed if true, all ranks take part in the preprocessing.
+    void setDistributedPreprocessing(bool distributed)
+    {
+        distributed_preprocessing_ = distributed;
+    }
+
     /// Return the internalized zcorn copy from the grid processing, if
     /// no cells were adjusted during the minpvprocessing this can be
     /// and empty vector.
@@ -679,6 +800,24 @@ public:
     template<class DataHandle>
     void communicate(DataHandle& data, InterfaceType iftype, CommunicationDirection dir);
 
+    /// \brief Start communicating objects for all codims on a given level
+    ///
+    /// The data is gathered and sent right away, the returned request
+    /// receives and scatters it when finished.
+    /// \param data The data handle describing the data. Has to adhere to the
+    /// Dune::DataHandleIF interface and to stay alive until the request is finished.
+    /// \param iftype The interface to use for the communication.
+    /// \param dir The direction of the communication along the interface (forward or backward).
+    template<class DataHandle>
+    CommunicationRequest<DataHandle>
+    startCommunicate(DataHandle& data, InterfaceType iftype, CommunicationDirection dir);
+
+    /// \brief Get the cached plan for exchanging fixed size cell data.
+    ///
+    /// The plan is set up on first use, which is collective.
+    /// \param iftype The interface to communicate along.
+    CellCommunicationPlan& cellCommunicationPlan(InterfaceType iftype);
+
     void computeCellPartitionType();
 
     void computePointPartitionType();
@@ -896,6 +1035,11 @@ private:
     std::vector<std::tuple<int,std::vector<int>>> parent_to_children_cells_; 
     /** Amount of children cells per parent cell in each direction. */ // {# children in x-direction, ... y-, ... z-}
     std::array<int,3> cells_per_dim_;
+    /** Whether this level grid refines a block of cells, as created by CpGrid::addLgrsUpdateLeafView(). */
+    bool refines_block_{false};
+    /** Start and end (excluded) ijk of the refined block of cells in the level zero grid. Only set if refines_block_. */
+    std::array<int,3> block_start_ijk_{};
+    std::array<int,3> block_end_ijk_{};
     // SUITABLE ONLY FOR LEAFVIEW
     /** Relation between leafview and (possible different) level(s) cell indices. */ // {level, cell index in that level}
     std::vector<std::array<int,2>> leaf_to_level_cells_;
@@ -916,6 +1060,9 @@ private:
     // Boundary information (optional).
     bool use_unique_boundary_ids_;
 
+    /// Whether all ranks take part in processEclipseFormat().
+    bool distributed_preprocessing_;
+
     /// This vector contains zcorn values from the initialization
     /// process where a CpGrid instance has been created from
     /// cornerpoint input zcorn and coord. During the initialization
@@ -926,6 +1073,20 @@ private:
     /// \brief Sorted vector of aquifer cell indices.
     std::vector<int> aquifer_cells_;
 
+    /// \brief Old index of each cell after the last renumbering.
+    std::vector<int> cell_renumbering_;
+
+    /// \brief Old index of each face after the last renumbering.
+    std::vector<int> face_renumbering_;
+
+    /// \brief Precomputed intersection data, null unless requested.
+    std::unique_ptr<cpgrid::IntersectionTable> intersection_table_;
+
+    /// \brief Where the phases of the setup are recorded, shared with the owning CpGrid.
+    ///
+    /// Null for grids not owned by a CpGrid, nothing is recorded then.
+    std::shared_ptr<Opm::PhaseTimings> setup_timings_;
+
 #if HAVE_MPI
 
     /// \brief OwnerOverlap communication for cells
@@ -933,17 +1094,19 @@ private:
 
     /// \brief Communication interface for the cells.
     std::tuple<Interface,Interface,Interface,Interface,Interface> cell_interfaces_;
-    /*
-    // code deactivated, because users cannot access face indices and therefore
-    // communication on faces makes no sense!
-    /// \brief Interface from interior and border to interior and border for the faces.
+    /// \brief Communication interfaces for the faces.
     std::tuple<InterfaceMap,InterfaceMap,InterfaceMap,InterfaceMap,InterfaceMap>
     face_interfaces_;
-    */
     /// \brief Interface from interior and border to interior and border for the faces.
     std::tuple<InterfaceMap,InterfaceMap,InterfaceMap,InterfaceMap,InterfaceMap>
     point_interfaces_;
 
+    /// \brief Message buffers reused by the split-phase communications.
+    std::unique_ptr<CommunicationBufferPool> communication_buffers_;
+
+    /// \brief Communication plans for cell data, one per interface type, set up on demand.
+    std::array<std::unique_ptr<CellCommunicationPlan>, 5> cell_communication_plans_;
+
 #endif
 
     // Return the geometry vector corresponding to the given codim.
@@ -1022,6 +1185,11 @@ void CpGridData::communicate(DataHandle& data, InterfaceType iftype,
         Entity2IndexDataHandle<DataHandle, 0> data_wrapper(*this, data);
         communicateCodim<0>(data_wrapper, dir, getInterface(iftype, cell_interfaces_));
     }
+    if(data.contains(3,1))
+    {
+        Entity2IndexDataHandle<DataHandle, 1> data_wrapper(*this, data);
+        communicateCodim<1>(data_wrapper, dir, getInterface(iftype, face_interfaces_));
+    }
     if(data.contains(3,3))
     {
         Entity2IndexDataHandle<DataHandle, 3> data_wrapper(*this, data);
@@ -1034,6 +1202,45 @@ void CpGridData::communicate(DataHandle& data, InterfaceType iftype,
     (void) dir;
 #endif
 }
+
+template<class DataHandle>
+CommunicationRequest<DataHandle>
+CpGridData::startCommunicate(DataHandle& data, InterfaceType iftype,
+                             CommunicationDirection dir)
+{
+    CommunicationRequest<DataHandle> request;
+#if HAVE_MPI
+    if (!communication_buffers_)
+        communication_buffers_ = std::make_unique<CommunicationBufferPool>(ccobj_);
+    if(data.contains(3,0))
+    {
+        using Wrapper = Entity2IndexDataHandle<DataHandle, 0>;
+        request.cells_ = std::make_unique<IndexedExchange<Wrapper>>(
+            getInterface(iftype, cell_interfaces_).interfaces(), dir,
+            Wrapper(*this, data), *communication_buffers_);
+    }
+    if(data.contains(3,1))
+    {
+        using Wrapper = Entity2IndexDataHandle<DataHandle, 1>;
+        request.faces_ = std::make_unique<IndexedExchange<Wrapper>>(
+            getInterface(iftype, face_interfaces_), dir,
+            Wrapper(*this, data), *communication_buffers_);
+    }
+    if(data.contains(3,3))
+    {
+        using Wrapper = Entity2IndexDataHandle<DataHandle, 3>;
+        request.points_ = std::make_unique<IndexedExchange<Wrapper>>(
+            getInterface(iftype, point_interfaces_), dir,
+            Wrapper(*this, data), *communication_buffers_);
+    }
+#else
+    // Suppress warnings for unused arguments.
+    (void) data;
+    (void) iftype;
+    (void) dir;
+#endif
+    return request;
+}
 }}
 
 #if HAVE_MPI
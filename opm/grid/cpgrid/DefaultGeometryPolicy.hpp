@@ -38,6 +38,13 @@ along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "EntityRep.hpp"
 
+#include <dune/common/fvector.hh>
+
+#include <array>
+#include <cassert>
+#include <memory>
+#include <vector>
+
 namespace Dune
 {
 
@@ -90,13 +97,19 @@ public:
     }
 
     /// \brief Get cell geometry
+    ///
+    /// Not available while the cell geometry is compact.
     std::shared_ptr<const EntityVariable<cpgrid::Geometry<3, 3>, 0>> geomVector(const std::integral_constant<int, 0>&) const
     {
+        assert(!hasCompactCellGeometry());
         return cell_geom_ptr_;
     }
     /// \brief Get cell geometry
+    ///
+    /// Restores the regular storage if the cell geometry is compact.
     std::shared_ptr<EntityVariable<cpgrid::Geometry<3, 3>, 0>> geomVector(const std::integral_constant<int, 0>&)
     {
+        expandCellGeometry();
         return cell_geom_ptr_;
     }
     /// \brief Get face geometry
@@ -125,10 +138,47 @@ public:
         return point_geom_ptr_;
     }
 
+    /// \brief Switch the cell geometry to compact storage.
+    ///
+    /// Only the centroids and volumes of the cells are kept, in flat
+    /// arrays, and the cell geometries are built on demand by
+    /// cellGeometry() as views of the corners. This takes about half
+    /// the memory of the geometry objects, which are released.
+    /// \param cell_to_point The 8 corner indices of each cell. Must
+    ///                      outlive the compact storage.
+    void compactCellGeometry(const std::vector<std::array<int, 8>>& cell_to_point);
+
+    /// \brief Restore the regular storage of the cell geometry.
+    void expandCellGeometry();
+
+    /// \brief Reorder the compact cell geometry, keeping it compact.
+    /// \param new_to_old_cell The previous index of each cell. The cell to
+    ///                        point mapping must have been reordered alike.
+    void permuteCompactCellGeometry(const std::vector<int>& new_to_old_cell);
+
+    /// \brief Is the cell geometry stored compactly?
+    bool hasCompactCellGeometry() const
+    {
+        return cell_to_point_ != nullptr;
+    }
+
+    /// \brief Get the geometry of a cell, with either storage.
+    cpgrid::Geometry<3, 3> cellGeometry(int cell) const;
+
+    /// \brief Get the centroid of a cell, with either storage.
+    const FieldVector<double, 3>& cellCentroid(int cell) const;
+
+    /// \brief Get the volume of a cell, with either storage.
+    double cellVolume(int cell) const;
+
 private:
     std::shared_ptr<EntityVariable<cpgrid::Geometry<3, 3>, 0>> cell_geom_ptr_;
     std::shared_ptr<EntityVariable<cpgrid::Geometry<2, 3>, 1>> face_geom_ptr_;
     std::shared_ptr<EntityVariable<cpgrid::Geometry<0, 3>, 3>> point_geom_ptr_;
+    // Compact cell geometry, used when cell_to_point_ is set.
+    std::vector<FieldVector<double, 3>> cell_centroids_;
+    std::vector<double> cell_volumes_;
+    const std::vector<std::array<int, 8>>* cell_to_point_ = nullptr;
 };
 
 
@@ -0,0 +1,191 @@
+//===========================================================================
+//
+// File: DenseIndexMap.hpp
+//
+// Created: October 2026
+//
+// $Date$
+//
+// $Revision$
+//
+//===========================================================================
+
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DENSEINDEXMAP_HEADER
+#define OPM_DENSEINDEXMAP_HEADER
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Map from non-negative indices to values, stored in a vector indexed by key.
+///
+/// Replaces std::map/std::unordered_map for keys that are entity indices, which
+/// are dense by construction. Lookups and insertions are O(1). The storage grows
+/// to the largest inserted key. The interface mimics the subset of std::map that is
+/// used in CpGrid::adapt(): find() returns a pointer to the (key, value) pair, and
+/// end() is the null pointer.
+template <class T>
+class DenseIndexMap
+{
+public:
+    using key_type = int;
+    using value_type = std::pair<int, T>;
+
+    /// \brief Value of key, default-constructed if the key is not in the map.
+    T& operator[](int key)
+    {
+        if (key >= static_cast<int>(entries_.size())) {
+            entries_.resize(key + 1, value_type(-1, T{}));
+        }
+        auto& entry = entries_[key];
+        entry.first = key;
+        return entry.second;
+    }
+
+    /// \brief Value of key, throws std::out_of_range if the key is not in the map.
+    const T& at(int key) const
+    {
+        const auto* entry = find(key);
+        if (!entry) {
+            OPM_THROW(std::out_of_range, "Key " + std::to_string(key) + " is not in the DenseIndexMap.");
+        }
+        return entry->second;
+    }
+
+    /// \brief (key, value) pair, or end() if the key is not in the map.
+    const value_type* find(int key) const
+    {
+        if (key < 0 || key >= static_cast<int>(entries_.size()) || entries_[key].first != key) {
+            return end();
+        }
+        return &entries_[key];
+    }
+
+    const value_type* end() const
+    {
+        return nullptr;
+    }
+
+    std::size_t count(int key) const
+    {
+        return find(key) != end();
+    }
+
+    void insert_or_assign(int key, const T& value)
+    {
+        (*this)[key] = value;
+    }
+
+    /// \brief Allocate storage for keys smaller than size.
+    void reserve(std::size_t size)
+    {
+        entries_.reserve(size);
+    }
+
+private:
+    // Entry with first == -1 is not in the map.
+    std::vector<value_type> entries_;
+};
+
+/// \brief Map from pairs of indices {first, second} to values, with first >= -1 and second >= 0.
+///
+/// In CpGrid::adapt(), keys are {marked element, entity index in the refinement of that
+/// element}, where -1 stands for entities of the grid being adapted, or {level, entity index
+/// on that level}. Each first index owns a DenseIndexMap of the second index.
+template <class T>
+class IndexPairMap
+{
+public:
+    using key_type = std::array<int,2>;
+    using value_type = typename DenseIndexMap<T>::value_type;
+
+    /// \brief Value of key, default-constructed if the key is not in the map.
+    T& operator[](const key_type& key)
+    {
+        const std::size_t row = key[0] + 1;
+        if (row >= rows_.size()) {
+            rows_.resize(row + 1);
+        }
+        return rows_[row][key[1]];
+    }
+
+    /// \brief Value of key, throws std::out_of_range if the key is not in the map.
+    const T& at(const key_type& key) const
+    {
+        const auto* entry = find(key);
+        if (!entry) {
+            OPM_THROW(std::out_of_range, "Key {" + std::to_string(key[0]) + ", " + std::to_string(key[1])
+                      + "} is not in the IndexPairMap.");
+        }
+        return entry->second;
+    }
+
+    /// \brief (second index, value) pair, or end() if the key is not in the map.
+    const value_type* find(const key_type& key) const
+    {
+        const std::size_t row = key[0] + 1;
+        if (key[0] < -1 || row >= rows_.size()) {
+            return end();
+        }
+        return rows_[row].find(key[1]);
+    }
+
+    const value_type* end() const
+    {
+        return nullptr;
+    }
+
+    std::size_t count(const key_type& key) const
+    {
+        return find(key) != end();
+    }
+
+    void insert_or_assign(const key_type& key, const T& value)
+    {
+        (*this)[key] = value;
+    }
+
+    /// \brief Allocate storage for first indices smaller than size-1.
+    void reserve(std::size_t size)
+    {
+        rows_.reserve(size + 1);
+    }
+
+private:
+    // rows_[first + 1] maps second indices to values.
+    std::vector<DenseIndexMap<T>> rows_;
+};
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_DENSEINDEXMAP_HEADER
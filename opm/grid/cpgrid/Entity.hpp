@@ -163,7 +163,7 @@ public:
     }
 
     /// @brief Return the geometry of the entity (does not depend on its orientation).
-    const Geometry& geometry() const;
+    Geometry geometry() const;
 
     /// @brief Return the level of the entity in the grid hierarchy. Level = 0 represents the coarsest grid.
     int level() const;
@@ -380,9 +380,13 @@ unsigned int Entity<codim>::subEntities ( const unsigned int cc ) const
 }
 
 template <int codim>
-const typename Entity<codim>::Geometry& Entity<codim>::geometry() const
+typename Entity<codim>::Geometry Entity<codim>::geometry() const
 {
-    return pgrid_->geomVector<codim>()[*this];
+    if constexpr (codim == 0) {
+        return pgrid_->geometry_.cellGeometry(this->index());
+    } else {
+        return pgrid_->geomVector<codim>()[*this];
+    }
 }
 
 template <int codim>
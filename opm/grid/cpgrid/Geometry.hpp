@@ -415,6 +415,27 @@ namespace Dune
                 assert(allcorners_ && corner_indices);
             }
 
+            /// @brief Construct a geometry that does not share ownership of
+            ///        the corners.
+            ///
+            /// Otherwise as the constructor above. The corners must outlive
+            /// the geometry, as is the case for the cell geometries of a grid
+            /// and its corners. Copying such a geometry does not update any
+            /// reference count.
+            /// @param pos the centroid of the entity
+            /// @param vol the volume(area) of the entity
+            /// @param allcorners all corner positions in the grid
+            /// @param corner_indices array of 8 indices into allcorners, as above.
+            Geometry(const GlobalCoordinate& pos,
+                     ctype vol,
+                     const EntityVariable<cpgrid::Geometry<0, 3>, 3>& allcorners,
+                     const int* corner_indices)
+                : pos_(pos), vol_(vol),
+                  allcorners_(std::shared_ptr<const void>(), &allcorners), cor_idx_(corner_indices)
+            {
+                assert(corner_indices);
+            }
+
             /// Default constructor, giving a non-valid geometry.
             Geometry()
                 : pos_(0.0), vol_(0.0), allcorners_(0), cor_idx_(0)
@@ -1016,7 +1037,7 @@ namespace Dune
                             refined_cells[refined_cell_idx] =
                                 Geometry<3,cdim>(refined_cell_center,
                                                  refined_cell_volume,
-                                                 all_geom.geomVector(std::integral_constant<int,3>()),
+                                                 *all_geom.geomVector(std::integral_constant<int,3>()),
                                                  indices_storage_ptr);
                         } // end i-for-loop
                     }  // end j-for-loop
@@ -1124,6 +1145,73 @@ namespace Dune
                 }
             }
         };
+
+        inline void DefaultGeometryPolicy::compactCellGeometry(const std::vector<std::array<int, 8>>& cell_to_point)
+        {
+            if (!hasCompactCellGeometry()) {
+                const auto& cells = *cell_geom_ptr_;
+                if (cell_to_point.size() != cells.size()) {
+                    OPM_THROW(std::logic_error, "Cell to point mapping does not match the cell geometry.");
+                }
+                cell_centroids_.resize(cells.size());
+                cell_volumes_.resize(cells.size());
+                for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+                    cell_centroids_[cell] = cells.get(cell).center();
+                    cell_volumes_[cell] = cells.get(cell).volume();
+                }
+                // Other policies may share the geometry objects, so do not clear them.
+                cell_geom_ptr_ = std::make_shared<EntityVariable<cpgrid::Geometry<3, 3>, 0>>();
+            }
+            cell_to_point_ = &cell_to_point;
+        }
+
+        inline void DefaultGeometryPolicy::expandCellGeometry()
+        {
+            if (!hasCompactCellGeometry()) {
+                return;
+            }
+            auto& cells = *cell_geom_ptr_;
+            const int num_cells = cell_volumes_.size();
+            cells.reserve(num_cells);
+            for (int cell = 0; cell < num_cells; ++cell) {
+                cells.push_back(cellGeometry(cell));
+            }
+            std::vector<FieldVector<double, 3>>().swap(cell_centroids_);
+            std::vector<double>().swap(cell_volumes_);
+            cell_to_point_ = nullptr;
+        }
+
+        inline void DefaultGeometryPolicy::permuteCompactCellGeometry(const std::vector<int>& new_to_old_cell)
+        {
+            assert(hasCompactCellGeometry());
+            std::vector<FieldVector<double, 3>> centroids(new_to_old_cell.size());
+            std::vector<double> volumes(new_to_old_cell.size());
+            for (std::size_t cell = 0; cell < new_to_old_cell.size(); ++cell) {
+                centroids[cell] = cell_centroids_[new_to_old_cell[cell]];
+                volumes[cell] = cell_volumes_[new_to_old_cell[cell]];
+            }
+            cell_centroids_.swap(centroids);
+            cell_volumes_.swap(volumes);
+        }
+
+        inline Geometry<3, 3> DefaultGeometryPolicy::cellGeometry(int cell) const
+        {
+            if (hasCompactCellGeometry()) {
+                return Geometry<3, 3>(cell_centroids_[cell], cell_volumes_[cell],
+                                      *point_geom_ptr_, (*cell_to_point_)[cell].data());
+            }
+            return cell_geom_ptr_->get(cell);
+        }
+
+        inline const FieldVector<double, 3>& DefaultGeometryPolicy::cellCentroid(int cell) const
+        {
+            return hasCompactCellGeometry() ? cell_centroids_[cell] : cell_geom_ptr_->get(cell).center();
+        }
+
+        inline double DefaultGeometryPolicy::cellVolume(int cell) const
+        {
+            return hasCompactCellGeometry() ? cell_volumes_[cell] : cell_geom_ptr_->get(cell).volume();
+        }
     } // namespace cpgrid
 
     template< int mydim, int cdim >
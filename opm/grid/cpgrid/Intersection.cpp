@@ -37,7 +37,9 @@ Intersection::Intersection(const CpGridData& grid, const EntityRep<0>& cell, int
                   subindex_(subindex),
                   faces_of_cell_(grid.cell_to_face_[cell]),
                   nbcell_(cell.index()), // Init to self, which is invalid.
-                  is_on_boundary_(false)
+                  is_on_boundary_(false),
+                  table_(grid.intersectionTable()),
+                  first_entry_(table_ ? table_->cell_start[cell.index()] : 0)
             {
                 assert(index_ >= 0);
                 if (update_now) {
@@ -52,6 +54,13 @@ int Intersection::boundaryId() const
                         // Use the unique boundary ids.
                         OrientedEntityTable<0,1>::ToType face = faces_of_cell_[subindex_];
                         ret = pgrid_->unique_boundary_ids_[face];
+                    } else if (table_) {
+                        // The face tag based ids are indexInInside() + 1.
+                        const int index_in_inside = table_->index_in_inside[first_entry_ + subindex_];
+                        if (index_in_inside < 0) {
+                            OPM_THROW(std::logic_error, "NNC face at boundary. This should never happen!");
+                        }
+                        ret = index_in_inside + 1;
                     } else {
                         // Use the face tag based ids, i.e. 1-6 for i-, i+, j-, j+, k-, k+.
                         typedef OrientedEntityTable<0,1>::ToType Face;
@@ -97,6 +106,12 @@ int Intersection::boundarySegmentIndex() const
             }
 void Intersection::update()
             {
+                if (table_) {
+                    const int entry = first_entry_ + subindex_;
+                    nbcell_ = table_->neighbor[entry];
+                    is_on_boundary_ = table_->boundary[entry];
+                    return;
+                }
                 const EntityRep<1>& face = faces_of_cell_[subindex_];
                 OrientedEntityTable<1,0>::row_type cells_of_face = pgrid_->face_to_cell_[face];
                 is_on_boundary_ = cells_of_face.size() == 1;
@@ -127,6 +142,9 @@ void Intersection::increment()
 
 int Intersection::indexInInside() const
 {
+    if (table_) {
+        return table_->index_in_inside[first_entry_ + subindex_];
+    }
     // Use the face tags to decide if an intersection is
     // on an x, y, or z face and use orientations to decide
     // if its (for example) an xmin or xmax face.
@@ -50,6 +50,7 @@
 #include <opm/grid/cpgpreprocess/preprocess.h>
 
 #include "Geometry.hpp"
+#include "IntersectionTable.hpp"
 #include "OrientedEntityTable.hpp"
 namespace Dune
 {
@@ -87,7 +88,9 @@ namespace Dune
                   subindex_(-1),
                   faces_of_cell_(),
                   nbcell_(-1), // Init to self, which is invalid.
-                  is_on_boundary_(false)
+                  is_on_boundary_(false),
+                  table_(nullptr),
+                  first_entry_(0)
             {
             }
             /// @brief
@@ -233,6 +236,9 @@ namespace Dune
 
             int id() const
             {
+                if (table_) {
+                    return table_->face[first_entry_ + subindex_];
+                }
                 const EntityRep<1>& face = faces_of_cell_[subindex_];
                 return face.index();
             }
@@ -244,6 +250,10 @@ namespace Dune
             OrientedEntityTable<0,1>::row_type faces_of_cell_;
             int nbcell_;
             bool is_on_boundary_;
+            /// The precomputed intersection data of the grid, null if not built.
+            const IntersectionTable* table_;
+            /// The entry of the first face of the cell in table_.
+            int first_entry_;
 
             void increment();
 
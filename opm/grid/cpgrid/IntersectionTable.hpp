@@ -0,0 +1,54 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_INTERSECTIONTABLE_HEADER
+#define OPM_INTERSECTIONTABLE_HEADER
+
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Precomputed intersection data of all cells of a grid view.
+///
+/// There is one entry per cell face, the entries of a cell are consecutive
+/// and in the order of its faces in cell_to_face_. The data is stored as a
+/// struct of arrays, such that an intersection iterator reads what it needs
+/// without looking up face_to_cell_ and face_tag_. Built by
+/// CpGridData::buildIntersectionTable().
+struct IntersectionTable
+{
+    /// The first entry of each cell, and the number of entries at the end.
+    std::vector<int> cell_start;
+    /// The outside cell, std::numeric_limits<int>::max() on the boundary and
+    /// if the outside cell is not on this process.
+    std::vector<int> neighbor;
+    /// The index of the face.
+    std::vector<int> face;
+    /// The value of Intersection::indexInInside(), -1 for NNC faces.
+    std::vector<signed char> index_in_inside;
+    /// Whether the face is on the boundary of the domain.
+    std::vector<char> boundary;
+};
+
+} // namespace cpgrid
+} // namespace Dune
+
+#endif // OPM_INTERSECTIONTABLE_HEADER
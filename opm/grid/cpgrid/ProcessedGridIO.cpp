@@ -0,0 +1,435 @@
+//===========================================================================
+//
+// File: ProcessedGridIO.cpp
+//
+// Created: October 2026
+//
+// $Date$
+//
+// $Revision$
+//
+//===========================================================================
+
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "CpGridData.hpp"
+#include "Geometry.hpp"
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/grid/cpgrid/Indexsets.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <istream>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+
+// File layout: the magic, the format version and a byte order mark, followed
+// by the arrays in the order of saveProcessedGrid(). Each array is its element
+// count (64 bit) and the raw elements, padded to a multiple of 8 bytes. All
+// arrays are thus aligned in the file and could be mapped into memory.
+const char processedGridMagic[8] = {'O', 'P', 'M', 'C', 'P', 'G', 'R', 'D'};
+constexpr std::uint32_t processedGridVersion = 1;
+constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+std::size_t padding(std::size_t bytes)
+{
+    return (8 - bytes % 8) % 8;
+}
+
+template <class T>
+void writeArray(std::ostream& out, const std::vector<T>& data)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Arrays are written as raw bytes");
+    const std::uint64_t count = data.size();
+    const char zeros[8] = {};
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    out.write(reinterpret_cast<const char*>(data.data()), count * sizeof(T));
+    out.write(zeros, padding(count * sizeof(T)));
+}
+
+template <class T>
+std::vector<T> readArray(std::istream& in, const char* name)
+{
+    std::uint64_t count = 0;
+    std::vector<T> data;
+    if (in.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+        data.resize(count);
+        char pad[8];
+        in.read(reinterpret_cast<char*>(data.data()), count * sizeof(T));
+        in.read(pad, padding(count * sizeof(T)));
+    }
+    if (!in) {
+        OPM_THROW(std::runtime_error, std::string("Could not read the ") + name + " of the processed grid.");
+    }
+    return data;
+}
+
+/// Writes the row starts and the entries of a table, converted to int.
+template <class T, class ToInt>
+void writeTable(std::ostream& out, const Opm::SparseTable<T>& table, ToInt toInt)
+{
+    std::vector<int> row_starts(1, 0);
+    std::vector<int> data;
+    row_starts.reserve(table.size() + 1);
+    data.reserve(table.dataSize());
+    for (int row = 0; row < table.size(); ++row) {
+        for (const auto& entry : table[row]) {
+            data.push_back(toInt(entry));
+        }
+        row_starts.push_back(data.size());
+    }
+    writeArray(out, row_starts);
+    writeArray(out, data);
+}
+
+/// Reads the row sizes and the entries of a table written by writeTable().
+std::pair<std::vector<int>, std::vector<int>> readTable(std::istream& in, const char* name)
+{
+    auto row_sizes = readArray<int>(in, name);
+    auto data = readArray<int>(in, name);
+    if (row_sizes.empty() || row_sizes.front() != 0 || row_sizes.back() != static_cast<int>(data.size())) {
+        OPM_THROW(std::runtime_error, std::string("Inconsistent ") + name + " in the processed grid.");
+    }
+    std::adjacent_difference(row_sizes.begin(), row_sizes.end(), row_sizes.begin());
+    row_sizes.erase(row_sizes.begin());
+    return {std::move(row_sizes), std::move(data)};
+}
+
+template <int codim>
+std::vector<EntityRep<codim>> toEntityReps(const std::vector<int>& signed_indices)
+{
+    std::vector<EntityRep<codim>> entities;
+    entities.reserve(signed_indices.size());
+    for (int s : signed_indices) {
+        entities.emplace_back(s < 0 ? ~s : s, s >= 0);
+    }
+    return entities;
+}
+
+std::vector<double> flatten(const std::vector<FieldVector<double, 3>>& points)
+{
+    std::vector<double> flat;
+    flat.reserve(3 * points.size());
+    for (const auto& p : points) {
+        flat.insert(flat.end(), p.begin(), p.end());
+    }
+    return flat;
+}
+
+FieldVector<double, 3> point(const std::vector<double>& flat, std::size_t i)
+{
+    return {flat[3 * i], flat[3 * i + 1], flat[3 * i + 2]};
+}
+
+} // anonymous namespace
+
+
+void CpGridData::saveProcessedGrid(std::ostream& out) const
+{
+    out.write(processedGridMagic, sizeof(processedGridMagic));
+    out.write(reinterpret_cast<const char*>(&processedGridVersion), sizeof(processedGridVersion));
+    out.write(reinterpret_cast<const char*>(&byteOrderMark), sizeof(byteOrderMark));
+
+    // Topology
+    writeArray(out, std::vector<int>(logical_cartesian_size_.begin(), logical_cartesian_size_.end()));
+    writeArray(out, global_cell_);
+    const auto signedIndex = [](const auto& entity) { return entity.signedIndex(); };
+    writeTable(out, static_cast<const Opm::SparseTable<EntityRep<1>>&>(cell_to_face_), signedIndex);
+    writeTable(out, static_cast<const Opm::SparseTable<EntityRep<0>>&>(face_to_cell_), signedIndex);
+    writeTable(out, face_to_point_, [](int point) { return point; });
+    std::vector<int> cell_to_point;
+    cell_to_point.reserve(8 * cell_to_point_.size());
+    for (const auto& corners : cell_to_point_) {
+        cell_to_point.insert(cell_to_point.end(), corners.begin(), corners.end());
+    }
+    writeArray(out, cell_to_point);
+    writeArray(out, std::vector<int>(face_tag_.begin(), face_tag_.end()));
+
+    // Geometry
+    const auto& points = geomVector<3>();
+    std::vector<FieldVector<double, 3>> point_centers;
+    point_centers.reserve(points.size());
+    for (const auto& p : points) {
+        point_centers.push_back(p.center());
+    }
+    writeArray(out, flatten(point_centers));
+
+    const auto& faces = geomVector<1>();
+    std::vector<FieldVector<double, 3>> face_centroids;
+    std::vector<double> face_areas;
+    face_centroids.reserve(faces.size());
+    face_areas.reserve(faces.size());
+    for (const auto& face : faces) {
+        face_centroids.push_back(face.center());
+        face_areas.push_back(face.volume());
+    }
+    writeArray(out, flatten(face_centroids));
+    writeArray(out, face_areas);
+    writeArray(out, flatten(std::vector<FieldVector<double, 3>>(face_normals_.begin(), face_normals_.end())));
+
+    const int num_cells = size(0);
+    std::vector<FieldVector<double, 3>> cell_centroids(num_cells);
+    std::vector<double> cell_volumes(num_cells);
+    for (int cell = 0; cell < num_cells; ++cell) {
+        cell_centroids[cell] = geometry_.cellCentroid(cell);
+        cell_volumes[cell] = geometry_.cellVolume(cell);
+    }
+    writeArray(out, flatten(cell_centroids));
+    writeArray(out, cell_volumes);
+
+    // Input data retained from the processing
+    writeArray(out, zcorn);
+    writeArray(out, aquifer_cells_);
+}
+
+
+void CpGridData::loadProcessedGrid(std::istream& in)
+{
+    readProcessedGrid(in);
+
+    computeUniqueBoundaryIds();
+
+    if (ccobj_.size() > 1)
+        populateGlobalCellIndexSet();
+
+    index_set_ = std::make_unique<IndexSet>(cell_to_face_.size(), geomVector<3>().size());
+
+    // A table requested before the grid was loaded describes no cells.
+    if (intersection_table_) {
+        buildIntersectionTable();
+    }
+}
+
+
+void CpGridData::readProcessedGrid(std::istream& in)
+{
+    if (size(0) != 0) {
+        OPM_THROW(std::logic_error, "A processed grid can only be loaded into an empty grid.");
+    }
+
+    char magic[sizeof(processedGridMagic)] = {};
+    std::uint32_t version = 0;
+    std::uint32_t bom = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&bom), sizeof(bom));
+    if (!in || std::memcmp(magic, processedGridMagic, sizeof(magic)) != 0) {
+        OPM_THROW(std::runtime_error, "Not a processed grid file.");
+    }
+    if (version != processedGridVersion || bom != byteOrderMark) {
+        OPM_THROW(std::runtime_error, "Processed grid file has version " + std::to_string(version)
+                  + " or a different byte order, expected version " + std::to_string(processedGridVersion) + ".");
+    }
+
+    // Topology
+    const auto cartesian_size = readArray<int>(in, "logical cartesian size");
+    if (cartesian_size.size() != 3) {
+        OPM_THROW(std::runtime_error, "Inconsistent logical cartesian size in the processed grid.");
+    }
+    std::copy(cartesian_size.begin(), cartesian_size.end(), logical_cartesian_size_.begin());
+    global_cell_ = readArray<int>(in, "global cells");
+    {
+        const auto [row_sizes, data] = readTable(in, "cell to face table");
+        const auto faces = toEntityReps<1>(data);
+        cell_to_face_ = OrientedEntityTable<0, 1>(faces.begin(), faces.end(), row_sizes.begin(), row_sizes.end());
+    }
+    {
+        const auto [row_sizes, data] = readTable(in, "face to cell table");
+        const auto cells = toEntityReps<0>(data);
+        face_to_cell_ = OrientedEntityTable<1, 0>(cells.begin(), cells.end(), row_sizes.begin(), row_sizes.end());
+    }
+    {
+        const auto [row_sizes, data] = readTable(in, "face to point table");
+        face_to_point_.assign(data.begin(), data.end(), row_sizes.begin(), row_sizes.end());
+    }
+    const auto cell_to_point = readArray<int>(in, "cell to point table");
+    cell_to_point_.resize(cell_to_point.size() / 8);
+    for (std::size_t cell = 0; cell < cell_to_point_.size(); ++cell) {
+        std::copy_n(cell_to_point.begin() + 8 * cell, 8, cell_to_point_[cell].begin());
+    }
+    const auto face_tags = readArray<int>(in, "face tags");
+    std::vector<enum face_tag> tags(face_tags.size());
+    std::transform(face_tags.begin(), face_tags.end(), tags.begin(),
+                   [](int tag) { return static_cast<enum face_tag>(tag); });
+    face_tag_.assign(tags.begin(), tags.end());
+
+    // Geometry
+    const auto point_centers = readArray<double>(in, "points");
+    const auto face_centroids = readArray<double>(in, "face centroids");
+    const auto face_areas = readArray<double>(in, "face areas");
+    const auto face_normals = readArray<double>(in, "face normals");
+    const auto cell_centroids = readArray<double>(in, "cell centroids");
+    const auto cell_volumes = readArray<double>(in, "cell volumes");
+
+    const std::size_t num_cells = global_cell_.size();
+    const std::size_t num_faces = face_to_cell_.size();
+    if (cell_to_face_.size() != static_cast<int>(num_cells) || cell_to_point.size() != 8 * num_cells
+        || cell_centroids.size() != 3 * num_cells || cell_volumes.size() != num_cells
+        || face_to_point_.size() != static_cast<int>(num_faces) || face_tags.size() != num_faces
+        || face_centroids.size() != 3 * num_faces || face_areas.size() != num_faces
+        || face_normals.size() != 3 * num_faces || point_centers.size() % 3 != 0) {
+        OPM_THROW(std::runtime_error, "Inconsistent sizes in the processed grid.");
+    }
+
+    auto& point_geom = *geometry_.geomVector(std::integral_constant<int, 3>());
+    point_geom.reserve(point_centers.size() / 3);
+    for (std::size_t p = 0; p < point_centers.size() / 3; ++p) {
+        point_geom.push_back(Geometry<0, 3>(point(point_centers, p)));
+    }
+    auto& face_geom = *geometry_.geomVector(std::integral_constant<int, 1>());
+    face_geom.reserve(num_faces);
+    std::vector<PointType> normals(num_faces);
+    for (std::size_t face = 0; face < num_faces; ++face) {
+        face_geom.push_back(Geometry<2, 3>(point(face_centroids, face), face_areas[face]));
+        normals[face] = point(face_normals, face);
+    }
+    face_normals_.assign(normals.begin(), normals.end());
+    auto& cell_geom = *geometry_.geomVector(std::integral_constant<int, 0>());
+    cell_geom.reserve(num_cells);
+    for (std::size_t cell = 0; cell < num_cells; ++cell) {
+        cell_geom.push_back(Geometry<3, 3>(point(cell_centroids, cell), cell_volumes[cell],
+                                           point_geom, cell_to_point_[cell].data()));
+    }
+
+    // Input data retained from the processing
+    zcorn = readArray<double>(in, "zcorn");
+    aquifer_cells_ = readArray<int>(in, "aquifer cells");
+}
+
+
+void CpGridData::saveDistributedGrid(std::ostream& out) const
+{
+#if HAVE_MPI
+    saveProcessedGrid(out);
+
+    writeArray(out, std::vector<int>{ccobj_.size(), ccobj_.rank()});
+    writeArray(out, global_id_set_->getMapping<0>());
+    writeArray(out, global_id_set_->getMapping<1>());
+    writeArray(out, global_id_set_->getMapping<3>());
+
+    std::vector<int> global_indices, local_indices, attributes;
+    const auto& cell_indexset = cellIndexSet();
+    global_indices.reserve(cell_indexset.size());
+    local_indices.reserve(cell_indexset.size());
+    attributes.reserve(cell_indexset.size());
+    for (const auto& index : cell_indexset) {
+        global_indices.push_back(index.global());
+        local_indices.push_back(index.local().local());
+        attributes.push_back(index.local().attribute());
+    }
+    writeArray(out, global_indices);
+    writeArray(out, local_indices);
+    writeArray(out, attributes);
+
+    writeArray(out, std::vector<int>{use_unique_boundary_ids_});
+    writeArray(out, std::vector<int>(unique_boundary_ids_.begin(), unique_boundary_ids_.end()));
+#else
+    static_cast<void>(out);
+    OPM_THROW(std::logic_error, "Saving a distributed grid requires MPI.");
+#endif
+}
+
+
+void CpGridData::loadDistributedGrid(std::istream& in)
+{
+#if HAVE_MPI
+    // A missing or corrupt file fails on this rank only. Agree on the outcome
+    // before the collective setup below, such that all ranks throw.
+    std::exception_ptr error;
+    try {
+        readProcessedGrid(in);
+
+        const auto partition = readArray<int>(in, "partition");
+        if (partition.size() != 2 || partition[0] != ccobj_.size() || partition[1] != ccobj_.rank()) {
+            OPM_THROW(std::runtime_error, "The distributed grid was saved for another number of processes or another rank.");
+        }
+        auto cell_ids = readArray<int>(in, "global cell ids");
+        auto face_ids = readArray<int>(in, "global face ids");
+        auto point_ids = readArray<int>(in, "global point ids");
+        if (cell_ids.size() != global_cell_.size() || face_ids.size() != static_cast<std::size_t>(face_to_cell_.size())
+            || point_ids.size() != static_cast<std::size_t>(size(3))) {
+            OPM_THROW(std::runtime_error, "Inconsistent global ids in the distributed grid.");
+        }
+        global_id_set_->swap(cell_ids, face_ids, point_ids);
+
+        const auto global_indices = readArray<int>(in, "cell index set");
+        const auto local_indices = readArray<int>(in, "cell index set");
+        const auto attributes = readArray<int>(in, "cell index set");
+        if (global_indices.size() != global_cell_.size() || local_indices.size() != global_cell_.size()
+            || attributes.size() != global_cell_.size()) {
+            OPM_THROW(std::runtime_error, "Inconsistent cell index set in the distributed grid.");
+        }
+        auto& cell_indexset = cellIndexSet();
+        cell_indexset.beginResize();
+        for (std::size_t i = 0; i < global_indices.size(); ++i) {
+            cell_indexset.add(global_indices[i],
+                              ParallelIndexSet::LocalIndex(local_indices[i], AttributeSet(attributes[i]), true));
+        }
+        cell_indexset.endResize();
+
+        const auto use_unique_boundary_ids = readArray<int>(in, "boundary ids");
+        const auto unique_boundary_ids = readArray<int>(in, "boundary ids");
+        use_unique_boundary_ids_ = !use_unique_boundary_ids.empty() && use_unique_boundary_ids.front();
+        unique_boundary_ids_.assign(unique_boundary_ids.begin(), unique_boundary_ids.end());
+    } catch (...) {
+        error = std::current_exception();
+    }
+    if (ccobj_.min(error ? 0 : 1) == 0) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        OPM_THROW(std::runtime_error, "Loading the distributed grid failed on another process.");
+    }
+
+    // Same as the end of distributeGlobalGrid(), without the global grid.
+    cellRemoteIndices().template rebuild<false>();
+    computeCellPartitionType();
+    computePointPartitionType();
+    computeCommunicationInterfaces(size(3));
+
+    index_set_ = std::make_unique<IndexSet>(cell_to_face_.size(), geomVector<3>().size());
+#else
+    static_cast<void>(in);
+    OPM_THROW(std::logic_error, "Loading a distributed grid requires MPI.");
+#endif
+}
+
+} // namespace cpgrid
+} // namespace Dune
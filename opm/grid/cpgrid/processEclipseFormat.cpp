@@ -51,14 +51,18 @@
 #include <opm/grid/cpgpreprocess/preprocess.h>
 #include <opm/grid/MinpvProcessor.hpp>
 #include <opm/grid/RepairZCORN.hpp>
+#include <opm/grid/utility/PhaseTimings.hpp>
 #include <opm/grid/utility/StopWatch.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <fstream>
 #include <iostream>
 #include <initializer_list>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 
 namespace Dune
@@ -101,7 +105,8 @@ namespace Dune
                        cpgrid::OrientedEntityTable<1, 0>& f2c,
                        Opm::SparseTable<int>& f2p,
                        std::vector<std::array<int,8> >& c2p,
-                       std::vector<int>& face_to_output_face);
+                       std::vector<int>& face_to_output_face,
+                       Opm::PhaseTimings* timings);
         void buildGeom(const processed_grid& output,
                        const cpgrid::OrientedEntityTable<0, 1>& c2f,
                        const std::vector<std::array<int,8> >& c2p,
@@ -112,6 +117,14 @@ namespace Dune
                        std::shared_ptr<cpgrid::EntityVariable<cpgrid::Geometry<0, 3>, 3>> point_geom,
                        cpgrid::SignedEntityVariable<FieldVector<double, 3> , 1>& normals,
                        bool turn_normals);
+#if HAVE_MPI
+        int processGrdeclDistributed(const grdecl* input,
+                                     double tolerance,
+                                     const int* is_aquifer_cell,
+                                     int pinchActive,
+                                     processed_grid* output,
+                                     MPI_Comm comm);
+#endif
     } // anon namespace
 
 
@@ -138,6 +151,7 @@ namespace cpgrid
                     throw std::runtime_error("Error during MINPV processing");
                 }
             }
+            joinDistributedPreprocessing();
             // Store global grid only on rank 0
             return {};
         }
@@ -146,8 +160,11 @@ namespace cpgrid
         std::vector<double> coordData = ecl_grid.getCOORD();
         std::vector<int> actnumData = ecl_grid.getACTNUM();
 
+        Opm::PhaseTimings::Scope zcornPhase(setup_timings_.get(), "getSanitizedZCORN");
         // Mutable because grdecl::zcorn is non-const.
         auto zcornData = getSanitizedZCORN(ecl_grid, actnumData);
+        zcornPhase.setItems(actnumData.size());
+        zcornPhase.stop();
 
         // Make input struct for processing code.
         grdecl g;
@@ -177,6 +194,8 @@ namespace cpgrid
                 return std::vector<double>(cartGridSize, 1);
             }();
 
+            Opm::PhaseTimings::Scope minpvPhase(setup_timings_.get(), "minpv");
+            minpvPhase.setItems(cartGridSize);
             try {
                 Opm::MinpvProcessor mp(g.dims[0], g.dims[1], g.dims[2]);
                 std::vector<double> thickness(cartGridSize);
@@ -205,6 +224,7 @@ namespace cpgrid
                 ccobj_.broadcast(&success, 1, 0);
                 throw; // rethrow
             }
+            minpvPhase.stop();
             int success = 1;
             // communicate success to others
             ccobj_.broadcast(&success, 1, 0);
@@ -372,6 +392,12 @@ namespace cpgrid
                 }
             }
             if (minz_top <= maxz_bot) {
+#if HAVE_MPI
+                if (distributed_preprocessing_ && ccobj_.size() > 1) {
+                    // Release the other ranks waiting for their rows.
+                    processGrdeclDistributed(nullptr, 0.0, nullptr, 0, nullptr, ccobj_);
+                }
+#endif
                 OPM_THROW(std::runtime_error, "Grid cannot be clipped to a shoe-box (in z): Would be empty afterwards.");
             }
             int num_zcorn = zcornData.size();
@@ -402,6 +428,21 @@ namespace cpgrid
 #endif // #if HAVE_ECL_INPUT
 
 
+    void CpGridData::joinDistributedPreprocessing()
+    {
+#if HAVE_MPI
+        if (distributed_preprocessing_ && ccobj_.size() > 1 && ccobj_.rank() != 0) {
+            // Process our share of the cell rows; rank 0 assembles the grid.
+            if (processGrdeclDistributed(nullptr, 0.0, nullptr, 0, nullptr, ccobj_) == 0) {
+                OPM_THROW(std::runtime_error,
+                          "Failed to build unstructured "
+                          "grid from COORD/ZCORN");
+            }
+        }
+#endif
+    }
+
+
     enum { NNCFace = -1 };
 
 
@@ -416,6 +457,10 @@ namespace cpgrid
     {
         if( ccobj_.rank() != 0 )
         {
+            if (distributed_preprocessing_ && ccobj_.size() > 1) {
+                joinDistributedPreprocessing();
+                return;
+            }
             OPM_THROW(std::logic_error, "Processing  eclipse file only allowed on rank 0");
         }
         // Process.
@@ -426,6 +471,18 @@ namespace cpgrid
         processed_grid output;
         int process_ok;
 
+        Opm::PhaseTimings::Scope processPhase(setup_timings_.get(), "process_grdecl");
+        auto process = [&](const int* is_aquifer_cell)
+        {
+#if HAVE_MPI
+            if (distributed_preprocessing_ && ccobj_.size() > 1) {
+                return processGrdeclDistributed(&input_data, tolerance_unique_points, is_aquifer_cell,
+                                                pinchActive, &output, ccobj_);
+            }
+#endif
+            return process_grdecl(&input_data, tolerance_unique_points, is_aquifer_cell, &output, pinchActive);
+        };
+
 #if HAVE_ECL_INPUT
         if (ecl_state && ecl_state->aquifer().hasNumericalAquifer()) {
             const auto aquifer_cell_volumes = ecl_state->aquifer().numericalAquifers().aquiferCellVolumes();
@@ -434,12 +491,14 @@ namespace cpgrid
             for ([[maybe_unused]]const auto&[global_index, volume] : aquifer_cell_volumes) {
                 is_aquifer_cell[global_index] = 1;
             }
-            process_ok = process_grdecl(&input_data, tolerance_unique_points, is_aquifer_cell.data(), &output, pinchActive);
+            process_ok = process(is_aquifer_cell.data());
         } else
 #endif
         {
-            process_ok = process_grdecl(&input_data, tolerance_unique_points, nullptr, &output, pinchActive);
+            process_ok = process(nullptr);
         }
+        processPhase.setItems(process_ok ? output.number_of_cells : 0);
+        processPhase.stop();
 
         if (process_ok == 0) {
             OPM_THROW(std::runtime_error,
@@ -479,7 +538,12 @@ namespace cpgrid
         std::cout << "Building topology." << std::endl;
 #endif
         std::vector<int> face_to_output_face;
-        buildTopo(output, nnc, global_cell_, cell_to_face_, face_to_cell_, face_to_point_, cell_to_point_, face_to_output_face);
+        {
+            Opm::PhaseTimings::Scope phase(setup_timings_.get(), "buildTopo");
+            buildTopo(output, nnc, global_cell_, cell_to_face_, face_to_cell_, face_to_point_, cell_to_point_,
+                      face_to_output_face, setup_timings_.get());
+            phase.setItems(face_to_output_face.size());
+        }
         std::copy(output.dimensions, output.dimensions + 3, logical_cartesian_size_.begin());
 
 #ifdef VERBOSE
@@ -501,9 +565,13 @@ namespace cpgrid
         }
 #endif
         std::sort(aquifer_cells_.begin(), aquifer_cells_.end());
-        buildGeom(output, cell_to_face_, cell_to_point_, face_to_output_face, aquifer_cell_volumes_local, *(geometry_.geomVector(std::integral_constant<int,0>())),
-                  *( geometry_.geomVector(std::integral_constant<int,1>())), geometry_.geomVector(std::integral_constant<int,3>()),
-                  face_normals_, turn_normals);
+        {
+            Opm::PhaseTimings::Scope phase(setup_timings_.get(), "buildGeom");
+            buildGeom(output, cell_to_face_, cell_to_point_, face_to_output_face, aquifer_cell_volumes_local, *(geometry_.geomVector(std::integral_constant<int,0>())),
+                      *( geometry_.geomVector(std::integral_constant<int,1>())), geometry_.geomVector(std::integral_constant<int,3>()),
+                      face_normals_, turn_normals);
+            phase.setItems(cell_to_point_.size());
+        }
 
 #ifdef VERBOSE
         std::cout << "Assigning face tags." << std::endl;
@@ -533,6 +601,11 @@ namespace cpgrid
 
         index_set_ = std::make_unique<IndexSet>(cell_to_face_.size(), geomVector<3>().size());
 
+        // A table requested before the grid was built describes no cells.
+        if (intersection_table_) {
+            buildIntersectionTable();
+        }
+
 #ifdef VERBOSE
         std::cout << "Done with grid processing." << std::endl;
 #endif
@@ -1024,8 +1097,11 @@ namespace cpgrid
                              const NNCMaps& nnc,
                              const std::vector<int>& global_cell,
                              cpgrid::OrientedEntityTable<1, 0>& f2c,
-                             std::vector<int>& face_to_output_face)
+                             std::vector<int>& face_to_output_face,
+                             Opm::PhaseTimings* timings)
         {
+            Opm::PhaseTimings::Scope nncPhase(timings, "filterNNCs");
+            nncPhase.setItems(nnc[ExplicitNNC].size() + nnc[PinchNNC].size());
             std::vector<int> global_to_local;
             if (!nnc[ExplicitNNC].empty() || !nnc[PinchNNC].empty())
                 global_to_local = createGlobalToLocal(output, global_cell);
@@ -1037,6 +1113,7 @@ namespace cpgrid
             if (!nnc[ExplicitNNC].empty()) {
                 buildFaceToCellNNC(output, nnc[ExplicitNNC], global_to_local, f2c, face_to_output_face);
             }
+            nncPhase.stop();
             int nf = output.number_of_faces;
             cpgrid::EntityRep<0> cells[2];
             // int next_skip_zmin_face = -1; // Not currently used, see comments further down.
@@ -1109,14 +1186,15 @@ namespace cpgrid
                        cpgrid::OrientedEntityTable<1, 0>& f2c,
                        Opm::SparseTable<int>& f2p,
                        std::vector<std::array<int,8> >& c2p,
-                       std::vector<int>& face_to_output_face)
+                       std::vector<int>& face_to_output_face,
+                       Opm::PhaseTimings* timings)
         {
             // Map local to global cell index.
             global_cell.assign(output.local_cell_index,
                                output.local_cell_index + output.number_of_cells);
 
             // Build face to cell mapping.
-            buildFaceToCell(output, nnc, global_cell, f2c, face_to_output_face);
+            buildFaceToCell(output, nnc, global_cell, f2c, face_to_output_face, timings);
             int num_faces = f2c.size();
 
             // Build cell to face.
@@ -1223,7 +1301,7 @@ namespace cpgrid
                                                       double vol,
                                                       const std::array<int,8>& corner_indices)
             {
-                return cpgrid::Geometry<3, 3>(pos, vol, allcorners_, &corner_indices[0]);
+                return cpgrid::Geometry<3, 3>(pos, vol, *allcorners_, &corner_indices[0]);
             }
         };
 
@@ -1251,46 +1329,38 @@ namespace cpgrid
                        bool turn_normals)
         {
             typedef FieldVector<double, 3> point_t;
-            std::vector<point_t> points;
-            std::vector<point_t> face_normals;
-            std::vector<point_t> face_centroids;
-            std::vector<double>  face_areas;
-            std::vector<point_t> cell_centroids;
-            std::vector<double>  cell_volumes;
             auto& point_geom = *point_geom_ptr;
             using namespace GeometryHelpers;
 #ifdef VERBOSE
             Opm::time::StopWatch clock;
             clock.start();
 #endif
+            // The face and cell loops below write to preallocated arrays,
+            // one entry per face or cell, and may run on several threads.
+
             // Get the points.
-            int np = output.number_of_nodes;
-            points.clear();
-            points.reserve(np);
+            const int np = output.number_of_nodes;
+            std::vector<point_t> points(np);
+#pragma omp parallel for schedule(static)
             for (int i = 0; i < np; ++i) {
-                // \TODO add a convenience explicit constructor
-                // for FieldVector taking an iterator.
-                point_t pt;
                 for (int dd = 0; dd < 3; ++dd) {
-                    pt[dd] = output.node_coordinates[3*i + dd];
+                    points[i][dd] = output.node_coordinates[3*i + dd];
                 }
-                points.push_back(pt);
             }
 #ifdef VERBOSE
             std::cout << "Points:             " << clock.secsSinceLast() << std::endl;
 #endif
 
             // Get the face data.
-            // \TODO Both the face and (especially) the cell section
-            // is not very efficient. It could be rewritten easily
-            // (focus on the polygonCellXXX methods first).
             // \TODO Use exact geometry instead of these approximations.
-            int nf = face_to_output_face.size();
+            const int nf = face_to_output_face.size();
             const int* fn = output.face_nodes;
             const unsigned* fp = output.face_ptr;
+            std::vector<point_t> face_normals(nf);
+            std::vector<point_t> face_centroids(nf);
+            std::vector<double>  face_areas(nf);
+#pragma omp parallel for schedule(static)
             for (int face = 0; face < nf; ++face) {
-                // Computations in this loop could be speeded up
-                // by doing more of them simultaneously.
                 int output_face = face_to_output_face[face];
                 if (output_face == cpgrid::NNCFace) {
                     // NNC faces are purely topological constructs,
@@ -1300,37 +1370,37 @@ namespace cpgrid
                     // for the cell-centered FV discretization (because
                     // it wants to deal with velocities rather than fluxes),
                     // we have to set the areas to 1 to avoid trouble.
-                    face_normals.push_back({-1e100, -1e100, -1e100});
-                    face_centroids.push_back({-1e100, -1e100, -1e100});
-                    face_areas.push_back(1.0);
+                    face_normals[face] = -1e100;
+                    face_centroids[face] = -1e100;
+                    face_areas[face] = 1.0;
                 } else {
                     IndirectArray<point_t> face_pts(points, fn + fp[output_face], fn + fp[output_face+1]);
-                    point_t avg = average(face_pts);
-                    point_t centroid = polygonCentroid(face_pts, avg);
-                    point_t normal = polygonNormal(face_pts, centroid);
-                    double area = polygonArea(face_pts, centroid);
-                    face_normals.push_back(normal);
-                    face_centroids.push_back(centroid);
-                    face_areas.push_back(area);
+                    face_areas[face] = polygonGeometry(face_pts, face_centroids[face], face_normals[face]);
                 }
             }
 #ifdef VERBOSE
             std::cout << "Faces:              " << clock.secsSinceLast() << std::endl;
 #endif
             // Get the cell data.
-            int nc = output.number_of_cells;
-            std::vector<int> face_indices;
+            const int nc = output.number_of_cells;
+            std::vector<point_t> cell_centroids(nc);
+            std::vector<double>  cell_volumes(nc);
+#pragma omp parallel for schedule(static)
             for (int cell = 0; cell < nc; ++cell) {
                 cpgrid::EntityRep<0> cell_ent(cell, true);
                 cpgrid::OrientedEntityTable<0, 1>::row_type cf = c2f[cell_ent];
-                face_indices.clear();
+                // Average of the centroids of the non-NNC faces.
+                point_t cell_avg(0.0);
+                int num_faces = 0;
                 for (int local_index = 0; local_index < cf.size(); ++local_index) {
-                    if (face_to_output_face[cf[local_index].index()] != cpgrid::NNCFace) {
-                        face_indices.push_back(cf[local_index].index());
+                    int face = cf[local_index].index();
+                    if (face_to_output_face[face] != cpgrid::NNCFace) {
+                        cell_avg += face_centroids[face];
+                        ++num_faces;
                     }
                 }
-                IndirectArray<point_t> cell_pts(face_centroids, &face_indices[0], &face_indices[0] + face_indices.size());
-                point_t cell_avg = average(cell_pts);
+                assert(num_faces > 0);
+                cell_avg /= double(num_faces);
                 point_t cell_centroid(0.0);
                 double tot_cell_vol = 0.0;
                 for (int local_index = 0; local_index < cf.size(); ++local_index) {
@@ -1341,9 +1411,9 @@ namespace cpgrid
                         continue;
                     }
                     IndirectArray<point_t> face_pts(points, fn + fp[output_face], fn + fp[output_face+1]);
-                    double small_vol = polygonCellVolume(face_pts, face_centroids[face], cell_avg);
+                    point_t face_contrib;
+                    double small_vol = polygonCellVolumeCentroid(face_pts, face_centroids[face], cell_avg, face_contrib);
                     tot_cell_vol += small_vol;
-                    point_t face_contrib = polygonCellCentroid(face_pts, face_centroids[face], cell_avg);
                     face_contrib *= small_vol;
                     cell_centroid += face_contrib;
                 }
@@ -1355,12 +1425,12 @@ namespace cpgrid
 // #define HACK_CELL_CENTROIDS     // when this is defined, you get the average of top and bottom face centroids.
 #ifdef HACK_CELL_CENTROIDS
                 int numf = cf.size();
-                cell_centroid = face_centroids[face_indices[numf - 2]];
-                cell_centroid += face_centroids[face_indices[numf - 1]];
+                cell_centroid = face_centroids[cf[numf - 2].index()];
+                cell_centroid += face_centroids[cf[numf - 1].index()];
                 cell_centroid *= 0.5;
 #endif
-                cell_centroids.push_back(cell_centroid);
-                cell_volumes.push_back(tot_cell_vol);
+                cell_centroids[cell] = cell_centroid;
+                cell_volumes[cell] = tot_cell_vol;
             }
             // update the volumes of numerical aquifer cells
             for (const auto& [index, volume] : aquifer_cell_volumes) {
@@ -1416,6 +1486,261 @@ namespace cpgrid
             std::cout << "Final construction: " << clock.secsSinceLast() << std::endl;
 #endif
         }
+
+#if HAVE_MPI
+        enum SlabMessageTag { SlabCoordTag = 2401, SlabZcornTag, SlabActnumTag,
+                              SlabAquiferTag, SlabIntTag, SlabDoubleTag };
+
+        // Header broadcast by rank 0 before the slabs are processed.
+        enum SlabHeader { SlabStatus, SlabNX, SlabNY, SlabNZ, SlabSign, SlabLeftHanded,
+                          SlabHasActnum, SlabHasAquifer, SlabPinchActive, SlabHeaderSize };
+
+        /// The cell rows [first, second) processed by a rank.
+        std::pair<int, int> slabRows(int ny, int rank, int size)
+        {
+            return { static_cast<int>((static_cast<long long>(ny) * rank) / size),
+                     static_cast<int>((static_cast<long long>(ny) * (rank + 1)) / size) };
+        }
+
+        // Sizes of a processed slab, gathered on rank 0 before the slabs themselves.
+        enum SlabSize { SlabOk, SlabFaces, SlabFaceNodes = SlabFaces + 3,
+                        SlabPillarNodes = SlabFaceNodes + 3, SlabHaloNodes, SlabIntersections,
+                        SlabCells = SlabIntersections + 2, SlabSizeCount };
+
+        std::array<int, SlabSizeCount> slabSizes(int ok, const processed_slab& slab)
+        {
+            std::array<int, SlabSizeCount> sizes{};
+            sizes[SlabOk] = ok;
+            if (ok) {
+                for (int t = 0; t < 3; ++t) {
+                    sizes[SlabFaces + t] = slab.number_of_faces[t];
+                    sizes[SlabFaceNodes + t] = slab.number_of_face_nodes[t];
+                }
+                sizes[SlabPillarNodes] = slab.number_of_pillar_nodes;
+                sizes[SlabHaloNodes] = slab.number_of_halo_nodes;
+                sizes[SlabIntersections] = slab.number_of_intersections[0];
+                sizes[SlabIntersections + 1] = slab.number_of_intersections[1];
+                sizes[SlabCells] = slab.number_of_cells;
+            }
+            return sizes;
+        }
+
+        void setSlabSizes(const int* sizes, processed_slab& slab)
+        {
+            for (int t = 0; t < 3; ++t) {
+                slab.number_of_faces[t] = sizes[SlabFaces + t];
+                slab.number_of_face_nodes[t] = sizes[SlabFaceNodes + t];
+            }
+            slab.number_of_pillar_nodes = sizes[SlabPillarNodes];
+            slab.number_of_halo_nodes = sizes[SlabHaloNodes];
+            slab.number_of_intersections[0] = sizes[SlabIntersections];
+            slab.number_of_intersections[1] = sizes[SlabIntersections + 1];
+            slab.number_of_cells = sizes[SlabCells];
+        }
+
+        /// The arrays of a processed slab sent to rank 0. A processed_slab
+        /// received into it points into the buffers.
+        struct SlabBuffer
+        {
+            std::vector<int> ints;
+            std::vector<double> doubles;
+            std::vector<unsigned> face_ptr;
+
+            void resize(const processed_slab& slab)
+            {
+                const std::size_t nf = std::size_t(slab.number_of_faces[0])
+                    + slab.number_of_faces[1] + slab.number_of_faces[2];
+                const std::size_t nfn = std::size_t(slab.number_of_face_nodes[0])
+                    + slab.number_of_face_nodes[1] + slab.number_of_face_nodes[2];
+                const std::size_t nn = std::size_t(slab.number_of_pillar_nodes)
+                    + slab.number_of_intersections[0] + slab.number_of_intersections[1];
+                ints.resize(nf + 1 + nfn + 2*nf + slab.number_of_cells);
+                doubles.resize(3*nn);
+            }
+        };
+
+        void packSlab(const processed_slab& slab, SlabBuffer& buffer)
+        {
+            const unsigned nf = slab.number_of_faces[0] + slab.number_of_faces[1] + slab.number_of_faces[2];
+            buffer.resize(slab);
+            int* p = buffer.ints.data();
+            p = std::copy(slab.face_ptr, slab.face_ptr + nf + 1, p);
+            p = std::copy(slab.face_nodes, slab.face_nodes + slab.face_ptr[nf], p);
+            p = std::copy(slab.face_neighbors, slab.face_neighbors + 2*nf, p);
+            std::copy(slab.active_cells, slab.active_cells + slab.number_of_cells, p);
+            std::copy(slab.node_coordinates, slab.node_coordinates + buffer.doubles.size(),
+                      buffer.doubles.begin());
+        }
+
+        void unpackSlab(SlabBuffer& buffer, processed_slab& slab)
+        {
+            const unsigned nf = slab.number_of_faces[0] + slab.number_of_faces[1] + slab.number_of_faces[2];
+            const int* p = buffer.ints.data();
+            buffer.face_ptr.assign(p, p + nf + 1);
+            p += nf + 1;
+            slab.face_ptr = buffer.face_ptr.data();
+            slab.face_nodes = const_cast<int*>(p);
+            p += buffer.face_ptr[nf];
+            slab.face_neighbors = const_cast<int*>(p);
+            p += 2*nf;
+            slab.active_cells = const_cast<int*>(p);
+            slab.node_coordinates = buffer.doubles.data();
+        }
+
+        /// Run process_grdecl() with the cell rows of the model split into
+        /// one slab per rank of comm, and merge the slabs on rank 0.
+        ///
+        /// Collective. The input is only referenced on rank 0, where a null
+        /// input cancels the processing on all ranks. The output, which is
+        /// identical to the one of process_grdecl(), is only produced on rank 0.
+        /// \return Nonzero on success, consistently on all ranks.
+        int processGrdeclDistributed(const grdecl* input,
+                                     double tolerance,
+                                     const int* is_aquifer_cell,
+                                     int pinchActive,
+                                     processed_grid* output,
+                                     MPI_Comm comm)
+        {
+            int rank = 0;
+            int size = 1;
+            MPI_Comm_rank(comm, &rank);
+            MPI_Comm_size(comm, &size);
+
+            std::array<int, SlabHeaderSize> header{};
+            if (rank == 0 && input) {
+                header[SlabStatus] = process_grdecl_orientation(input, &header[SlabSign], &header[SlabLeftHanded]);
+                std::copy(input->dims, input->dims + 3, header.begin() + SlabNX);
+                header[SlabHasActnum] = input->actnum != nullptr;
+                header[SlabHasAquifer] = is_aquifer_cell != nullptr;
+                header[SlabPinchActive] = pinchActive;
+            }
+            MPI_Bcast(header.data(), header.size(), MPI_INT, 0, comm);
+            MPI_Bcast(&tolerance, 1, MPI_DOUBLE, 0, comm);
+            if (header[SlabStatus] == 0) {
+                return 0;
+            }
+
+            const int nx = header[SlabNX];
+            const int ny = header[SlabNY];
+            const int nz = header[SlabNZ];
+
+            std::vector<double> coord_buffer;
+            std::vector<double> zcorn_buffer;
+            std::vector<int> actnum_buffer;
+            std::vector<int> aquifer_buffer;
+            grdecl window;
+
+            auto resize = [&](int window_begin, int window_end)
+            {
+                const std::size_t nwc = std::size_t(nx) * (window_end - window_begin) * nz;
+                coord_buffer.resize(6 * std::size_t(nx + 1) * (window_end - window_begin + 1));
+                zcorn_buffer.resize(8 * nwc);
+                actnum_buffer.resize(header[SlabHasActnum] ? nwc : 0);
+                aquifer_buffer.resize(header[SlabHasAquifer] ? nwc : 0);
+            };
+
+            processed_slab own_slab;
+
+            if (rank == 0) {
+                // Send the windows of the other ranks before processing our own rows.
+                for (int r = 1; r < size; ++r) {
+                    const auto [j_begin, j_end] = slabRows(ny, r, size);
+                    int window_begin, window_end;
+                    grdecl_slab_window(ny, j_begin, j_end, &window_begin, &window_end);
+                    resize(window_begin, window_end);
+                    extract_grdecl_window(input, is_aquifer_cell, window_begin, window_end, &window,
+                                          zcorn_buffer.data(), actnum_buffer.data(), aquifer_buffer.data());
+                    MPI_Send(window.coord, coord_buffer.size(), MPI_DOUBLE, r, SlabCoordTag, comm);
+                    MPI_Send(zcorn_buffer.data(), zcorn_buffer.size(), MPI_DOUBLE, r, SlabZcornTag, comm);
+                    MPI_Send(actnum_buffer.data(), actnum_buffer.size(), MPI_INT, r, SlabActnumTag, comm);
+                    MPI_Send(aquifer_buffer.data(), aquifer_buffer.size(), MPI_INT, r, SlabAquiferTag, comm);
+                }
+            }
+
+            const auto [j_begin, j_end] = slabRows(ny, rank, size);
+            int window_begin, window_end;
+            grdecl_slab_window(ny, j_begin, j_end, &window_begin, &window_end);
+            resize(window_begin, window_end);
+
+            if (rank == 0) {
+                extract_grdecl_window(input, is_aquifer_cell, window_begin, window_end, &window,
+                                      zcorn_buffer.data(), actnum_buffer.data(), aquifer_buffer.data());
+            } else {
+                MPI_Recv(coord_buffer.data(), coord_buffer.size(), MPI_DOUBLE, 0, SlabCoordTag, comm, MPI_STATUS_IGNORE);
+                MPI_Recv(zcorn_buffer.data(), zcorn_buffer.size(), MPI_DOUBLE, 0, SlabZcornTag, comm, MPI_STATUS_IGNORE);
+                MPI_Recv(actnum_buffer.data(), actnum_buffer.size(), MPI_INT, 0, SlabActnumTag, comm, MPI_STATUS_IGNORE);
+                MPI_Recv(aquifer_buffer.data(), aquifer_buffer.size(), MPI_INT, 0, SlabAquiferTag, comm, MPI_STATUS_IGNORE);
+                window.dims[0] = nx;
+                window.dims[1] = window_end - window_begin;
+                window.dims[2] = nz;
+                window.coord = coord_buffer.data();
+                window.zcorn = zcorn_buffer.data();
+                window.actnum = header[SlabHasActnum] ? actnum_buffer.data() : nullptr;
+            }
+
+            int ok = process_grdecl_slab(&window, window_begin, j_begin, j_end, ny,
+                                         header[SlabSign], header[SlabLeftHanded], tolerance,
+                                         header[SlabHasAquifer] ? aquifer_buffer.data() : nullptr,
+                                         &own_slab, header[SlabPinchActive]);
+
+            // Rank 0 allocates the grid from the sizes of all slabs, and
+            // then merges and releases one slab at a time as they arrive.
+            const auto own_sizes = slabSizes(ok, own_slab);
+            std::vector<int> sizes(rank == 0 ? size * SlabSizeCount : 0);
+            MPI_Gather(own_sizes.data(), SlabSizeCount, MPI_INT,
+                       sizes.data(), SlabSizeCount, MPI_INT, 0, comm);
+
+            auto slabLayout = [&](int r)
+            {
+                processed_slab slab{};
+                std::copy(header.begin() + SlabNX, header.begin() + SlabNX + 3, slab.dimensions);
+                std::tie(slab.j_begin, slab.j_end) = slabRows(ny, r, size);
+                setSlabSizes(sizes.data() + r * SlabSizeCount, slab);
+                return slab;
+            };
+
+            slab_merge merge;
+            if (rank == 0) {
+                std::vector<processed_slab> layout(size);
+                for (int r = 0; r < size; ++r) {
+                    ok = ok && sizes[r * SlabSizeCount + SlabOk];
+                    layout[r] = slabLayout(r);
+                }
+                if (ok) {
+                    ok = begin_slab_merge(size, layout.data(), &merge, output);
+                }
+            }
+            MPI_Bcast(&ok, 1, MPI_INT, 0, comm);
+            if (!ok) {
+                free_processed_slab(&own_slab);
+                return 0;
+            }
+
+            if (rank == 0) {
+                merge_slab(&merge, 0, &own_slab, output);
+                free_processed_slab(&own_slab);
+                SlabBuffer buffer;
+                for (int r = 1; r < size; ++r) {
+                    processed_slab slab = slabLayout(r);
+                    buffer.resize(slab);
+                    MPI_Recv(buffer.ints.data(), buffer.ints.size(), MPI_INT, r, SlabIntTag, comm, MPI_STATUS_IGNORE);
+                    MPI_Recv(buffer.doubles.data(), buffer.doubles.size(), MPI_DOUBLE, r, SlabDoubleTag, comm, MPI_STATUS_IGNORE);
+                    unpackSlab(buffer, slab);
+                    merge_slab(&merge, r, &slab, output);
+                }
+                ok = end_slab_merge(&merge, output);
+            } else {
+                SlabBuffer buffer;
+                packSlab(own_slab, buffer);
+                free_processed_slab(&own_slab);
+                MPI_Send(buffer.ints.data(), buffer.ints.size(), MPI_INT, 0, SlabIntTag, comm);
+                MPI_Send(buffer.doubles.data(), buffer.doubles.size(), MPI_DOUBLE, 0, SlabDoubleTag, comm);
+            }
+
+            MPI_Bcast(&ok, 1, MPI_INT, 0, comm);
+            return ok;
+        }
+#endif // HAVE_MPI
     } // anon namespace
 } // namespace Dune
 
@@ -49,7 +49,7 @@ namespace Dune
     template< int dim, int dimworld, class coord_t, int codim >
     struct canCommunicate< PolyhedralGrid< dim, dimworld, coord_t >, codim >
     {
-        static const bool v = false;
+        static const bool v = (codim == 0);
     };
 
 
@@ -0,0 +1,158 @@
+// -*- mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=2 sw=2 sts=2:
+#ifndef DUNE_POLYHEDRALGRID_COMMUNICATION_HH
+#define DUNE_POLYHEDRALGRID_COMMUNICATION_HH
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <dune/grid/common/gridenums.hh>
+
+#if HAVE_MPI
+#include <dune/common/parallel/variablesizecommunicator.hh>
+#endif
+
+namespace Dune
+{
+
+  // PolyhedralGridMessageBuffer
+  // ---------------------------
+
+  /** \brief message buffer for moving data between entities on the same process */
+  template< class T >
+  class PolyhedralGridMessageBuffer
+  {
+  public:
+    void write ( const T& value )
+    {
+      data_.push_back( value );
+    }
+
+    void read ( T& value )
+    {
+      value = data_[ pos_++ ];
+    }
+
+  private:
+    std::vector< T > data_;
+    std::size_t pos_ = 0;
+  };
+
+#if HAVE_MPI
+
+  // PolyhedralGridInterfaces
+  // ------------------------
+
+  /** \brief communication interfaces of the cells of a distributed PolyhedralGrid
+   *
+   *  One interface map per InterfaceType, mapping each neighboring process to
+   *  the local indices of the cells to send and to receive.
+   */
+  class PolyhedralGridInterfaces
+  {
+  public:
+    typedef VariableSizeCommunicator<>::InterfaceMap InterfaceMap;
+    //! cells to send and to receive for each process
+    typedef std::map< int, std::pair< std::vector< int >, std::vector< int > > > IndexLists;
+
+    PolyhedralGridInterfaces () = default;
+    PolyhedralGridInterfaces ( const PolyhedralGridInterfaces& ) = delete;
+    PolyhedralGridInterfaces& operator= ( const PolyhedralGridInterfaces& ) = delete;
+
+    ~PolyhedralGridInterfaces ()
+    {
+      clear();
+    }
+
+    /** \brief set the cells to send and to receive for an interface */
+    void set ( InterfaceType iftype, const IndexLists& lists )
+    {
+      InterfaceMap& interfaces = interfaces_[ iftype ];
+      for( const auto& [ proc, indices ] : lists )
+      {
+        auto& [ send, recv ] = interfaces[ proc ];
+        send.reserve( indices.first.size() );
+        for( int index : indices.first )
+          send.add( index );
+        recv.reserve( indices.second.size() );
+        for( int index : indices.second )
+          recv.add( index );
+      }
+    }
+
+    const InterfaceMap& operator[] ( InterfaceType iftype ) const
+    {
+      return interfaces_[ iftype ];
+    }
+
+    void clear ()
+    {
+      for( auto& interfaces : interfaces_ )
+      {
+        for( auto& interface : interfaces )
+        {
+          interface.second.first.free();
+          interface.second.second.free();
+        }
+        interfaces.clear();
+      }
+    }
+
+  private:
+    std::array< InterfaceMap, 5 > interfaces_;
+  };
+
+
+
+  // PolyhedralGridIndexDataHandle
+  // -----------------------------
+
+  /** \brief wraps a dune-grid data handle into one based on the indices of
+   *         the entities, as needed by the VariableSizeCommunicator
+   */
+  template< class Grid, class DataHandle, int codim >
+  class PolyhedralGridIndexDataHandle
+  {
+    typedef typename Grid::template Codim< codim >::EntitySeed EntitySeed;
+
+  public:
+    typedef typename DataHandle::DataType DataType;
+
+    PolyhedralGridIndexDataHandle ( const Grid& grid, DataHandle& data )
+      : grid_( grid ), data_( data )
+    {}
+
+    bool fixedSize ()
+    {
+      return data_.fixedSize( Grid::dimension, codim );
+    }
+
+    std::size_t size ( std::size_t i )
+    {
+      return data_.size( grid_.entity( EntitySeed( i ) ) );
+    }
+
+    template< class B >
+    void gather ( B& buffer, std::size_t i )
+    {
+      data_.gather( buffer, grid_.entity( EntitySeed( i ) ) );
+    }
+
+    template< class B >
+    void scatter ( B& buffer, std::size_t i, std::size_t s )
+    {
+      data_.scatter( buffer, grid_.entity( EntitySeed( i ) ), s );
+    }
+
+  private:
+    const Grid& grid_;
+    DataHandle& data_;
+  };
+
+#endif // #if HAVE_MPI
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_POLYHEDRALGRID_COMMUNICATION_HH
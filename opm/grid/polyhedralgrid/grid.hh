@@ -3,7 +3,12 @@
 #ifndef DUNE_POLYHEDRALGRID_GRID_HH
 #define DUNE_POLYHEDRALGRID_GRID_HH
 
+#include <algorithm>
+#include <array>
+#include <map>
 #include <set>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 // Warning suppression for Dune includes.
@@ -20,6 +25,7 @@
 
 //- polyhedralgrid includes
 #include <opm/grid/polyhedralgrid/capabilities.hh>
+#include <opm/grid/polyhedralgrid/communication.hh>
 #include <opm/grid/polyhedralgrid/declaration.hh>
 #include <opm/grid/polyhedralgrid/entity.hh>
 #include <opm/grid/polyhedralgrid/entityseed.hh>
@@ -33,7 +39,10 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/GridUtilities.hpp>
 #include <opm/grid/cart_grid.h>
+#include <opm/grid/common/CellGraphPartition.hpp>
+#include <opm/grid/common/GridEnums.hpp>
 #include <opm/grid/cpgpreprocess/preprocess.h>
 #include <opm/grid/GridManager.hpp>
 #include <opm/grid/cornerpoint_grid.h>
@@ -327,7 +336,7 @@ namespace Dune
     explicit PolyhedralGrid ( const Opm::EclipseGrid& inputGrid,
                               const std::vector<double>& poreVolumes = std::vector<double> ())
     : gridPtr_( createGrid( inputGrid, poreVolumes ) ),
-      grid_( *gridPtr_ ),
+      grid_( gridPtr_.get() ),
       comm_( MPIHelper::getCommunicator() ),
       leafIndexSet_( *this ),
       globalIdSet_( *this ),
@@ -346,7 +355,7 @@ namespace Dune
     explicit PolyhedralGrid ( const std::vector< int >& n,
                               const std::vector< double >& dx )
     : gridPtr_( createGrid( n, dx ) ),
-      grid_( *gridPtr_ ),
+      grid_( gridPtr_.get() ),
       comm_( MPIHelper::getCommunicator()),
       leafIndexSet_( *this ),
       globalIdSet_( *this ),
@@ -364,7 +373,7 @@ namespace Dune
      */
     explicit PolyhedralGrid ( UnstructuredGridPtr &&gridPtr )
     : gridPtr_( std::move( gridPtr ) ),
-      grid_( *gridPtr_ ),
+      grid_( gridPtr_.get() ),
       comm_( MPIHelper::getCommunicator() ),
       leafIndexSet_( *this ),
       globalIdSet_( *this ),
@@ -383,7 +392,7 @@ namespace Dune
      */
     explicit PolyhedralGrid ( const UnstructuredGridType& grid )
     : gridPtr_(),
-      grid_( grid ),
+      grid_( &grid ),
       comm_( MPIHelper::getCommunicator() ),
       leafIndexSet_( *this ),
       globalIdSet_( *this ),
@@ -397,7 +406,7 @@ namespace Dune
 
     /** \name Casting operators
      *  \{ */
-    operator const UnstructuredGridType& () const { return grid_; }
+    operator const UnstructuredGridType& () const { return *grid_; }
 
     /** \} */
 
@@ -439,15 +448,15 @@ namespace Dune
     {
       if( codim == 0 )
       {
-        return grid_.number_of_cells;
+        return grid_->number_of_cells;
       }
       else if ( codim == 1 )
       {
-        return grid_.number_of_faces;
+        return grid_->number_of_faces;
       }
       else if ( codim == dim )
       {
-        return grid_.number_of_nodes;
+        return grid_->number_of_nodes;
       }
       else
       {
@@ -612,9 +621,9 @@ namespace Dune
      *
      *  \param[in]  codim  codimension for with the information is desired
      */
-    int overlapSize ( int /* codim */) const
+    int overlapSize ( int codim ) const
     {
-      return 0;
+      return ( codim == 0 && isDistributed() ) ? 1 : 0;
     }
 
     /** \brief obtain size of ghost region for the leaf grid
@@ -631,9 +640,9 @@ namespace Dune
      *  \param[in]  level  grid level (0, ..., maxLevel())
      *  \param[in]  codim  codimension (0, ..., dimension)
      */
-    int overlapSize ( int /* level */, int /* codim */ ) const
+    int overlapSize ( int /* level */, int codim ) const
     {
-      return 0;
+      return overlapSize( codim );
     }
 
     /** \brief obtain size of ghost region for a grid level
@@ -660,12 +669,12 @@ namespace Dune
      *  \param[in]  level       grid level to communicate
      */
     template< class DataHandle>
-    void communicate ( DataHandle& /* dataHandle */,
-                       InterfaceType /* interface */,
-                       CommunicationDirection /* direction */,
+    void communicate ( DataHandle& dataHandle,
+                       InterfaceType interface,
+                       CommunicationDirection direction,
                        int /* level */ ) const
     {
-        OPM_THROW(std::runtime_error, "communicate not implemented for polyhedreal grid!");
+      communicate( dataHandle, interface, direction );
     }
 
     /** \brief communicate information on leaf entities
@@ -679,13 +688,27 @@ namespace Dune
      *                          All_All_Interface)
      *  \param[in]  direction   communication direction (one of
      *                          ForwardCommunication, BackwardCommunication)
+     *
+     *  \note Only data attached to cells is communicated. There are no
+     *        border entities, hence InteriorBorder_InteriorBorder_Interface
+     *        does not communicate anything.
      */
     template< class DataHandle>
-    void communicate ( DataHandle& /* dataHandle */,
-                       InterfaceType /* interface */,
-                       CommunicationDirection /* direction */ ) const
-    {
-        OPM_THROW(std::runtime_error, "communicate not implemented for polyhedreal grid!");
+    void communicate ( [[maybe_unused]] DataHandle& dataHandle,
+                       [[maybe_unused]] InterfaceType interface,
+                       [[maybe_unused]] CommunicationDirection direction ) const
+    {
+#if HAVE_MPI
+      if( !dataHandle.contains( dim, 0 ) )
+        return;
+
+      PolyhedralGridIndexDataHandle< Grid, DataHandle, 0 > dataWrapper( *this, dataHandle );
+      VariableSizeCommunicator<> communicator( comm(), cellInterfaces_[ interface ] );
+      if( direction == ForwardCommunication )
+        communicator.forward( dataWrapper );
+      else
+        communicator.backward( dataWrapper );
+#endif
     }
 
     /// \brief Switch to the global view.
@@ -715,59 +738,52 @@ namespace Dune
 
     // data handle interface different between geo and interface
 
-    /** \brief rebalance the load each process has to handle
+    /** \brief distribute the grid among the processes
      *
-     *  A parallel grid is redistributed such that each process has about
-     *  the same load (e.g., the same number of leaf entites).
-     *
-     *  \note DUNE does not specify, how the load is measured.
+     *  The cells are partitioned with Zoltan or METIS, if available, and each
+     *  process keeps the cells it owns plus one layer of face neighbors as
+     *  overlap. The whole grid needs to be present on every process, which
+     *  is the case if all of them constructed it from the same input.
      *
      *  \returns \b true, if the grid has changed.
      */
     bool loadBalance ()
     {
-      return false ;
+      return loadBalance( defaultPartitionMethod() );
     }
 
-    /** \brief rebalance the load each process has to handle
-     *
-     *  A parallel grid is redistributed such that each process has about
-     *  the same load (e.g., the same number of leaf entites).
+    /** \brief distribute the grid among the processes
      *
-     *  The data handle is used to communicate the data associated with
-     *  entities that move from one process to another.
-     *
-     *  \note DUNE does not specify, how the load is measured.
-     *
-     *  \param  datahandle  communication data handle (user defined)
+     *  \param  method        Zoltan, METIS, or simple. The latter splits the
+     *                        cells into chunks of consecutive indices.
+     *  \param  imbalanceTol  imbalance tolerance of Zoltan and METIS
+     *  \param  params        additional parameters for Zoltan or METIS
      *
      *  \returns \b true, if the grid has changed.
      */
-
-    template< class DataHandle, class Data >
-    bool loadBalance ( CommDataHandleIF< DataHandle, Data >& /* datahandle */ )
+    bool loadBalance ( PartitionMethod method, double imbalanceTol = 1.1,
+                       const std::map< std::string, std::string >& params = {} )
     {
-      return false;
+      return distributeGrid( method, imbalanceTol, params, static_cast< NoDataHandle* >( nullptr ) );
     }
 
-    /** \brief rebalance the load each process has to handle
-     *
-     *  A parallel grid is redistributed such that each process has about
-     *  the same load (e.g., the same number of leaf entites).
-     *
-     *  The data handle is used to communicate the data associated with
-     *  entities that move from one process to another.
+    /** \brief distribute the grid among the processes
      *
-     *  \note DUNE does not specify, how the load is measured.
+     *  The data handle is used to move the data attached to the cells, faces,
+     *  and vertices of the whole grid to the entities of the distributed grid.
      *
-     *  \param  dataHandle  data handle following the ALUGrid interface
+     *  \param  dataHandle    communication data handle (user defined)
+     *  \param  method        Zoltan, METIS, or simple
+     *  \param  imbalanceTol  imbalance tolerance of Zoltan and METIS
      *
      *  \returns \b true, if the grid has changed.
      */
-    template< class DofManager >
-    bool loadBalance ( DofManager& /* dofManager */ )
+    template< class DataHandle >
+    bool loadBalance ( DataHandle& dataHandle,
+                       PartitionMethod method = defaultPartitionMethod(),
+                       double imbalanceTol = 1.1 )
     {
-      return false;
+      return distributeGrid( method, imbalanceTol, {}, &dataHandle );
     }
 
     /** \brief View for a grid level */
@@ -848,13 +864,13 @@ namespace Dune
 
     const int* globalCell() const
     {
-      assert( grid_.global_cell != 0 );
-      return grid_.global_cell;
+      assert( grid_->global_cell != 0 );
+      return grid_->global_cell;
     }
 
     const int* globalCellPtr() const
     {
-      return grid_.global_cell;
+      return grid_->global_cell;
     }
 
     void getIJK(const int c, std::array<int,3>& ijk) const
@@ -973,7 +989,7 @@ namespace Dune
       if (codim==0)
         return cellVertices_[ index ].size();
       if (codim==1)
-        return grid_.face_nodepos[ index+1 ] - grid_.face_nodepos[ index ];
+        return grid_->face_nodepos[ index+1 ] - grid_->face_nodepos[ index ];
       if (codim==dim)
          return 1;
       return 0;
@@ -987,7 +1003,7 @@ namespace Dune
       if (codim==0)
       {
         const int coordIndex = GlobalCoordinate :: dimension * cellVertices_[ seed.index() ][ i ];
-          return copyToGlobalCoordinate( grid_.node_coordinates + coordIndex );
+          return copyToGlobalCoordinate( grid_->node_coordinates + coordIndex );
       }
       if (codim==1)
       {
@@ -996,13 +1012,13 @@ namespace Dune
         // TODO: Improve this for performance reasons
         const int crners = corners( seed );
         const int crner  = (crners == 4 && EntitySeed :: dimension == 3 && i > 1 ) ? 5 - i : i;
-        const int faceVertex = grid_.face_nodes[ grid_.face_nodepos[seed.index() ] + crner ];
-        return copyToGlobalCoordinate( grid_.node_coordinates + GlobalCoordinate :: dimension * faceVertex );
+        const int faceVertex = grid_->face_nodes[ grid_->face_nodepos[seed.index() ] + crner ];
+        return copyToGlobalCoordinate( grid_->node_coordinates + GlobalCoordinate :: dimension * faceVertex );
       }
       if (codim==dim)
       {
         const int coordIndex = GlobalCoordinate :: dimension * seed.index();
-        return copyToGlobalCoordinate( grid_.node_coordinates + coordIndex );
+        return copyToGlobalCoordinate( grid_->node_coordinates + coordIndex );
       }      
       return GlobalCoordinate( 0 );
     }
@@ -1016,7 +1032,7 @@ namespace Dune
         if (codim==0)
           return 1;
         if (codim==1)
-          return grid_.cell_facepos[ index+1 ] - grid_.cell_facepos[ index ];
+          return grid_->cell_facepos[ index+1 ] - grid_->cell_facepos[ index ];
         if (codim==dim)
           return cellVertices_[ index ].size();
       }
@@ -1025,7 +1041,7 @@ namespace Dune
         if (codim==1)
           return 1;
         if (codim==dim)
-          return grid_.face_nodepos[ index+1 ] - grid_.face_nodepos[ index ];
+          return grid_->face_nodepos[ index+1 ] - grid_->face_nodepos[ index ];
       }
       else if ( seed.codimension == dim )
       {
@@ -1053,7 +1069,7 @@ namespace Dune
       {
         if ( codim == 1 )
         {
-          return EntitySeed( grid_.cell_faces[ grid_.cell_facepos[ baseSeed.index() ] + i ] );
+          return EntitySeed( grid_->cell_faces[ grid_->cell_facepos[ baseSeed.index() ] + i ] );
         }
         else if ( codim == dim )
         {
@@ -1062,7 +1078,7 @@ namespace Dune
       }
       else if ( EntitySeedArg::codimension == 1 && codim == dim )
       {
-        return EntitySeed( grid_.face_nodes[ grid_.face_nodepos[ baseSeed.index() + i ] ]);
+        return EntitySeed( grid_->face_nodes[ grid_->face_nodepos[ baseSeed.index() + i ] ]);
       }
 
       DUNE_THROW(NotImplemented,"codimension not available");
@@ -1081,7 +1097,7 @@ namespace Dune
       }
       else if ( codim == dim )
       {
-        return EntitySeed( grid_.face_nodes[ grid_.face_nodepos[ faceSeed.index() ] + i ] );
+        return EntitySeed( grid_->face_nodes[ grid_->face_nodepos[ faceSeed.index() ] + i ] );
       }
       else
       {
@@ -1103,9 +1119,9 @@ namespace Dune
 
     bool isBoundaryFace(const int face ) const
     {
-      assert( face >= 0 && face < grid_.number_of_faces );
+      assert( face >= 0 && face < grid_->number_of_faces );
       const int facePos = 2 * face;
-      return ((grid_.face_cells[ facePos ] < 0) || (grid_.face_cells[ facePos+1 ] < 0));
+      return ((grid_->face_cells[ facePos ] < 0) || (grid_->face_cells[ facePos+1 ] < 0));
     }
 
     bool isBoundaryFace(const typename Codim<1>::EntitySeed& faceSeed ) const
@@ -1119,7 +1135,7 @@ namespace Dune
       const auto faceSeed = this->template subEntitySeed<1>( seed, face );
       assert( faceSeed.isValid() );
       const int facePos = 2 * faceSeed.index();
-      const int idx = std::min( grid_.face_cells[ facePos ], grid_.face_cells[ facePos+1 ]);
+      const int idx = std::min( grid_->face_cells[ facePos ], grid_->face_cells[ facePos+1 ]);
       // check that this is actually the boundary
       assert( idx < 0 );
       return -(idx+1); // +1 to include 0 boundary segment index
@@ -1168,23 +1184,23 @@ namespace Dune
 
     int indexInInside( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
-      return ( grid_.cell_facetag ) ? cartesianIndexInInside( seed, i ) : i;
+      return ( grid_->cell_facetag ) ? cartesianIndexInInside( seed, i ) : i;
     }
 
     int cartesianIndexInInside( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
       assert( i>= 0 && i<subEntities( seed, 1 ) );
-      return grid_.cell_facetag[ grid_.cell_facepos[ seed.index() ] + i ] ;
+      return grid_->cell_facetag[ grid_->cell_facepos[ seed.index() ] + i ] ;
     }
 
     typename Codim<0>::EntitySeed
     neighbor( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
       const int face = this->template subEntitySeed<1>( seed, i ).index();
-      int nb = grid_.face_cells[ 2 * face ];
+      int nb = grid_->face_cells[ 2 * face ];
       if( nb == seed.index() )
       {
-        nb = grid_.face_cells[ 2 * face + 1 ];
+        nb = grid_->face_cells[ 2 * face + 1 ];
       }
 
       typedef typename Codim<0>::EntitySeed EntitySeed;
@@ -1194,7 +1210,7 @@ namespace Dune
     int
     indexInOutside( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
-      if( grid_.cell_facetag )
+      if( grid_->cell_facetag )
       {
         // if cell_facetag is present we assume pseudo Cartesian corner point case
         const int in_inside = cartesianIndexInInside( seed, i );
@@ -1223,8 +1239,8 @@ namespace Dune
     {
       const int face  = this->template subEntitySeed<1>( seed, i ).index();
       const int normalIdx = face * GlobalCoordinate :: dimension ;
-      GlobalCoordinate normal = copyToGlobalCoordinate( grid_.face_normals + normalIdx );
-      const int nb = grid_.face_cells[ 2*face ];
+      GlobalCoordinate normal = copyToGlobalCoordinate( grid_->face_normals + normalIdx );
+      const int nb = grid_->face_cells[ 2*face ];
       if( nb != seed.index() )
       {
         normal *= -1.0;
@@ -1237,7 +1253,7 @@ namespace Dune
     unitOuterNormal( const EntitySeed& seed, const int i ) const
     {
       const int face  = this->template subEntitySeed<1>( seed, i ).index();
-      if( seed.index() == grid_.face_cells[ 2*face ] )
+      if( seed.index() == grid_->face_cells[ 2*face ] )
       {
         return unitOuterNormals_[ face ];
       }
@@ -1261,15 +1277,15 @@ namespace Dune
 
       if( codim == 0 )
       {
-        return copyToGlobalCoordinate( grid_.cell_centroids + index );
+        return copyToGlobalCoordinate( grid_->cell_centroids + index );
       }
       else if ( codim == 1 )
       {
-        return copyToGlobalCoordinate( grid_.face_centroids + index );
+        return copyToGlobalCoordinate( grid_->face_centroids + index );
       }
       else if( codim == dim )
       {
-        return copyToGlobalCoordinate( grid_.node_coordinates + index );
+        return copyToGlobalCoordinate( grid_->node_coordinates + index );
       }
       else
       {
@@ -1302,11 +1318,11 @@ namespace Dune
 
         if( codim == 0 )
         {
-          return grid_.cell_volumes[ seed.index() ];
+          return grid_->cell_volumes[ seed.index() ];
         }
         else if ( codim == 1 )
         {
-          return grid_.face_areas[ seed.index() ];
+          return grid_->face_areas[ seed.index() ];
         }
         else
         {
@@ -1316,13 +1332,257 @@ namespace Dune
       }
     }
 
+    template <class EntitySeed>
+    PartitionType partitionType( const EntitySeed& seed ) const
+    {
+      const auto& types = partitionTypes_[ EntitySeed::codimension ];
+      return types.empty() ? InteriorEntity : types[ seed.index() ];
+    }
+
+    /** \brief index of an entity in the grid before it was distributed */
+    int globalIndex( const int codim, const int index ) const
+    {
+      const auto& indices = globalIndices_[ codim ];
+      return indices.empty() ? index : indices[ index ];
+    }
+
+    /** \brief number of entities in the grid before it was distributed */
+    int globalSize( const int codim ) const
+    {
+      return globalIndices_[ codim ].empty() ? size( codim ) : globalSizes_[ codim ];
+    }
+
+    bool isDistributed() const
+    {
+      return !globalIndices_[ 0 ].empty();
+    }
+
   protected:
+    //! marker for distributing the grid without data
+    struct NoDataHandle {};
+
+    static PartitionMethod defaultPartitionMethod ()
+    {
+#if defined(HAVE_ZOLTAN)
+      return PartitionMethod::zoltan;
+#elif defined(HAVE_METIS)
+      return PartitionMethod::metis;
+#else
+      return PartitionMethod::simple;
+#endif
+    }
+
+    template< class DataHandle >
+    bool distributeGrid ( PartitionMethod method, double imbalanceTol,
+                          const std::map< std::string, std::string >& params,
+                          DataHandle* dataHandle )
+    {
+      if( comm().size() == 1 )
+        return false;
+      if( isDistributed() )
+        OPM_THROW(std::logic_error, "The polyhedral grid is already distributed!");
+
+      const int numCells = size( 0 );
+      if( comm().min( numCells ) != comm().max( numCells ) )
+        OPM_THROW(std::logic_error, "Load balancing a polyhedral grid needs the whole grid on every process!");
+
+      // graph of the cells connected by faces
+      std::vector< int > offsets( numCells + 1, 0 );
+      std::vector< int > neighbors;
+      neighbors.reserve( grid_->cell_facepos[ numCells ] );
+      for( int c = 0; c < numCells; ++c )
+      {
+        for( int hf = grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[ c+1 ]; ++hf )
+        {
+          const int face = grid_->cell_faces[ hf ];
+          const int nb = grid_->face_cells[ 2*face ] == c ? grid_->face_cells[ 2*face+1 ] : grid_->face_cells[ 2*face ];
+          if( nb >= 0 )
+            neighbors.push_back( nb );
+        }
+        std::sort( neighbors.begin() + offsets[ c ], neighbors.end() );
+        neighbors.erase( std::unique( neighbors.begin() + offsets[ c ], neighbors.end() ), neighbors.end() );
+        offsets[ c+1 ] = neighbors.size();
+      }
+
+      const std::vector< int > parts = cpgrid::partitionCellGraph( offsets, neighbors, comm(), method, imbalanceTol, params );
+
+      // owned cells and one layer of face neighbors as overlap
+      const int rank = comm().rank();
+      std::vector< int > cells;
+      int owned = 0;
+      for( int c = 0; c < numCells; ++c )
+      {
+        bool local = parts[ c ] == rank;
+        owned += local;
+        for( int j = offsets[ c ]; !local && j < offsets[ c+1 ]; ++j )
+          local = parts[ neighbors[ j ] ] == rank;
+        if( local )
+          cells.push_back( c );
+      }
+      if( comm().min( owned ) == 0 )
+        OPM_THROW(std::logic_error, "A process would not own any cells of the polyhedral grid!");
+
+#if HAVE_MPI
+      // Cells present on two processes are sent and received in the order of
+      // their global index, on both of them.
+      std::array< PolyhedralGridInterfaces::IndexLists, 5 > lists;
+      std::vector< int > procs;
+      for( std::size_t l = 0; l < cells.size(); ++l )
+      {
+        const int c = cells[ l ];
+        procs.assign( 1, parts[ c ] );
+        for( int j = offsets[ c ]; j < offsets[ c+1 ]; ++j )
+          procs.push_back( parts[ neighbors[ j ] ] );
+        std::sort( procs.begin(), procs.end() );
+        procs.erase( std::unique( procs.begin(), procs.end() ), procs.end() );
+
+        const bool ownedHere = parts[ c ] == rank;
+        for( const int p : procs )
+        {
+          if( p == rank )
+            continue;
+          const bool ownedThere = parts[ c ] == p;
+          if( ownedHere )
+            lists[ InteriorBorder_All_Interface ][ p ].first.push_back( l );
+          if( ownedThere )
+            lists[ InteriorBorder_All_Interface ][ p ].second.push_back( l );
+          if( !ownedHere && !ownedThere )
+          {
+            lists[ Overlap_OverlapFront_Interface ][ p ].first.push_back( l );
+            lists[ Overlap_OverlapFront_Interface ][ p ].second.push_back( l );
+          }
+          if( !ownedHere )
+            lists[ Overlap_All_Interface ][ p ].first.push_back( l );
+          if( !ownedThere )
+            lists[ Overlap_All_Interface ][ p ].second.push_back( l );
+          lists[ All_All_Interface ][ p ].first.push_back( l );
+          lists[ All_All_Interface ][ p ].second.push_back( l );
+        }
+      }
+#endif
+
+      std::vector< int > faces, nodes;
+      UnstructuredGridPtr localGrid( Opm::extractSubGrid( *grid_, cells, faces, nodes ) );
+      if( dim == 2 && localGrid->cell_facetag )
+      {
+        // init() reorders the faces of 2d Cartesian cells, which was already done for the whole grid
+        for( int c = 0; c < localGrid->number_of_cells; ++c )
+        {
+          const int f = localGrid->cell_facepos[ c ];
+          std::swap( localGrid->cell_faces[ f+1 ], localGrid->cell_faces[ f+2 ] );
+          std::swap( localGrid->cell_facetag[ f+1 ], localGrid->cell_facetag[ f+2 ] );
+        }
+      }
+
+      // gather the data from the entities of the whole grid
+      PolyhedralGridMessageBuffer< typename DataTypeOf< DataHandle >::type > buffer;
+      std::array< std::vector< std::size_t >, dim+1 > dataSizes;
+      if constexpr( !std::is_same_v< DataHandle, NoDataHandle > )
+      {
+        gatherData< 0 >( *dataHandle, cells, buffer, dataSizes[ 0 ] );
+        gatherData< 1 >( *dataHandle, faces, buffer, dataSizes[ 1 ] );
+        gatherData< dim >( *dataHandle, nodes, buffer, dataSizes[ dim ] );
+      }
+
+      globalSizes_.fill( 0 );
+      globalSizes_[ 0 ] = numCells;
+      globalSizes_[ 1 ] = grid_->number_of_faces;
+      globalSizes_[ dim ] = grid_->number_of_nodes;
+
+      // The whole grid is released here, unless it is owned by the caller.
+      gridPtr_ = std::move( localGrid );
+      grid_ = gridPtr_.get();
+      geomTypes_.clear();
+      cellVertices_.clear();
+      unitOuterNormals_.clear();
+      init();
+
+      globalIndices_[ 0 ] = std::move( cells );
+      globalIndices_[ 1 ] = std::move( faces );
+      globalIndices_[ dim ] = std::move( nodes );
+      globalIdSet_.update();
+      localIdSet_.update();
+
+      // Faces and vertices of owned cells are interior, all others overlap.
+      for( auto& types : partitionTypes_ )
+        types.clear();
+      partitionTypes_[ 0 ].resize( size( 0 ) );
+      partitionTypes_[ 1 ].assign( size( 1 ), OverlapEntity );
+      partitionTypes_[ dim ].assign( size( dim ), OverlapEntity );
+      for( int c = 0; c < size( 0 ); ++c )
+      {
+        const bool interior = parts[ globalIndices_[ 0 ][ c ] ] == rank;
+        partitionTypes_[ 0 ][ c ] = interior ? InteriorEntity : OverlapEntity;
+        if( !interior )
+          continue;
+        for( int hf = grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[ c+1 ]; ++hf )
+          partitionTypes_[ 1 ][ grid_->cell_faces[ hf ] ] = InteriorEntity;
+        for( const int vertex : cellVertices_[ c ] )
+          partitionTypes_[ dim ][ vertex ] = InteriorEntity;
+      }
+
+#if HAVE_MPI
+      cellInterfaces_.clear();
+      for( const InterfaceType iftype : { InteriorBorder_All_Interface, Overlap_OverlapFront_Interface,
+                                          Overlap_All_Interface, All_All_Interface } )
+        cellInterfaces_.set( iftype, lists[ iftype ] );
+#endif
+
+      // scatter the data to the entities of the distributed grid
+      if constexpr( !std::is_same_v< DataHandle, NoDataHandle > )
+      {
+        scatterData< 0 >( *dataHandle, buffer, dataSizes[ 0 ] );
+        scatterData< 1 >( *dataHandle, buffer, dataSizes[ 1 ] );
+        scatterData< dim >( *dataHandle, buffer, dataSizes[ dim ] );
+      }
+      return true;
+    }
+
+    template< class DataHandle, class = void >
+    struct DataTypeOf
+    {
+      typedef char type;
+    };
+
+    template< class DataHandle >
+    struct DataTypeOf< DataHandle, std::void_t< typename DataHandle::DataType > >
+    {
+      typedef typename DataHandle::DataType type;
+    };
+
+    template< int codim, class DataHandle, class Buffer >
+    void gatherData ( DataHandle& dataHandle, const std::vector< int >& indices,
+                      Buffer& buffer, std::vector< std::size_t >& sizes ) const
+    {
+      if( !dataHandle.contains( dim, codim ) )
+        return;
+      typedef typename Codim< codim >::EntitySeed EntitySeed;
+      sizes.reserve( indices.size() );
+      for( const int index : indices )
+      {
+        const auto entity = this->entity( EntitySeed( index ) );
+        sizes.push_back( dataHandle.size( entity ) );
+        dataHandle.gather( buffer, entity );
+      }
+    }
+
+    template< int codim, class DataHandle, class Buffer >
+    void scatterData ( DataHandle& dataHandle, Buffer& buffer,
+                       const std::vector< std::size_t >& sizes ) const
+    {
+      if( !dataHandle.contains( dim, codim ) )
+        return;
+      typedef typename Codim< codim >::EntitySeed EntitySeed;
+      for( std::size_t index = 0; index < sizes.size(); ++index )
+        dataHandle.scatter( buffer, this->entity( EntitySeed( index ) ), sizes[ index ] );
+    }
+
     void init ()
     {
       // copy Cartesian dimensions
       for( int i=0; i<3; ++i )
       {
-        cartDims_[ i ] = grid_.cartdims[ i ];
+        cartDims_[ i ] = grid_->cartdims[ i ];
       }
 
       // setup list of cell vertices
@@ -1331,7 +1591,7 @@ namespace Dune
       cellVertices_.resize( numCells );
 
       // sort vertices such that they comply with the dune reference cube
-      if( grid_.cell_facetag )
+      if( grid_->cell_facetag )
       {
         typedef std::array<int, 3> KeyType;
         std::map< const KeyType, const int > vertexFaceTags;
@@ -1362,9 +1622,9 @@ namespace Dune
           if( dim == 2 )
           {
             // for 2d Cartesian grids the face ordering is wrong
-            int f = grid_.cell_facepos[ c ];
-            std::swap( grid_.cell_faces[ f+1 ], grid_.cell_faces[ f+2 ] );
-            std::swap( grid_.cell_facetag[ f+1 ], grid_.cell_facetag[ f+2 ] );
+            int f = grid_->cell_facepos[ c ];
+            std::swap( grid_->cell_faces[ f+1 ], grid_->cell_faces[ f+2 ] );
+            std::swap( grid_->cell_facetag[ f+1 ], grid_->cell_facetag[ f+2 ] );
           }
 
           typedef std::map<int,int> vertexmap_t;
@@ -1372,14 +1632,14 @@ namespace Dune
 
           std::vector< vertexmap_t > cell_pts( dim*2 );
 
-          for (unsigned hf = grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[c+1]; ++hf)
+          for (unsigned hf = grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[c+1]; ++hf)
           {
-            const int f = grid_.cell_faces[ hf ];
-            const int faceTag = grid_.cell_facetag[ hf ];
+            const int f = grid_->cell_faces[ hf ];
+            const int faceTag = grid_->cell_facetag[ hf ];
 
-            for (unsigned nodepos = grid_.face_nodepos[f]; nodepos < grid_.face_nodepos[f+1]; ++nodepos )
+            for (unsigned nodepos = grid_->face_nodepos[f]; nodepos < grid_->face_nodepos[f+1]; ++nodepos )
             {
-              const int node = grid_.face_nodes[ nodepos ];
+              const int node = grid_->face_nodes[ nodepos ];
               iterator it = cell_pts[ faceTag ].find( node );
               if( it == cell_pts[ faceTag ].end() )
               {
@@ -1440,7 +1700,7 @@ namespace Dune
           geomTypes_[codim].push_back(tmp);
         }
       }
-      else // if ( grid_.cell_facetag )
+      else // if ( grid_->cell_facetag )
       {
         int maxVx = 0 ;
         int minVx = std::numeric_limits<int>::max();
@@ -1448,11 +1708,11 @@ namespace Dune
         for (int c = 0; c < numCells; ++c)
         {
           std::set<int> cell_pts;
-          for (unsigned hf = grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[c+1]; ++hf)
+          for (unsigned hf = grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[c+1]; ++hf)
           {
-             int f = grid_.cell_faces[ hf ];
-             const int* fnbeg = grid_.face_nodes + grid_.face_nodepos[f];
-             const int* fnend = grid_.face_nodes + grid_.face_nodepos[f+1];
+             int f = grid_->cell_faces[ hf ];
+             const int* fnbeg = grid_->face_nodes + grid_->face_nodepos[f];
+             const int* fnend = grid_->face_nodes + grid_->face_nodepos[f+1];
              cell_pts.insert(fnbeg, fnend);
           }
 
@@ -1475,14 +1735,14 @@ namespace Dune
 
               for( int d=0; d<dim; ++d )
               {
-                center[ d ] += grid_.node_coordinates[ vertex*dim + d ];
-                p[ i ][ d ]  = grid_.node_coordinates[ vertex*dim + d ];
+                center[ d ] += grid_->node_coordinates[ vertex*dim + d ];
+                p[ i ][ d ]  = grid_->node_coordinates[ vertex*dim + d ];
               }
             }
             center *= 0.25;
             for( int d=0; d<dim; ++d )
             {
-              grid_.cell_centroids[ c*dim + d ] = center[ d ];
+              grid_->cell_centroids[ c*dim + d ] = center[ d ];
             }
 
             Dune::GeometryType simplex;
@@ -1490,21 +1750,21 @@ namespace Dune
 
             typedef Dune::AffineGeometry< ctype, dim, dimworld>  AffineGeometryType;
             AffineGeometryType geometry( simplex, p );
-            grid_.cell_volumes[ c ] = geometry.volume();
+            grid_->cell_volumes[ c ] = geometry.volume();
           }
         }
 
         // check face normals
         {
-          const int faces = grid_.number_of_faces;
+          const int faces = grid_->number_of_faces;
           for( int face = 0 ; face < faces; ++face )
           {
-            const int a = grid_.face_cells[ 2*face     ];
-            const int b = grid_.face_cells[ 2*face + 1 ];
+            const int a = grid_->face_cells[ 2*face     ];
+            const int b = grid_->face_cells[ 2*face + 1 ];
 
             assert( a >=0 || b >=0 );
 
-            if( grid_.face_areas[ face ] < 0 )
+            if( grid_->face_areas[ face ] < 0 )
               std::abort();
 
             GlobalCoordinate centerDiff( 0 );
@@ -1512,14 +1772,14 @@ namespace Dune
             {
               for( int d=0; d<dimworld; ++d )
               {
-                centerDiff[ d ] = grid_.cell_centroids[ b*dimworld + d ];
+                centerDiff[ d ] = grid_->cell_centroids[ b*dimworld + d ];
               }
             }
             else
             {
               for( int d=0; d<dimworld; ++d )
               {
-                centerDiff[ d ] = grid_.face_centroids[ face*dimworld + d ];
+                centerDiff[ d ] = grid_->face_centroids[ face*dimworld + d ];
               }
             }
 
@@ -1527,21 +1787,21 @@ namespace Dune
             {
               for( int d=0; d<dimworld; ++d )
               {
-                centerDiff[ d ] -= grid_.cell_centroids[ a*dimworld + d ];
+                centerDiff[ d ] -= grid_->cell_centroids[ a*dimworld + d ];
               }
             }
             else
             {
               for( int d=0; d<dimworld; ++d )
               {
-                centerDiff[ d ] -= grid_.face_centroids[ face*dimworld + d ];
+                centerDiff[ d ] -= grid_->face_centroids[ face*dimworld + d ];
               }
             }
 
             GlobalCoordinate normal( 0 );
             for( int d=0; d<dimworld; ++d )
             {
-              normal[ d ] = grid_.face_normals[ face*dimworld + d ];
+              normal[ d ] = grid_->face_normals[ face*dimworld + d ];
             }
 
             if( centerDiff.two_norm() < 1e-10 )
@@ -1550,8 +1810,8 @@ namespace Dune
             // if diff and normal point in different direction, flip faces
             if( centerDiff * normal < 0 )
             {
-              grid_.face_cells[ 2*face     ] = b;
-              grid_.face_cells[ 2*face + 1 ] = a;
+              grid_->face_cells[ 2*face     ] = b;
+              grid_->face_cells[ 2*face + 1 ] = a;
             }
           }
         }
@@ -1594,14 +1854,14 @@ namespace Dune
           }
         }
 
-      } // end else of ( grid_.cell_facetag )
+      } // end else of ( grid_->cell_facetag )
 
       nBndSegments_ = 0;
-      unitOuterNormals_.resize( grid_.number_of_faces );
-      for( int face = 0; face < grid_.number_of_faces; ++face )
+      unitOuterNormals_.resize( grid_->number_of_faces );
+      for( int face = 0; face < grid_->number_of_faces; ++face )
       {
         const int normalIdx = face * GlobalCoordinate :: dimension ;
-        GlobalCoordinate normal = copyToGlobalCoordinate( grid_.face_normals + normalIdx );
+        GlobalCoordinate normal = copyToGlobalCoordinate( grid_->face_normals + normalIdx );
         normal /= normal.two_norm();
         unitOuterNormals_[ face ] = normal;
 
@@ -1612,13 +1872,13 @@ namespace Dune
           const int facePos = 2 * face ;
           // store negative number to indicate boundary
           // the abstract value is the segment index
-          if( grid_.face_cells[ facePos ] < 0 )
+          if( grid_->face_cells[ facePos ] < 0 )
           {
-            grid_.face_cells[ facePos ] = -nBndSegments_;
+            grid_->face_cells[ facePos ] = -nBndSegments_;
           }
-          else if ( grid_.face_cells[ facePos+1 ] < 0 )
+          else if ( grid_->face_cells[ facePos+1 ] < 0 )
           {
-            grid_.face_cells[ facePos+1 ] = -nBndSegments_;
+            grid_->face_cells[ facePos+1 ] = -nBndSegments_;
           }
         }
       }
@@ -1632,9 +1892,9 @@ namespace Dune
         out << "cell " << c << " : faces = " << std::endl;
         for (int hf=grid.cell_facepos[ c ]; hf < grid.cell_facepos[c+1]; ++hf)
         {
-           int f = grid_.cell_faces[ hf ];
-           const int* fnbeg = grid_.face_nodes + grid_.face_nodepos[f];
-           const int* fnend = grid_.face_nodes + grid_.face_nodepos[f+1];
+           int f = grid_->cell_faces[ hf ];
+           const int* fnbeg = grid_->face_nodes + grid_->face_nodepos[f];
+           const int* fnend = grid_->face_nodes + grid_->face_nodepos[f+1];
            out << f << "  vx = " ;
            while( fnbeg != fnend )
            {
@@ -1656,7 +1916,7 @@ namespace Dune
 
   protected:
     UnstructuredGridPtr gridPtr_;
-    const UnstructuredGridType& grid_;
+    const UnstructuredGridType* grid_;
 
     CommunicationType comm_;
     std::array< int, 3 > cartDims_;
@@ -1665,6 +1925,15 @@ namespace Dune
 
     std::vector< GlobalCoordinate > unitOuterNormals_;
 
+    // for a distributed grid the indices of the cells, faces, and nodes
+    // in the whole grid and its size, empty otherwise
+    std::array< std::vector< int >, dim+1 > globalIndices_;
+    std::array< int, dim+1 > globalSizes_{};
+    std::array< std::vector< PartitionType >, dim+1 > partitionTypes_;
+#if HAVE_MPI
+    PolyhedralGridInterfaces cellInterfaces_;
+#endif
+
     mutable LeafIndexSet leafIndexSet_;
     mutable GlobalIdSet globalIdSet_;
     mutable LocalIdSet localIdSet_;
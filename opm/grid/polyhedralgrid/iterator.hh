@@ -34,19 +34,48 @@ namespace Dune
     : Base( data )
     {
       if( beginIterator )
+      {
         entityImpl() = EntityImpl( data, EntitySeed( 0 ) );
+        if( data->size( codim ) > 0 && !contains( data->partitionType( EntitySeed( 0 ) ) ) )
+          increment();
+      }
     }
 
     /** \brief increment */
     void increment ()
     {
+      const ExtraData data = entityImpl().data();
+      const int size = data->size( codim );
       int index = entityImpl().seed().index();
       ++index;
+      while( index < size && !contains( data->partitionType( EntitySeed( index ) ) ) )
+        ++index;
 
-      if( index >= entityImpl().data()->size( codim ) )
-        entityImpl() = EntityImpl( entityImpl().data() );
+      if( index >= size )
+        entityImpl() = EntityImpl( data );
       else
-        entityImpl() = EntityImpl( entityImpl().data(), EntitySeed( index ) );
+        entityImpl() = EntityImpl( data, EntitySeed( index ) );
+    }
+
+  protected:
+    static bool contains ( const PartitionType type )
+    {
+      switch( pitype )
+      {
+      case Interior_Partition:
+        return type == InteriorEntity;
+      case InteriorBorder_Partition:
+        return type == InteriorEntity || type == BorderEntity;
+      case Overlap_Partition:
+        return type != FrontEntity && type != GhostEntity;
+      case OverlapFront_Partition:
+        return type != GhostEntity;
+      case All_Partition:
+        return true;
+      case Ghost_Partition:
+        return type == GhostEntity;
+      }
+      return false;
     }
   };
 
@@ -0,0 +1,158 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <opm/grid/transmissibility/CpGridTransTpfa.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/transmissibility/TransTpfa.hpp>
+
+#include <cassert>
+#include <cmath>
+
+namespace Opm
+{
+
+CpGridTransTpfa::CpGridTransTpfa(const Dune::CpGrid& grid)
+    : grid_(grid)
+{
+    const int num_cells = grid_.numCells();
+    cell_start_.resize(num_cells + 1);
+    cell_start_[0] = 0;
+    for (int c = 0; c < num_cells; ++c) {
+        cell_start_[c + 1] = cell_start_[c] + grid_.numCellFaces(c);
+    }
+
+    face_half_faces_.assign(grid_.numFaces(), {-1, -1});
+    face_cells_.assign(grid_.numFaces(), {-1, -1});
+    // A face is attached to at most one cell with each orientation,
+    // hence the cells write to distinct entries.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int c = 0; c < num_cells; ++c) {
+        int i = cell_start_[c];
+        for (const auto& face : grid_.cellFaceRow(c)) {
+            const int side = face.orientation() ? 0 : 1;
+            face_half_faces_[face.index()][side] = i++;
+            face_cells_[face.index()][side] = c;
+        }
+    }
+}
+
+// htrans = |(x_f - x_c) . K n_f A_f| / |x_f - x_c|^2, with kn(c, n) returning K n.
+template<class Kn>
+void CpGridTransTpfa::computeHalfTransmissibilities(double* htrans, Kn&& kn) const
+{
+    const int num_cells = grid_.numCells();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int c = 0; c < num_cells; ++c) {
+        const auto& cc = grid_.cellCentroid(c);
+        int i = cell_start_[c];
+        for (const auto& face : grid_.cellFaceRow(c)) {
+            const int f = face.index();
+            const auto& fc = grid_.faceCentroid(f);
+            const double area = grid_.faceArea(f);
+            const auto& normal = grid_.faceNormal(f);
+            const std::array<double,3> n = { normal[0] * area, normal[1] * area, normal[2] * area };
+            const std::array<double,3> Kn = kn(c, n);
+            const double d0 = fc[0] - cc[0];
+            const double d1 = fc[1] - cc[1];
+            const double d2 = fc[2] - cc[2];
+            const double denom = d0 * d0 + d1 * d1 + d2 * d2;
+            assert(denom > 0);
+            // The orientation of the normal only changes the sign.
+            htrans[i++] = std::abs(d0 * Kn[0] + d1 * Kn[1] + d2 * Kn[2]) / denom;
+        }
+    }
+}
+
+void CpGridTransTpfa::halfTransmissibilities(const double* perm, double* htrans) const
+{
+    computeHalfTransmissibilities(htrans, [perm](int c, const std::array<double,3>& n)
+    {
+        const double* K = perm + 9 * c;
+        return std::array<double,3>{ K[0] * n[0] + K[3] * n[1] + K[6] * n[2],
+                                     K[1] * n[0] + K[4] * n[1] + K[7] * n[2],
+                                     K[2] * n[0] + K[5] * n[1] + K[8] * n[2] };
+    });
+}
+
+void CpGridTransTpfa::halfTransmissibilitiesDiagonal(const double* permDiag, double* htrans) const
+{
+    computeHalfTransmissibilities(htrans, [permDiag](int c, const std::array<double,3>& n)
+    {
+        const double* K = permDiag + 3 * c;
+        return std::array<double,3>{ K[0] * n[0], K[1] * n[1], K[2] * n[2] };
+    });
+}
+
+template<class Mobility>
+void CpGridTransTpfa::combine(const double* htrans, double* trans, Mobility&& mobility) const
+{
+    const int num_faces = face_half_faces_.size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (int f = 0; f < num_faces; ++f) {
+        // As in tpfa_trans_compute() a face without cells gets an infinite value.
+        double sum = 0.0;
+        for (int side = 0; side < 2; ++side) {
+            const int i = face_half_faces_[f][side];
+            if (i >= 0) {
+                sum += 1.0 / (mobility(face_cells_[f][side]) * htrans[i]);
+            }
+        }
+        trans[f] = 1.0 / sum;
+    }
+}
+
+void CpGridTransTpfa::transmissibilities(const double* htrans, double* trans) const
+{
+    combine(htrans, trans, [](int) { return 1.0; });
+}
+
+void CpGridTransTpfa::effectiveTransmissibilities(const double* totmob, const double* htrans,
+                                                  double* trans) const
+{
+    combine(htrans, trans, [totmob](int c) { return totmob[c]; });
+}
+
+} // namespace Opm
+
+void tpfa_htrans_compute(const Dune::CpGrid* G, const double* perm, double* htrans)
+{
+    Opm::CpGridTransTpfa(*G).halfTransmissibilities(perm, htrans);
+}
+
+void tpfa_trans_compute(const Dune::CpGrid* G, const double* htrans, double* trans)
+{
+    Opm::CpGridTransTpfa(*G).transmissibilities(htrans, trans);
+}
+
+void tpfa_eff_trans_compute(const Dune::CpGrid* G, const double* totmob,
+                            const double* htrans, double* trans)
+{
+    Opm::CpGridTransTpfa(*G).effectiveTransmissibilities(totmob, htrans, trans);
+}
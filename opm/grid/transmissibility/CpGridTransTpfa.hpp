@@ -0,0 +1,107 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CPGRIDTRANSTPFA_HEADER_INCLUDED
+#define OPM_CPGRIDTRANSTPFA_HEADER_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Dune
+{
+class CpGrid;
+}
+
+namespace Opm
+{
+
+/// \brief Two-point transmissibilities of a CpGrid.
+///
+/// Computes the same quantities as tpfa_htrans_compute(), tpfa_trans_compute()
+/// and tpfa_eff_trans_compute(), see TransTpfa.hpp, for the current view of a
+/// CpGrid. The half-faces of a cell c are numbered consecutively in the order of
+/// cellFaceRow(c), starting at halfFaceStart(c). The offsets and, for each face,
+/// its half-faces are set up once, so that recomputing the transmissibilities
+/// for new permeabilities, e.g. when multipliers change, only reads the
+/// geometry. The loops run in parallel with OpenMP, and no memory is allocated
+/// in them.
+class CpGridTransTpfa
+{
+public:
+    /// \param grid The grid, its current view must not change during the
+    ///             lifetime of this object.
+    explicit CpGridTransTpfa(const Dune::CpGrid& grid);
+
+    /// \brief The number of half-faces, i.e. the size of the htrans arrays.
+    std::size_t numHalfFaces() const
+    {
+        return cell_start_.back();
+    }
+
+    /// \brief The index of the first half-face of a cell.
+    int halfFaceStart(int cell) const
+    {
+        return cell_start_[cell];
+    }
+
+    /// \brief Compute the one-sided transmissibilities for full tensors.
+    /// \param[in]  perm   Nine entries per cell, the permeability tensor of cell c
+    ///                    in column major order at perm[9*c].
+    /// \param[out] htrans One value per half-face.
+    void halfTransmissibilities(const double* perm, double* htrans) const;
+
+    /// \brief Compute the one-sided transmissibilities for diagonal tensors.
+    /// \param[in]  permDiag Three entries per cell, the diagonal of the
+    ///                      permeability tensor of cell c at permDiag[3*c].
+    /// \param[out] htrans   One value per half-face.
+    void halfTransmissibilitiesDiagonal(const double* permDiag, double* htrans) const;
+
+    /// \brief Compute the two-point transmissibilities of the faces.
+    /// \param[in]  htrans One-sided transmissibilities.
+    /// \param[out] trans  One value per face.
+    void transmissibilities(const double* htrans, double* trans) const;
+
+    /// \brief Compute the total mobility weighted two-point transmissibilities.
+    /// \param[in]  totmob Total mobility of each cell.
+    /// \param[in]  htrans One-sided transmissibilities.
+    /// \param[out] trans  One value per face.
+    void effectiveTransmissibilities(const double* totmob, const double* htrans,
+                                     double* trans) const;
+
+private:
+    template<class Kn>
+    void computeHalfTransmissibilities(double* htrans, Kn&& kn) const;
+
+    template<class Mobility>
+    void combine(const double* htrans, double* trans, Mobility&& mobility) const;
+
+    const Dune::CpGrid& grid_;
+    /// The first half-face of each cell, and the total number at the end.
+    std::vector<int> cell_start_;
+    /// For each face its half-face with outward normal, and the one with
+    /// inward normal. -1 for a missing cell.
+    std::vector<std::array<int,2>> face_half_faces_;
+    /// The cell of each half-face in face_half_faces_, -1 if missing.
+    std::vector<std::array<int,2>> face_cells_;
+};
+
+} // namespace Opm
+
+#endif // OPM_CPGRIDTRANSTPFA_HEADER_INCLUDED
@@ -101,5 +101,38 @@ tpfa_eff_trans_compute(const Grid   *G      ,
                        const double *htrans,
                        double       *trans );
 
+namespace Dune
+{
+class CpGrid;
+}
+
+/**
+ * Specialisation of tpfa_htrans_compute() for CpGrid.
+ *
+ * Runs in parallel, see Opm::CpGridTransTpfa. Use that class directly to
+ * recompute the transmissibilities repeatedly, or with diagonal tensors.
+ */
+void
+tpfa_htrans_compute(const Dune::CpGrid *G     ,
+                    const double       *perm  ,
+                    double             *htrans);
+
+/**
+ * Specialisation of tpfa_trans_compute() for CpGrid.
+ */
+void
+tpfa_trans_compute(const Dune::CpGrid *G     ,
+                   const double       *htrans,
+                   double             *trans );
+
+/**
+ * Specialisation of tpfa_eff_trans_compute() for CpGrid.
+ */
+void
+tpfa_eff_trans_compute(const Dune::CpGrid *G     ,
+                       const double       *totmob,
+                       const double       *htrans,
+                       double             *trans );
+
 #include "TransTpfa_impl.hpp"
 #endif  /* OPM_TRANS_TPFA_HEADER_INCLUDED */
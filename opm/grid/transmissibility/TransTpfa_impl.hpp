@@ -1,7 +1,7 @@
-#include <opm/common/utility/numeric/blas_lapack.h>
 #include <opm/grid/transmissibility/trans_tpfa.h>
 #include <opm/grid/GridHelpers.hpp>
 
+#include <cassert>
 #include <cmath>
 
 namespace Dune
@@ -21,29 +21,23 @@ double faceArea(const Dune::CpGrid&, int);
 
 namespace
 {
-inline const double* multiplyFaceNormalWithArea(const Dune::CpGrid& grid, int face_index, const double* in)
+inline void multiplyFaceNormalWithArea(const Dune::CpGrid& grid, int face_index,
+                                       const double* in, double* out)
 {
     int d=Opm::UgGridHelpers::dimensions(grid);
-    double* out=new double[d];
     double area=Opm::UgGridHelpers::faceArea(grid, face_index);
-    
+
     for(int i=0;i<d;++i)
         out[i]=in[i]*area;
-    return out;
-}
-
-inline void maybeFreeFaceNormal(const Dune::CpGrid&, const double* array)
-{
-    delete[] array;
 }
 
-inline const double* multiplyFaceNormalWithArea(const UnstructuredGrid&, int, const double* in)
+inline void multiplyFaceNormalWithArea(const UnstructuredGrid& grid, int,
+                                       const double* in, double* out)
 {
-    return in;
+    // The normals of an UnstructuredGrid are already scaled by the area.
+    for(int i=0;i<grid.dimensions;++i)
+        out[i]=in[i];
 }
-
-inline void maybeFreeFaceNormal(const UnstructuredGrid&, const double*)
-{}
 }
 
 /* ---------------------------------------------------------------------- */
@@ -58,7 +52,7 @@ tpfa_htrans_compute(const Grid* G, const double *perm, double *htrans)
     int    d, j;
     double s, dist, denom;
 
-    double Kn[3];
+    double Kn[3], nn[3];
     typename CellCentroidTraits<Grid>::IteratorType cc = beginCellCentroids(*G);
     typename Cell2FacesTraits<Grid>::Type c2f = cell2Faces(*G);
     typename FaceCellTraits<Grid>::Type face_cells = faceCells(*G);
@@ -66,15 +60,8 @@ tpfa_htrans_compute(const Grid* G, const double *perm, double *htrans)
     const double *n;
     const double *K;
 
-    MAT_SIZE_T nrows, ncols, ldA, incx, incy;
-    double a1, a2;
-
     d = dimensions(*G);
 
-    nrows = ncols    = ldA = d;
-    incx  = incy     = 1      ;
-    a1    = 1.0;  a2 = 0.0    ;
-
     for (int c =0, i = 0; c < numCells(*G); c++) {
         K  = perm + (c * d * d);
         
@@ -86,11 +73,15 @@ tpfa_htrans_compute(const Grid* G, const double *perm, double *htrans)
         {
             s = 2.0*(face_cells(*f, 0) == c) - 1.0;
             n = faceNormal(*G, *f);
-            const double* nn=multiplyFaceNormalWithArea(*G, *f, n);
+            multiplyFaceNormalWithArea(*G, *f, n, nn);
             const double* fc = &(faceCentroid(*G, *f)[0]);
-            dgemv_("No Transpose", &nrows, &ncols,
-                   &a1, K, &ldA, nn, &incx, &a2, &Kn[0], &incy);
-            maybeFreeFaceNormal(*G, nn);
+            // Kn <- K * nn, K is stored column major.
+            for (j = 0; j < d; j++) {
+                Kn[j] = 0.0;
+                for (int k = 0; k < d; k++) {
+                    Kn[j] += K[j + k*d] * nn[k];
+                }
+            }
             
             htrans[i] = denom = 0.0;
             for (j = 0; j < d; j++) {
@@ -0,0 +1,357 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_CELLLOCATOR_HEADER
+#define OPM_CELLLOCATOR_HEADER
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <dune/common/fvector.hh>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace Opm
+{
+
+/// Find the cells containing arbitrary points of a three dimensional grid
+/// view, e.g. of a CpGrid or a PolyhedralGrid.
+///
+/// The corners of all cells are copied on construction, and a bounding volume
+/// hierarchy of the cells' bounding boxes is built. A query descends the
+/// hierarchy to the few cells whose boxes contain the point and tests those
+/// exactly: a cell is the region enclosed by its faces, each face split into
+/// triangles around the average of its corners, and the point is inside if it
+/// lies on that surface or the surface winds around it. This is exact for the
+/// non-planar faces and collapsed corners of corner-point cells. Points in the
+/// slivers between the cells on either side of a fault may be found in neither.
+///
+/// Hexahedral cells, with corners in the order of the Dune reference cube, and
+/// tetrahedral cells are supported. The queries are const and thread-safe,
+/// and locate(points) runs in parallel with OpenMP.
+///
+/// Typical use:
+/// const CellLocator locator(grid.leafGridView());
+/// const std::vector<int> cells = locator.locate(trajectory_points);
+template <class GridView>
+class CellLocator
+{
+public:
+    using Point = Dune::FieldVector<double, 3>;
+
+    /// \brief Build the index.
+    /// \param gridView The cells to locate points in. Cells are identified by
+    ///                 the index of the grid view's index set.
+    /// \param leafSize The maximum number of cells in a leaf of the hierarchy.
+    explicit CellLocator(const GridView& gridView, std::size_t leafSize = 4)
+    {
+        const auto num_cells = gridView.size(0);
+        cell_start_.assign(num_cells + 1, 0);
+        std::vector<std::vector<Point>> cell_corners(num_cells);
+        for (const auto& element : elements(gridView)) {
+            const auto& geometry = element.geometry();
+            const int num_corners = geometry.corners();
+            const bool hexahedron = geometry.type().isCube() && num_corners == 8;
+            const bool tetrahedron = geometry.type().isSimplex() && num_corners == 4;
+            if (!hexahedron && !tetrahedron) {
+                OPM_THROW(std::invalid_argument,
+                          "CellLocator only supports hexahedral and tetrahedral cells.");
+            }
+            const auto cell = gridView.indexSet().index(element);
+            auto& corners = cell_corners[cell];
+            for (int i = 0; i < num_corners; ++i) {
+                corners.push_back(geometry.corner(i));
+            }
+            cell_start_[cell + 1] = num_corners;
+        }
+        std::partial_sum(cell_start_.begin(), cell_start_.end(), cell_start_.begin());
+        corners_.reserve(cell_start_.back());
+        for (const auto& corners : cell_corners) {
+            corners_.insert(corners_.end(), corners.begin(), corners.end());
+        }
+
+        // The tolerance for points on the boundary of a cell is relative to
+        // the extent of the grid.
+        std::vector<Box> boxes(num_cells);
+        Box all;
+        for (int cell = 0; cell < num_cells; ++cell) {
+            for (int corner = cell_start_[cell]; corner < cell_start_[cell + 1]; ++corner) {
+                boxes[cell].extend(corners_[corner]);
+            }
+            all.extend(boxes[cell]);
+        }
+        if (num_cells > 0) {
+            double diagonal = 0.0;
+            for (int dir = 0; dir < 3; ++dir) {
+                diagonal += (all.max[dir] - all.min[dir]) * (all.max[dir] - all.min[dir]);
+            }
+            tolerance_ = 1e-12 * std::sqrt(diagonal);
+        }
+        for (auto& box : boxes) {
+            box.enlarge(tolerance_);
+        }
+
+        order_.resize(num_cells);
+        std::iota(order_.begin(), order_.end(), 0);
+        nodes_.reserve(num_cells > 0 ? 2 * (num_cells / std::max(leafSize, std::size_t(1))) + 1 : 0);
+        if (num_cells > 0) {
+            build(boxes, 0, num_cells, std::max(leafSize, std::size_t(1)));
+        }
+    }
+
+    /// \brief The number of cells.
+    std::size_t numCells() const
+    {
+        return cell_start_.size() - 1;
+    }
+
+    /// \brief Find the cell containing a point.
+    /// \return The index of the cell, or -1 if the point is outside all cells.
+    ///         A point on the boundary between cells yields the lowest index.
+    int locate(const Point& point) const
+    {
+        if (nodes_.empty()) {
+            return -1;
+        }
+        int found = -1;
+        // The hierarchy is balanced, its depth is far below the stack size.
+        std::array<int, 64> stack;
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const int index = stack[--top];
+            const Node& node = nodes_[index];
+            if (!node.box.contains(point)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; ++i) {
+                    const int cell = order_[i];
+                    if ((found < 0 || cell < found) && contains(cell, point)) {
+                        found = cell;
+                    }
+                }
+            } else {
+                stack[top++] = node.first;
+                stack[top++] = index + 1;
+            }
+        }
+        return found;
+    }
+
+    /// \brief Find the cells containing several points, in parallel.
+    /// \return For each point the index of its cell, or -1.
+    std::vector<int> locate(const std::vector<Point>& points) const
+    {
+        std::vector<int> cells(points.size());
+        const long num_points = points.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (long i = 0; i < num_points; ++i) {
+            cells[i] = locate(points[i]);
+        }
+        return cells;
+    }
+
+    /// \brief Whether a point lies in a cell or on its boundary.
+    bool contains(int cell, const Point& point) const
+    {
+        const Point* corners = corners_.data() + cell_start_[cell];
+        const int num_corners = cell_start_[cell + 1] - cell_start_[cell];
+        double solid_angle = 0.0;
+        if (num_corners == 8) {
+            // The faces of the reference cube, oriented outwards.
+            static constexpr int faces[6][4] = { {0, 2, 3, 1}, {4, 5, 7, 6},
+                                                 {0, 4, 6, 2}, {1, 3, 7, 5},
+                                                 {0, 1, 5, 4}, {2, 6, 7, 3} };
+            for (const auto& face : faces) {
+                Point center(0.0);
+                for (const int corner : face) {
+                    center += corners[corner];
+                }
+                center /= 4.0;
+                for (int i = 0; i < 4; ++i) {
+                    if (addSolidAngle(point, corners[face[i]], corners[face[(i + 1) % 4]],
+                                      center, solid_angle)) {
+                        return true;
+                    }
+                }
+            }
+        } else {
+            // The faces of the reference simplex, oriented outwards.
+            static constexpr int faces[4][3] = { {0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3} };
+            for (const auto& face : faces) {
+                if (addSolidAngle(point, corners[face[0]], corners[face[1]],
+                                  corners[face[2]], solid_angle)) {
+                    return true;
+                }
+            }
+        }
+        // The winding number, solid_angle / (4 pi), is +-1 inside and 0 outside.
+        const double pi = 3.14159265358979323846;
+        return std::abs(solid_angle) > 2.0 * pi;
+    }
+
+private:
+    struct Box
+    {
+        std::array<double, 3> min = { std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::max() };
+        std::array<double, 3> max = { std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::lowest() };
+
+        void extend(const Point& point)
+        {
+            for (int dir = 0; dir < 3; ++dir) {
+                min[dir] = std::min(min[dir], point[dir]);
+                max[dir] = std::max(max[dir], point[dir]);
+            }
+        }
+
+        void extend(const Box& box)
+        {
+            for (int dir = 0; dir < 3; ++dir) {
+                min[dir] = std::min(min[dir], box.min[dir]);
+                max[dir] = std::max(max[dir], box.max[dir]);
+            }
+        }
+
+        void enlarge(double amount)
+        {
+            for (int dir = 0; dir < 3; ++dir) {
+                min[dir] -= amount;
+                max[dir] += amount;
+            }
+        }
+
+        bool contains(const Point& point) const
+        {
+            return point[0] >= min[0] && point[0] <= max[0]
+                && point[1] >= min[1] && point[1] <= max[1]
+                && point[2] >= min[2] && point[2] <= max[2];
+        }
+
+        double center(int dir) const
+        {
+            return 0.5 * (min[dir] + max[dir]);
+        }
+    };
+
+    /// A leaf holds the cells order_[first, first + count). An inner node has
+    /// count 0, its left child follows it directly and first is the right child.
+    struct Node
+    {
+        Box box;
+        int first = 0;
+        int count = 0;
+    };
+
+    /// Build the subtree of the cells order_[begin, end), return its root.
+    int build(const std::vector<Box>& boxes, int begin, int end, std::size_t leafSize)
+    {
+        const int index = nodes_.size();
+        nodes_.emplace_back();
+        Box box;
+        Box centers;
+        for (int i = begin; i < end; ++i) {
+            const Box& cell_box = boxes[order_[i]];
+            box.extend(cell_box);
+            centers.extend(Point{ cell_box.center(0), cell_box.center(1), cell_box.center(2) });
+        }
+        nodes_[index].box = box;
+        if (std::size_t(end - begin) <= leafSize) {
+            nodes_[index].first = begin;
+            nodes_[index].count = end - begin;
+            return index;
+        }
+        // Split at the median along the longest extent of the box centers.
+        int dir = 0;
+        for (int d = 1; d < 3; ++d) {
+            if (centers.max[d] - centers.min[d] > centers.max[dir] - centers.min[dir]) {
+                dir = d;
+            }
+        }
+        const int middle = begin + (end - begin) / 2;
+        std::nth_element(order_.begin() + begin, order_.begin() + middle, order_.begin() + end,
+                         [&boxes, dir](int a, int b)
+                         { return boxes[a].center(dir) < boxes[b].center(dir); });
+        build(boxes, begin, middle, leafSize);
+        const int right = build(boxes, middle, end, leafSize);
+        nodes_[index].first = right;
+        return index;
+    }
+
+    /// Add the solid angle of the triangle abc seen from point to solid_angle.
+    /// \return Whether the point lies on the triangle.
+    bool addSolidAngle(const Point& point, const Point& a, const Point& b, const Point& c,
+                       double& solid_angle) const
+    {
+        const Point r1 = a - point;
+        const Point r2 = b - point;
+        const Point r3 = c - point;
+        const Point normal = cross(b - a, c - a);
+        const double normal_norm = normal.two_norm();
+        if (normal_norm == 0.0) {
+            // A collapsed triangle encloses nothing.
+            return false;
+        }
+        const double triple = r1 * cross(r2, r3);
+        if (std::abs(triple) <= tolerance_ * normal_norm) {
+            // The point lies in the plane of the triangle, check whether it
+            // is inside it. Otherwise the solid angle is zero.
+            const double norm2 = normal_norm * normal_norm;
+            const double u = normal * cross(r2, r3) / norm2;
+            const double v = normal * cross(r3, r1) / norm2;
+            const double eps = 1e-12;
+            return u >= -eps && v >= -eps && 1.0 - u - v >= -eps;
+        }
+        // Van Oosterom and Strackee, IEEE Trans. Biomed. Eng. 30(2), 1983.
+        const double l1 = r1.two_norm();
+        const double l2 = r2.two_norm();
+        const double l3 = r3.two_norm();
+        const double denominator = l1 * l2 * l3 + (r1 * r2) * l3 + (r1 * r3) * l2 + (r2 * r3) * l1;
+        solid_angle += 2.0 * std::atan2(triple, denominator);
+        return false;
+    }
+
+    static Point cross(const Point& a, const Point& b)
+    {
+        return { a[1] * b[2] - a[2] * b[1],
+                 a[2] * b[0] - a[0] * b[2],
+                 a[0] * b[1] - a[1] * b[0] };
+    }
+
+    std::vector<int> cell_start_;
+    std::vector<Point> corners_;
+    std::vector<int> order_;
+    std::vector<Node> nodes_;
+    double tolerance_ = 0.0;
+};
+
+} // namespace Opm
+
+#endif // OPM_CELLLOCATOR_HEADER
@@ -0,0 +1,119 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <opm/grid/utility/PhaseTimings.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+namespace Opm
+{
+
+PhaseTimings::Scope::Scope(PhaseTimings* timings, const char* name)
+    : timings_(timings), name_(name)
+{
+    if (timings_) {
+        startPeakRss_ = peakResidentSetSize();
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+PhaseTimings::Scope::~Scope()
+{
+    stop();
+}
+
+void PhaseTimings::Scope::stop()
+{
+    if (!timings_) {
+        return;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    timings_->add(name_, elapsed.count(), peakResidentSetSize() - startPeakRss_, items_);
+    timings_ = nullptr;
+}
+
+void PhaseTimings::add(const std::string& name, double seconds, long peakRssIncrease, std::size_t items)
+{
+    auto phase = std::find_if(phases_.begin(), phases_.end(),
+                              [&name](const Phase& p) { return p.name == name; });
+    if (phase == phases_.end()) {
+        phases_.push_back(Phase{name});
+        phase = phases_.end() - 1;
+    }
+    phase->seconds += seconds;
+    phase->peakRssIncrease += peakRssIncrease;
+    phase->items += items;
+    ++phase->calls;
+}
+
+const PhaseTimings::Phase* PhaseTimings::phase(const std::string& name) const
+{
+    auto phase = std::find_if(phases_.begin(), phases_.end(),
+                              [&name](const Phase& p) { return p.name == name; });
+    return phase == phases_.end() ? nullptr : &*phase;
+}
+
+void PhaseTimings::writeJson(std::ostream& os) const
+{
+    const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+    os << "[";
+    for (std::size_t i = 0; i < phases_.size(); ++i) {
+        const auto& phase = phases_[i];
+        // The phase names are identifiers, they need no escaping.
+        os << (i == 0 ? "" : ", ")
+           << "{\"name\": \"" << phase.name << "\""
+           << ", \"seconds\": " << phase.seconds
+           << ", \"peak_rss_increase_kb\": " << phase.peakRssIncrease
+           << ", \"items\": " << phase.items
+           << ", \"calls\": " << phase.calls << "}";
+    }
+    os << "]";
+    os.precision(precision);
+}
+
+long PhaseTimings::peakResidentSetSize()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // macOS reports bytes.
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace Opm
@@ -0,0 +1,120 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_PHASETIMINGS_HEADER
+#define OPM_PHASETIMINGS_HEADER
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Opm
+{
+
+/// Wall time, memory and item counts of the phases of a computation,
+/// e.g. of the setup of a grid.
+///
+/// Phases are measured with a Scope:
+/// {
+///     PhaseTimings::Scope phase(&timings, "buildTopo");
+///     // ...
+///     phase.setItems(num_faces);
+/// }
+/// A phase that runs several times accumulates its measurements. Phases may
+/// be nested, the time of the outer phase then includes the inner ones.
+/// Measuring a phase costs a clock reading and a getrusage() call at
+/// either end.
+class PhaseTimings
+{
+public:
+    struct Phase
+    {
+        std::string name;
+        /// Accumulated wall time in seconds.
+        double seconds = 0.0;
+        /// Accumulated increase of the peak resident set size in kB.
+        long peakRssIncrease = 0;
+        /// Accumulated number of items processed, e.g. cells or faces.
+        std::size_t items = 0;
+        /// Number of times the phase ran.
+        int calls = 0;
+    };
+
+    /// Measures a phase from its construction to its destruction.
+    class Scope
+    {
+    public:
+        /// \param timings where to record the phase. Nothing is measured
+        ///        if it is a nullptr.
+        /// \param name the name of the phase.
+        Scope(PhaseTimings* timings, const char* name);
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope();
+
+        /// Set the number of items processed in the phase.
+        void setItems(std::size_t items)
+        {
+            items_ = items;
+        }
+
+        /// End the phase before the end of the scope.
+        void stop();
+
+    private:
+        PhaseTimings* timings_;
+        const char* name_;
+        std::chrono::steady_clock::time_point start_;
+        long startPeakRss_ = 0;
+        std::size_t items_ = 0;
+    };
+
+    /// Add a measurement of a phase.
+    void add(const std::string& name, double seconds, long peakRssIncrease, std::size_t items);
+
+    /// The phases in the order in which they first ran.
+    const std::vector<Phase>& phases() const
+    {
+        return phases_;
+    }
+
+    /// The phase of the given name, or nullptr if it never ran.
+    const Phase* phase(const std::string& name) const;
+
+    void clear()
+    {
+        phases_.clear();
+    }
+
+    /// Write the phases as a JSON array of objects with the keys "name",
+    /// "seconds", "peak_rss_increase_kb", "items" and "calls".
+    void writeJson(std::ostream& os) const;
+
+    /// The peak resident set size of this process in kB, zero where it is
+    /// not available.
+    static long peakResidentSetSize();
+
+private:
+    std::vector<Phase> phases_;
+};
+
+} // namespace Opm
+
+#endif // OPM_PHASETIMINGS_HEADER
@@ -23,6 +23,7 @@
 #include <opm/common/utility/numeric/blas_lapack.h>
 
 #include <iostream>
+#include <vector>
 
 namespace Opm
 {
@@ -89,7 +90,14 @@ namespace Opm
     /// Constructor.
     /// \param[in]  grid   A grid.
     VelocityInterpolationECVI::VelocityInterpolationECVI(const UnstructuredGrid& grid)
-        : bcmethod_(grid), grid_(grid)
+        : bcmethod_(grid)
+    {
+    }
+
+    /// Constructor.
+    /// \param[in]  grid   A grid, only its current view is used.
+    VelocityInterpolationECVI::VelocityInterpolationECVI(const Dune::CpGrid& grid)
+        : bcmethod_(grid)
     {
     }
 
@@ -100,7 +108,7 @@ namespace Opm
     {
         // We must now update the velocity member of the CornerInfo
         // for each corner.
-        const int dim = grid_.dimensions;
+        const int dim = bcmethod_.dimensions();
         std::vector<double> N(dim*dim); // Normals matrix. Fortran ordering!
         std::vector<double> orig_N; // Normals matrix. Fortran ordering!
         std::vector<double> f(dim);     // Flux vector.
@@ -108,15 +116,16 @@ namespace Opm
         std::vector<MAT_SIZE_T> piv(dim); // For LAPACK solve
         const SparseTable<WachspressCoord::CornerInfo>& all_ci = bcmethod_.cornerInfo();
         const std::vector<int>& adj_faces = bcmethod_.adjacentFaces();
+        const std::vector<double>& face_normals = bcmethod_.faceNormals();
         corner_velocity_.resize(dim*all_ci.dataSize());
-        const int num_cells = grid_.number_of_cells;
+        const int num_cells = all_ci.size();
         for (int cell = 0; cell < num_cells; ++cell) {
             const int num_cell_corners = bcmethod_.numCorners(cell);
             for (int cell_corner = 0; cell_corner < num_cell_corners; ++cell_corner) {
                 const int cid = all_ci[cell][cell_corner].corner_id;
                 for (int adj_ix = 0; adj_ix < dim; ++adj_ix) {
                     const int face = adj_faces[dim*cid + adj_ix];
-                    const double* fn = grid_.face_normals + dim*face;
+                    const double* fn = face_normals.data() + dim*face;
                     for (int dd = 0; dd < dim; ++dd) {
                         N[adj_ix + dd*dim] = fn[dd]; // Row adj_ix, column dd
                     }
@@ -168,20 +177,71 @@ namespace Opm
     void VelocityInterpolationECVI::interpolate(const int cell,
                                                 const double* x,
                                                 double* v) const
+    {
+        thread_local std::vector<double> bary_coord;
+        bary_coord.resize(scratchSize());
+        interpolate(cell, x, v, bary_coord.data());
+    }
+
+    /// Interpolate velocity using caller-supplied scratch space.
+    /// \param[in]  cell    Cell in which to interpolate.
+    /// \param[in]  x       Coordinates of point at which to interpolate.
+    ///                     Must be array of length grid.dimensions.
+    /// \param[out] v       Interpolated velocity.
+    ///                     Must be array of length grid.dimensions.
+    /// \param[out] scratch Work array of length at least scratchSize().
+    void VelocityInterpolationECVI::interpolate(const int cell,
+                                                const double* x,
+                                                double* v,
+                                                double* scratch) const
     {
         const int n = bcmethod_.numCorners(cell);
-        const int dim = grid_.dimensions;
-        bary_coord_.resize(n);
-        bcmethod_.cartToBary(cell, x, &bary_coord_[0]);
+        const int dim = bcmethod_.dimensions();
+        double* bary_coord = scratch;
+        bcmethod_.cartToBary(cell, x, bary_coord);
         std::fill(v, v + dim, 0.0);
         const SparseTable<WachspressCoord::CornerInfo>& all_ci = bcmethod_.cornerInfo();
         for (int i = 0; i < n; ++i) {
             const int cid = all_ci[cell][i].corner_id;
             for (int dd = 0; dd < dim; ++dd) {
-                v[dd] += corner_velocity_[dim*cid + dd] * bary_coord_[i];
+                v[dd] += corner_velocity_[dim*cid + dd] * bary_coord[i];
             }
         }
     }
 
+    /// Interpolate velocity in many points, in parallel with OpenMP.
+    /// \param[in]  num_points  Number of points.
+    /// \param[in]  cells       Cell in which to interpolate, for each point.
+    /// \param[in]  x           Coordinates of the points, grid.dimensions
+    ///                         values per point.
+    /// \param[out] v           Interpolated velocities, grid.dimensions
+    ///                         values per point.
+    void VelocityInterpolationECVI::interpolate(const int num_points,
+                                                const int* cells,
+                                                const double* x,
+                                                double* v) const
+    {
+        const int dim = bcmethod_.dimensions();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // One scratch array per thread, allocated once.
+            std::vector<double> bary_coord(scratchSize());
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for (int p = 0; p < num_points; ++p) {
+                interpolate(cells[p], x + dim*p, v + dim*p, bary_coord.data());
+            }
+        }
+    }
+
+    /// The size of the scratch array needed by interpolate().
+    int VelocityInterpolationECVI::scratchSize() const
+    {
+        return bcmethod_.maxCorners();
+    }
+
 
 } // namespace Opm
@@ -25,6 +25,11 @@
 
 struct UnstructuredGrid;
 
+namespace Dune
+{
+    class CpGrid;
+}
+
 namespace Opm
 {
 
@@ -87,6 +92,9 @@ namespace Opm
     /// compute a corner velocity for each cell corner that
     /// is consistent with fluxes of adjacent faces, then
     /// interpolate with generalized barycentric coordinates.
+    ///
+    /// After setupFluxes() the interpolation methods do not modify
+    /// the object and may be called concurrently from several threads.
     class VelocityInterpolationECVI : public VelocityInterpolationInterface
     {
     public:
@@ -94,6 +102,10 @@ namespace Opm
         /// \param[in]  grid   A grid.
         explicit VelocityInterpolationECVI(const UnstructuredGrid& grid);
 
+        /// Constructor.
+        /// \param[in]  grid   A grid, only its current view is used.
+        explicit VelocityInterpolationECVI(const Dune::CpGrid& grid);
+
         /// Set up fluxes for interpolation.
         /// \param[in]  flux   One signed flux per face in the grid.
         void setupFluxes(const double* flux) override;
@@ -107,10 +119,36 @@ namespace Opm
         void interpolate(const int cell,
                          const double* x,
                          double* v) const override;
+
+        /// Interpolate velocity using caller-supplied scratch space.
+        /// \param[in]  cell    Cell in which to interpolate.
+        /// \param[in]  x       Coordinates of point at which to interpolate.
+        ///                     Must be array of length grid.dimensions.
+        /// \param[out] v       Interpolated velocity.
+        ///                     Must be array of length grid.dimensions.
+        /// \param[out] scratch Work array of length at least scratchSize().
+        void interpolate(const int cell,
+                         const double* x,
+                         double* v,
+                         double* scratch) const;
+
+        /// Interpolate velocity in many points, in parallel with OpenMP.
+        /// \param[in]  num_points  Number of points.
+        /// \param[in]  cells       Cell in which to interpolate, for each point.
+        /// \param[in]  x           Coordinates of the points, grid.dimensions
+        ///                         values per point.
+        /// \param[out] v           Interpolated velocities, grid.dimensions
+        ///                         values per point.
+        void interpolate(const int num_points,
+                         const int* cells,
+                         const double* x,
+                         double* v) const;
+
+        /// The size of the scratch array needed by interpolate().
+        int scratchSize() const;
+
     private:
         WachspressCoord bcmethod_;
-        const UnstructuredGrid& grid_;
-        mutable std::vector<double> bary_coord_;
         std::vector<double> corner_velocity_; // size = dim * #corners
     };
 
@@ -19,7 +19,11 @@
 
 #include "config.h"
 #include <opm/grid/utility/WachspressCoord.hpp>
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/GridHelpers.hpp>
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/cpgrid/GridHelpers.hpp>
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <set>
@@ -55,13 +59,25 @@ namespace Opm
 
         /// Calculates the volume of the parallelepiped given by
         /// the vectors n[i] for i = 0..(dim-1), each n[i] is of size dim.
-        double cornerVolume(double** n, const int dim)
+        double cornerVolume(const double* const* n, const int dim)
         {
             assert(dim == 2 || dim == 3);
             double det = (dim == 2) ? determinantOf(n[0], n[1]) : determinantOf(n[0], n[1], n[2]);
             return std::fabs(det);
         }
 
+        /// The factor turning the normals provided by the grid into
+        /// area-scaled normals.
+        double normalScaling(const UnstructuredGrid& /* grid */, const int /* face */)
+        {
+            return 1.0;
+        }
+
+        double normalScaling(const Dune::CpGrid& grid, const int face)
+        {
+            return grid.faceArea(face);
+        }
+
     } // anonymous namespace
 
 
@@ -90,46 +106,89 @@ namespace Opm
     // the normals have length 1 (are unit normals). It is easy to see that this
     // can be relaxed, since each normal occurs once in the formula for w_i, and
     // all w_i will be scaled by the same number. In our implementation we therefore
-    // use the area-scaled normals directly as provided by the UnstructuredGrid.
+    // use the area-scaled normals directly as provided by the UnstructuredGrid,
+    // and scale the unit normals of the CpGrid by the face areas to match.
 
     /// Constructor.
     /// \param[in]  grid   A grid.
     WachspressCoord::WachspressCoord(const UnstructuredGrid& grid)
-        : grid_(grid)
+    {
+        init(grid);
+    }
+
+    /// Constructor.
+    /// \param[in]  grid   A grid, only its current view is used.
+    WachspressCoord::WachspressCoord(const Dune::CpGrid& grid)
+    {
+        init(grid);
+    }
+
+    template <class Grid>
+    void WachspressCoord::init(const Grid& grid)
     {
         enum { Maxdim = 3 };
-        const int dim = grid.dimensions;
+        const int dim = UgGridHelpers::dimensions(grid);
         if (dim > Maxdim) {
             OPM_THROW(std::runtime_error,
                       "Grid has more than " +
                       std::to_string(Maxdim) + " dimensions.");
         }
+        dim_ = dim;
+        max_corners_ = 0;
+        // Area-scaled face normals.
+        const int num_faces = UgGridHelpers::numFaces(grid);
+        face_normals_.resize(dim*num_faces);
+        for (int face = 0; face < num_faces; ++face) {
+            const double* fn = UgGridHelpers::faceNormal(grid, face);
+            const double scaling = normalScaling(grid, face);
+            for (int dd = 0; dd < dim; ++dd) {
+                face_normals_[dim*face + dd] = scaling*fn[dd];
+            }
+        }
         // Compute static data for each corner.
-        const int num_cells = grid.number_of_cells;
+        const auto c2f = UgGridHelpers::cell2Faces(grid);
+        const auto f2v = UgGridHelpers::face2Vertices(grid);
+        const auto face_cells = UgGridHelpers::faceCells(grid);
+        const int num_cells = UgGridHelpers::numCells(grid);
+        plane_normals_.reserve(dim*UgGridHelpers::numCellFaces(grid));
+        plane_offsets_.reserve(UgGridHelpers::numCellFaces(grid));
         int corner_id_count = 0;
         for (int cell = 0; cell < num_cells; ++cell) {
             std::set<int> cell_vertices;
             std::vector<int> cell_faces;
             std::multimap<int, int> vertex_adj_faces;
-            for (unsigned hface = grid.cell_facepos[cell]; hface < grid.cell_facepos[cell + 1]; ++hface) {
-                const int face = grid.cell_faces[hface];
+            const int first_hface = plane_offsets_.size();
+            for (const int face : c2f[cell]) {
                 cell_faces.push_back(face);
-                const int fn0 = grid.face_nodepos[face];
-                const int fn1 = grid.face_nodepos[face + 1];
-                cell_vertices.insert(grid.face_nodes + fn0, grid.face_nodes + fn1);
-                for (int fn = fn0; fn < fn1; ++fn) {
-                    const int vertex = grid.face_nodes[fn];
+                // Store the face as a plane with outward normal, so that
+                // cartToBary() need not look at the orientation.
+                double sign = 1.0;
+                if (face_cells(face, 0) != cell) {
+                    assert(face_cells(face, 1) == cell);
+                    sign = -1.0;
+                }
+                const auto& fc = UgGridHelpers::faceCentroid(grid, face);
+                double offset = 0.0;
+                for (int dd = 0; dd < dim; ++dd) {
+                    const double n = sign*face_normals_[dim*face + dd];
+                    plane_normals_.push_back(n);
+                    offset += n*fc[dd];
+                }
+                plane_offsets_.push_back(offset);
+                for (const int vertex : f2v[face]) {
+                    cell_vertices.insert(vertex);
                     vertex_adj_faces.insert(std::make_pair(vertex, face));
                 }
             }
-            std::sort(cell_faces.begin(), cell_faces.end()); // set_difference requires sorted ranges
+            std::vector<int> sorted_faces = cell_faces;
+            std::sort(sorted_faces.begin(), sorted_faces.end()); // set_difference requires sorted ranges
             std::vector<CornerInfo> cell_corner_info;
             std::set<int>::const_iterator it = cell_vertices.begin();
             for (; it != cell_vertices.end(); ++it) {
                 CornerInfo ci;
                 ci.corner_id = corner_id_count++;;
                 ci.vertex = *it;
-                double* fnorm[Maxdim] = { 0 };
+                const double* fnorm[Maxdim] = { 0 };
                 typedef std::multimap<int, int>::const_iterator MMIt;
                 std::pair<MMIt, MMIt> frange = vertex_adj_faces.equal_range(ci.vertex);
                 int fi = 0;
@@ -142,7 +201,7 @@ namespace Opm
                                   " has more than " + std::to_string(dim) +
                                   " adjacent faces.");
                     }
-                    fnorm[fi] = grid_.face_normals + dim*(face_it->second);
+                    fnorm[fi] = face_normals_.data() + dim*(face_it->second);
                     vert_adj_faces[fi] = face_it->second;
                 }
                 assert(fi == dim);
@@ -151,12 +210,18 @@ namespace Opm
                 ci.volume = corner_vol;
                 cell_corner_info.push_back(ci);
                 std::sort(vert_adj_faces.begin(), vert_adj_faces.end());
-                std::vector<int> vert_nonadj_faces(cell_faces.size() - vert_adj_faces.size());
-                std::set_difference(cell_faces.begin(), cell_faces.end(),
+                std::vector<int> vert_nonadj_faces(sorted_faces.size() - vert_adj_faces.size());
+                std::set_difference(sorted_faces.begin(), sorted_faces.end(),
                                     vert_adj_faces.begin(), vert_adj_faces.end(),
                                     vert_nonadj_faces.begin());
+                // Refer to the half-faces of this cell rather than the faces.
+                for (int& face : vert_nonadj_faces) {
+                    const auto pos = std::find(cell_faces.begin(), cell_faces.end(), face);
+                    face = first_hface + (pos - cell_faces.begin());
+                }
                 nonadj_faces_.appendRow(vert_nonadj_faces.begin(), vert_nonadj_faces.end());
             }
+            max_corners_ = std::max(max_corners_, int(cell_corner_info.size()));
             corner_info_.appendRow(cell_corner_info.begin(), cell_corner_info.end());
         }
         assert(corner_id_count == corner_info_.dataSize());
@@ -164,6 +229,13 @@ namespace Opm
 
 
 
+    /// The dimension of the grid.
+    int WachspressCoord::dimensions() const
+    {
+        return dim_;
+    }
+
+
 
     /// Count of vertices adjacent to a call.
     /// \param[in]  cell   A cell index.
@@ -174,6 +246,14 @@ namespace Opm
     }
 
 
+    /// The largest number of corners of any cell.
+    /// \return            Size needed for the xb argument of cartToBary().
+    int WachspressCoord::maxCorners() const
+    {
+        return max_corners_;
+    }
+
+
     /// The class stores some info for each corner.
     /// \return            The corner info container.
     const SparseTable<WachspressCoord::CornerInfo>& WachspressCoord::cornerInfo() const
@@ -192,6 +272,15 @@ namespace Opm
 
 
 
+    /// The class stores the area-scaled normal of each face.
+    /// \return            The vector of face normals.
+    const std::vector<double>& WachspressCoord::faceNormals() const
+    {
+        return face_normals_;
+    }
+
+
+
     /// Compute generalized barycentric coordinates for some point x
     /// with respect to the vertices of a grid cell.
     /// \param[in]  cell   Cell in which to compute coordinates.
@@ -208,7 +297,7 @@ namespace Opm
         // once, instead of repeating computation for all corners (for
         // which j is a nonadjacent face).
         const int n = numCorners(cell);
-        const int dim = grid_.dimensions;
+        const int dim = dim_;
         double totw = 0.0;
         for (int i = 0; i < n; ++i) {
             const CornerInfo& ci = corner_info_[cell][i];
@@ -216,18 +305,13 @@ namespace Opm
             // V_i * (prod_{j \in nonadjacent faces} n_j * (c_j - x) )
             // ^^^                                   ^^^    ^^^
             // corner "volume"                    normal    centroid
+            // The normals point outward, and n_j * c_j is precomputed.
             xb[i] = ci.volume;
-            const int num_nonadj_faces = nonadj_faces_[ci.corner_id].size();
-            for (int j = 0; j < num_nonadj_faces; ++j) {
-                const int face = nonadj_faces_[ci.corner_id][j];
-                double factor = 0.0;
+            for (const int hface : nonadj_faces_[ci.corner_id]) {
+                const double* n = plane_normals_.data() + dim*hface;
+                double factor = plane_offsets_[hface];
                 for (int dd = 0; dd < dim; ++dd) {
-                    factor += grid_.face_normals[dim*face + dd]*(grid_.face_centroids[dim*face + dd] - x[dd]);
-                }
-                // Assumes outward-pointing normals, so negate factor if necessary.
-                if (grid_.face_cells[2*face] != cell) {
-                    assert(grid_.face_cells[2*face + 1] == cell);
-                    factor = -factor;
+                    factor -= n[dd]*x[dd];
                 }
                 xb[i] *= factor;
             }
@@ -25,6 +25,11 @@
 
 struct UnstructuredGrid;
 
+namespace Dune
+{
+    class CpGrid;
+}
+
 namespace Opm
 {
 
@@ -33,6 +38,10 @@ namespace Opm
     /// M. Meyer, A. Barr, H. Lee, and M. Desbrun.
     /// Generalized barycentric coordinates on irregular poly-
     /// gons. Journal of Graphics Tools, 7(1):13–22, 2002.
+    ///
+    /// All geometry needed is copied from the grid by the constructor,
+    /// so the object does not refer to the grid afterwards, and
+    /// cartToBary() may be called concurrently from several threads.
     class WachspressCoord
     {
     public:
@@ -40,11 +49,22 @@ namespace Opm
         /// \param[in]  grid   A grid.
         explicit WachspressCoord(const UnstructuredGrid& grid);
 
+        /// Constructor.
+        /// \param[in]  grid   A grid, only its current view is used.
+        explicit WachspressCoord(const Dune::CpGrid& grid);
+
+        /// The dimension of the grid.
+        int dimensions() const;
+
         /// Count of vertices adjacent to a call.
         /// \param[in]  cell   A cell index.
         /// \return            Number of corners of cell.
         int numCorners(const int cell) const;
 
+        /// The largest number of corners of any cell, i.e. the
+        /// size needed for the xb argument of cartToBary().
+        int maxCorners() const;
+
         /// Compute generalized barycentric coordinates for some point x
         /// with respect to the vertices of a grid cell.
         /// \param[in]  cell   Cell in which to compute coordinates.
@@ -73,11 +93,22 @@ namespace Opm
         /// \return            The vector of adjacent faces. Size = dim * #corners.
         const std::vector<int>& adjacentFaces() const;
 
+        /// The class stores the area-scaled normal of each face, made accessible for user convenience.
+        /// \return            The vector of face normals. Size = dim * #faces.
+        const std::vector<double>& faceNormals() const;
+
     private:
-        const UnstructuredGrid& grid_;
+        template <class Grid>
+        void init(const Grid& grid);
+
+        int dim_;
+        int max_corners_;
         SparseTable<CornerInfo> corner_info_;   // Corner info by cell.
         std::vector<int> adj_faces_;    // Set of adjacent faces, by corner id. Contains dim face indices per corner.
-        SparseTable<int> nonadj_faces_; // Set of nonadjacent faces, by corner id.
+        SparseTable<int> nonadj_faces_; // Set of nonadjacent half-faces, by corner id. Index into the plane arrays.
+        std::vector<double> face_normals_;  // Area-scaled normal by face. Contains dim values per face.
+        std::vector<double> plane_normals_; // Outward area-scaled normal by half-face. Contains dim values per half-face.
+        std::vector<double> plane_offsets_; // Outward normal times face centroid by half-face.
     };
 
 } // namespace Opm
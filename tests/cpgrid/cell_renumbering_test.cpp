@@ -0,0 +1,151 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE CellRenumberingTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+namespace
+{
+
+bool isPermutation(const std::vector<int>& perm)
+{
+    std::vector<int> sorted(perm);
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<int> identity(perm.size());
+    std::iota(identity.begin(), identity.end(), 0);
+    return sorted == identity;
+}
+
+void checkRenumbering(Dune::CellOrdering ordering)
+{
+    Dune::CpGrid original;
+    original.createCartesian({6, 5, 4}, {1.0, 2.0, 0.5});
+    Dune::CpGrid grid;
+    grid.createCartesian({6, 5, 4}, {1.0, 2.0, 0.5});
+    BOOST_CHECK(grid.cellRenumbering().empty());
+
+    grid.renumberCells(ordering);
+
+    const auto& cells = grid.cellRenumbering();
+    const auto& faces = grid.faceRenumbering();
+    BOOST_REQUIRE_EQUAL(static_cast<int>(cells.size()), original.numCells());
+    BOOST_REQUIRE_EQUAL(static_cast<int>(faces.size()), original.numFaces());
+    BOOST_CHECK(isPermutation(cells));
+    BOOST_CHECK(isPermutation(faces));
+    BOOST_CHECK(!std::is_sorted(cells.begin(), cells.end()));
+
+    std::vector<int> newCell(cells.size());
+    for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+        newCell[cells[cell]] = cell;
+    }
+
+    for (int cell = 0; cell < grid.numCells(); ++cell) {
+        const int old = cells[cell];
+        BOOST_CHECK_EQUAL(grid.globalCell()[cell], original.globalCell()[old]);
+        BOOST_CHECK_CLOSE(grid.cellVolume(cell), original.cellVolume(old), 1e-10);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(grid.cellCentroid(cell)[d], original.cellCentroid(old)[d], 1e-10);
+        }
+        BOOST_REQUIRE_EQUAL(grid.numCellFaces(cell), original.numCellFaces(old));
+        for (int local = 0; local < grid.numCellFaces(cell); ++local) {
+            BOOST_CHECK_EQUAL(faces[grid.cellFace(cell, local)], original.cellFace(old, local));
+        }
+    }
+    for (int face = 0; face < grid.numFaces(); ++face) {
+        const int old = faces[face];
+        for (int local = 0; local < 2; ++local) {
+            const int oldCell = original.faceCell(old, local);
+            BOOST_CHECK_EQUAL(grid.faceCell(face, local), oldCell < 0 ? -1 : newCell[oldCell]);
+        }
+        BOOST_CHECK_CLOSE(grid.faceArea(face), original.faceArea(old), 1e-10);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(grid.faceNormal(face)[d] + 2.0, original.faceNormal(old)[d] + 2.0, 1e-10);
+        }
+    }
+    // The faces follow the cells.
+    for (int face = 1; face < grid.numFaces(); ++face) {
+        const auto firstCell = [&grid](int f) {
+            const int c0 = grid.faceCell(f, 0);
+            const int c1 = grid.faceCell(f, 1);
+            return c0 < 0 ? c1 : (c1 < 0 ? c0 : std::min(c0, c1));
+        };
+        BOOST_CHECK(firstCell(face - 1) <= firstCell(face));
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(hilbertOrdering)
+{
+    checkRenumbering(Dune::CellOrdering::hilbert);
+}
+
+BOOST_AUTO_TEST_CASE(reverseCuthillMcKeeOrdering)
+{
+    checkRenumbering(Dune::CellOrdering::reverseCuthillMcKee);
+}
+
+BOOST_AUTO_TEST_CASE(compactCellGeometry)
+{
+    Dune::CpGrid expected;
+    expected.createCartesian({6, 5, 4}, {1.0, 2.0, 0.5});
+    expected.renumberCells(Dune::CellOrdering::hilbert);
+    Dune::CpGrid grid;
+    grid.createCartesian({6, 5, 4}, {1.0, 2.0, 0.5});
+    grid.setCompactCellGeometry(true);
+
+    // Renumbering keeps the cell geometry compact.
+    grid.renumberCells(Dune::CellOrdering::hilbert);
+    BOOST_CHECK(grid.compactCellGeometry());
+    BOOST_REQUIRE(grid.cellRenumbering() == expected.cellRenumbering());
+
+    const auto& gridView = grid.leafGridView();
+    const auto& expectedView = expected.leafGridView();
+    auto expectedElement = expectedView.begin<0>();
+    for (const auto& element : elements(gridView)) {
+        const int cell = gridView.indexSet().index(element);
+        BOOST_CHECK_EQUAL(grid.cellVolume(cell), expected.cellVolume(cell));
+        BOOST_CHECK_EQUAL(grid.cellCentroid(cell), expected.cellCentroid(cell));
+        const auto geometry = element.geometry();
+        const auto expectedGeometry = expectedElement->geometry();
+        for (int corner = 0; corner < 8; ++corner) {
+            BOOST_CHECK_EQUAL(geometry.corner(corner), expectedGeometry.corner(corner));
+        }
+        ++expectedElement;
+    }
+}
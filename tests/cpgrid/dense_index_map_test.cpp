@@ -0,0 +1,98 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define NVERBOSE // to suppress our messages when throwing
+
+#define BOOST_TEST_MODULE DenseIndexMapTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/cpgrid/DenseIndexMap.hpp>
+
+#include <array>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+using namespace Dune;
+
+BOOST_AUTO_TEST_CASE(dense_index_map)
+{
+    cpgrid::DenseIndexMap<std::array<int,2>> m;
+    BOOST_CHECK(m.find(0) == m.end());
+    BOOST_CHECK_THROW(m.at(0), std::out_of_range);
+
+    m[3] = {-1, 7};
+    BOOST_CHECK_EQUAL(m.count(3), 1);
+    BOOST_CHECK_EQUAL(m.count(2), 0); // storage below 3 is allocated, but not in the map
+    BOOST_CHECK_EQUAL(m.count(-1), 0);
+    BOOST_CHECK_EQUAL(m.count(4), 0);
+    BOOST_CHECK(m.at(3) == (std::array<int,2>{-1, 7}));
+
+    m.insert_or_assign(3, {2, 5});
+    const auto* entry = m.find(3);
+    BOOST_REQUIRE(entry != m.end());
+    BOOST_CHECK_EQUAL(entry->first, 3);
+    BOOST_CHECK(entry->second == (std::array<int,2>{2, 5}));
+}
+
+BOOST_AUTO_TEST_CASE(index_pair_map)
+{
+    cpgrid::IndexPairMap<int> m;
+    BOOST_CHECK(m.find({-1, 0}) == m.end());
+    BOOST_CHECK_THROW(m.at({4, 1}), std::out_of_range);
+
+    m[{-1, 2}] = 10;
+    m[{5, 0}] = 11;
+    m.insert_or_assign({5, 3}, 12);
+    BOOST_CHECK_EQUAL(m.at({-1, 2}), 10);
+    BOOST_CHECK_EQUAL(m.at({5, 0}), 11);
+    BOOST_CHECK_EQUAL(m.at({5, 3}), 12);
+    BOOST_CHECK_EQUAL(m.count({5, 1}), 0);
+    BOOST_CHECK_EQUAL(m.count({2, 0}), 0);
+    BOOST_CHECK_EQUAL(m.count({6, 0}), 0);
+    BOOST_CHECK_EQUAL(m.count({-2, 0}), 0);
+    BOOST_CHECK_EQUAL(m.find({5, 3})->second, 12);
+}
+
+// Same results as std::map for random insertions and lookups.
+BOOST_AUTO_TEST_CASE(index_pair_map_matches_std_map)
+{
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> first(-1, 20);
+    std::uniform_int_distribution<int> second(0, 50);
+
+    cpgrid::IndexPairMap<std::array<int,2>> m;
+    std::map<std::array<int,2>, std::array<int,2>> ref;
+    for (int i = 0; i < 1000; ++i) {
+        const std::array<int,2> key = {first(gen), second(gen)};
+        const std::array<int,2> value = {i, -i};
+        m[key] = value;
+        ref[key] = value;
+    }
+    for (int f = -1; f <= 21; ++f) {
+        for (int s = 0; s <= 51; ++s) {
+            const auto it = ref.find({f, s});
+            BOOST_REQUIRE_EQUAL(m.count({f, s}), ref.count({f, s}));
+            if (it != ref.end()) {
+                BOOST_CHECK(m.at({f, s}) == it->second);
+            }
+        }
+    }
+}
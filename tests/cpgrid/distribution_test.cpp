@@ -7,6 +7,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/PartitionCache.hpp>
 
 
 // Warning suppression for Dune includes.
@@ -27,6 +28,10 @@
 #include <opm/grid/utility/platform_dependent/reenable_warnings.h>
 #include <dune/grid/common/mcmgmapper.hh>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <numeric>
 
 #if defined(HAVE_ZOLTAN) && defined(HAVE_METIS)
@@ -428,6 +433,248 @@ BOOST_AUTO_TEST_CASE(testDistributedComm)
 }
 #endif
 
+/// \brief Sends a varying number of copies of the global id of each cell.
+class CopyCellIds
+{
+public:
+    explicit CopyCellIds(std::vector<std::vector<int>>& cont)
+        : cont_(cont)
+    {}
+
+    typedef int DataType;
+    bool fixedSize(int /*dim*/, int /*codim*/)
+    {
+        return false;
+    }
+
+    template<class T>
+    std::size_t size(const T& t)
+    {
+        return cont_[t.index()].size();
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        for (int value : cont_[t.index()])
+            buffer.write(value);
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t s)
+    {
+        cont_[t.index()].resize(s);
+        for(std::size_t i=0; i<s; ++i)
+        {
+            buffer.read(cont_[t.index()][i]);
+        }
+    }
+    bool contains(int dim, int codim)
+    {
+        return dim==3 && codim==0;
+    }
+private:
+    std::vector<std::vector<int>>& cont_;
+};
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(testSplitPhaseComm)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    const auto& gridView = grid.leafGridView();
+    std::vector<int> cont(grid.size(0), 1);
+    std::vector<std::vector<int>> ids(grid.size(0));
+    for (const auto& element : elements(gridView)) {
+        const int id = grid.globalIdSet().id(element);
+        if (element.partitionType() == Dune::InteriorEntity)
+            ids[element.index()].assign(id % 3 + 1, id);
+        else
+            cont[element.index()] = -1;
+    }
+
+    // Repeat to reuse the buffers, and keep two communications pending at the same time.
+    for (int round = 0; round < 2; ++round) {
+        CopyCellValues handle(cont);
+        CopyCellIds idHandle(ids);
+        auto request = grid.startCommunicate(handle, Dune::InteriorBorder_All_Interface,
+                                             Dune::ForwardCommunication);
+        auto idRequest = grid.startCommunicate(idHandle, Dune::InteriorBorder_All_Interface,
+                                               Dune::ForwardCommunication);
+        BOOST_CHECK(request.pending());
+        idRequest.finish();
+        request.finish();
+        BOOST_CHECK(!request.pending());
+        request.finish();
+
+        for (const auto& element : elements(gridView)) {
+            const int id = grid.globalIdSet().id(element);
+            BOOST_REQUIRE(cont[element.index()] == 1);
+            BOOST_REQUIRE(ids[element.index()] == std::vector<int>(id % 3 + 1, id));
+        }
+    }
+}
+#endif
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(testCellCommunicationPlan)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    const auto& gridView = grid.leafGridView();
+    auto& plan = grid.cellCommunicationPlan(Dune::InteriorBorder_All_Interface);
+    BOOST_CHECK_EQUAL(&plan, &grid.cellCommunicationPlan(Dune::InteriorBorder_All_Interface));
+
+    // Exchange twice with different block sizes, reusing the plan and its buffers.
+    for (std::size_t blockSize = 1; blockSize <= 3; blockSize += 2) {
+        std::vector<double> values(grid.size(0) * blockSize, -1.0);
+        for (const auto& element : elements(gridView, Dune::Partitions::interior)) {
+            const int id = grid.globalIdSet().id(element);
+            for (std::size_t k = 0; k < blockSize; ++k)
+                values[element.index() * blockSize + k] = id + 0.1 * k;
+        }
+        plan.exchange(values, blockSize);
+
+        for (const auto& element : elements(gridView)) {
+            const int id = grid.globalIdSet().id(element);
+            for (std::size_t k = 0; k < blockSize; ++k)
+                BOOST_REQUIRE_EQUAL(values[element.index() * blockSize + k], id + 0.1 * k);
+        }
+    }
+
+    std::vector<double> wrongSize(grid.size(0) + 1);
+    BOOST_CHECK_THROW(plan.exchange(wrongSize, 1), std::invalid_argument);
+}
+#endif
+
+/// \brief Sends the centroids of the faces.
+class FaceCentroidHandle
+{
+public:
+    FaceCentroidHandle(const Dune::CpGrid& grid, std::vector<std::vector<double>>& received)
+        : grid_(grid), received_(received)
+    {}
+
+    typedef double DataType;
+    bool fixedSize(int /*dim*/, int /*codim*/)
+    {
+        return true;
+    }
+
+    template<class T>
+    std::size_t size(const T&)
+    {
+        return 3;
+    }
+    template<class B, class T>
+    void gather(B& buffer, const T& t)
+    {
+        for (const double coord : grid_.faceCentroid(t.index()))
+            buffer.write(coord);
+    }
+    template<class B, class T>
+    void scatter(B& buffer, const T& t, std::size_t s)
+    {
+        auto& values = received_[t.index()];
+        values.resize(s);
+        for(std::size_t i=0; i<s; ++i)
+            buffer.read(values[i]);
+    }
+    bool contains(int dim, int codim)
+    {
+        return dim==3 && codim==1;
+    }
+private:
+    const Dune::CpGrid& grid_;
+    std::vector<std::vector<double>>& received_;
+};
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(testFaceComm)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    std::vector<std::vector<double>> received(grid.numFaces());
+    FaceCentroidHandle handle(grid, received);
+    grid.communicate(handle, Dune::All_All_Interface, Dune::ForwardCommunication);
+
+    // Only faces shared with other processes receive data, and it has to match.
+    int numReceived = 0;
+    for (int face = 0; face < grid.numFaces(); ++face) {
+        if (received[face].empty())
+            continue;
+        ++numReceived;
+        const auto& centroid = grid.faceCentroid(face);
+        for (int d = 0; d < 3; ++d)
+            BOOST_CHECK_CLOSE(received[face][d], centroid[d], 1e-8);
+    }
+    if (grid.comm().size() > 1) {
+        BOOST_CHECK(numReceived > 0);
+    }
+
+    // The split-phase communication handles faces, too.
+    std::vector<std::vector<double>> receivedLater(grid.numFaces());
+    FaceCentroidHandle laterHandle(grid, receivedLater);
+    auto request = grid.startCommunicate(laterHandle, Dune::All_All_Interface,
+                                         Dune::ForwardCommunication);
+    request.finish();
+    BOOST_CHECK(receivedLater == received);
+}
+#endif
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(testRenumberDistributedGrid)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance(Dune::EdgeWeightMethod::uniformEdgeWgt, nullptr, {}, nullptr,
+                     /*ownersFirst*/ true);
+
+    const auto& gridView = grid.leafGridView();
+    std::vector<int> ids(grid.size(0));
+    std::vector<Dune::PartitionType> types(grid.size(0));
+    for (const auto& element : elements(gridView)) {
+        ids[element.index()] = grid.globalIdSet().id(element);
+        types[element.index()] = element.partitionType();
+    }
+
+    grid.renumberCells(Dune::CellOrdering::reverseCuthillMcKee);
+    const auto& cells = grid.cellRenumbering();
+    BOOST_REQUIRE_EQUAL(cells.size(), ids.size());
+
+    // Ids and partition types move with the cells, and the owners stay first.
+    bool overlapSeen = false;
+    for (const auto& element : elements(gridView)) {
+        const int old = cells[element.index()];
+        BOOST_CHECK_EQUAL(grid.globalIdSet().id(element), ids[old]);
+        BOOST_CHECK(element.partitionType() == types[old]);
+        overlapSeen = overlapSeen || element.partitionType() != Dune::InteriorEntity;
+        BOOST_CHECK(!overlapSeen || element.partitionType() != Dune::InteriorEntity);
+    }
+
+    // The communication interfaces follow the new numbering.
+    std::vector<int> cont(grid.size(0), 1);
+    for (const auto& element : elements(gridView))
+        if (element.partitionType() != Dune::InteriorEntity)
+            cont[element.index()] = -1;
+    CopyCellValues handle(cont);
+    grid.communicate(handle, Dune::InteriorBorder_All_Interface, Dune::ForwardCommunication);
+    BOOST_CHECK(std::all_of(cont.begin(), cont.end(), [](int value) { return value == 1; }));
+}
+#endif
+
 #if HAVE_MPI
 BOOST_AUTO_TEST_CASE(compareWithSequential)
 {
@@ -751,6 +998,274 @@ BOOST_AUTO_TEST_CASE(distributeParts)
     }
 }
 
+// A second loadBalance with the same input reads the partitioning from the cache.
+BOOST_AUTO_TEST_CASE(partitionCache)
+{
+for (auto partition_method : partition_methods) {
+    const std::string cacheFile = "partition_cache_test.bin";
+    std::array<int, 3> dims={{8, 8, 4}};
+    std::array<double, 3> size={{ 1.0, 1.0, 1.0}};
+
+    auto ownedGlobalIds = [&](Dune::CpGrid& grid)
+    {
+        grid.createCartesian(dims, size);
+        grid.setPartitionCacheFile(cacheFile);
+        grid.loadBalance(1, partition_method);
+        std::vector<int> ids;
+        const auto& gidSet = grid.globalIdSet();
+        for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior))
+        {
+            ids.push_back(gidSet.id(element));
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+
+    Dune::CpGrid grid;
+    if (grid.comm().rank() == 0)
+    {
+        std::remove(cacheFile.c_str());
+    }
+    grid.comm().barrier();
+
+    const auto computed = ownedGlobalIds(grid);
+    if (grid.comm().size() > 1 && grid.comm().rank() == 0)
+    {
+        BOOST_CHECK(std::ifstream(cacheFile).good());
+    }
+
+    Dune::CpGrid cachedGrid;
+    BOOST_CHECK_EQUAL(cachedGrid.partitionCacheFile(), "");
+    const auto cached = ownedGlobalIds(cachedGrid);
+    BOOST_CHECK_EQUAL(cachedGrid.partitionCacheFile(), cacheFile);
+    BOOST_CHECK_EQUAL_COLLECTIONS(computed.begin(), computed.end(), cached.begin(), cached.end());
+
+    if (grid.comm().size() > 1)
+    {
+        // Replace the cached partitioning by a different valid one, with the
+        // same key. The cache starts with an 8 byte magic followed by the key.
+        const int noProcs = grid.comm().size();
+        std::vector<int> shifted(dims[0]*dims[1]*dims[2]);
+        if (grid.comm().rank() == 0)
+        {
+            std::uint64_t key = 0;
+            std::ifstream in(cacheFile, std::ios::binary);
+            in.seekg(8);
+            in.read(reinterpret_cast<char*>(&key), sizeof(key));
+            std::vector<int> parts, wellProcs;
+            BOOST_CHECK(Dune::cpgrid::readPartitionCache(cacheFile, key, parts, wellProcs));
+            BOOST_CHECK_EQUAL(parts.size(), shifted.size());
+            for (std::size_t cell = 0; cell < std::min(parts.size(), shifted.size()); ++cell)
+            {
+                shifted[cell] = (parts[cell] + 1) % noProcs;
+            }
+            Dune::cpgrid::writePartitionCache(cacheFile, key, shifted, wellProcs);
+        }
+        grid.comm().broadcast(shifted.data(), shifted.size(), 0);
+
+        // Each process owns exactly the cells of the cached partitioning.
+        Dune::CpGrid shiftedGrid;
+        const auto owned = ownedGlobalIds(shiftedGrid);
+        const int rank = grid.comm().rank();
+        const auto numOwned = std::count(shifted.begin(), shifted.end(), rank);
+        BOOST_CHECK_EQUAL(owned.size(), std::size_t(numOwned));
+        for (const int id : owned)
+        {
+            BOOST_CHECK_EQUAL(shifted[id], rank);
+        }
+    }
+
+    grid.comm().barrier();
+    if (grid.comm().rank() == 0)
+    {
+        std::remove(cacheFile.c_str());
+    }
+}
+}
+
+// A grid with LGRs is distributed together with its refined level grids.
+BOOST_AUTO_TEST_CASE(loadBalanceGridWithLgrs)
+{
+for (auto partition_method : partition_methods) {
+    Dune::CpGrid grid;
+    grid.createCartesian({8, 8, 4}, {1.0, 1.0, 1.0});
+    grid.addLgrsUpdateLeafView({{2, 2, 2}, {3, 3, 3}}, {{1, 1, 0}, {5, 5, 2}}, {{3, 3, 2}, {7, 6, 4}},
+                               {"LGR1", "LGR2"});
+    // Only rank 0 has cells before load balancing.
+    const int leafCells = grid.comm().sum(grid.size(0));
+    BOOST_CHECK_EQUAL(leafCells, 8*8*4 - 8 - 4 + 8*8 + 4*27);
+
+    grid.loadBalance(1, partition_method);
+
+    BOOST_CHECK_EQUAL(grid.maxLevel(), 2);
+    BOOST_CHECK_EQUAL(grid.getLgrNameToLevel().at("LGR1"), 1);
+    BOOST_CHECK_EQUAL(grid.getLgrNameToLevel().at("LGR2"), 2);
+    int ownedLeafCells = 0;
+    for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior))
+    {
+        ++ownedLeafCells;
+        // Children are owned by the process owning their parent.
+        if (element.hasFather())
+        {
+            BOOST_CHECK(element.father().partitionType() == Dune::InteriorEntity);
+        }
+    }
+    BOOST_CHECK_EQUAL(grid.comm().sum(ownedLeafCells), leafCells);
+}
+}
+
+// An LGR is recreated from its block even if its logical Cartesian size
+// equals the one of the level zero grid.
+BOOST_AUTO_TEST_CASE(loadBalanceGridWithLgrOfLevelZeroSize)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({4, 4, 4}, {1.0, 1.0, 1.0});
+    grid.addLgrsUpdateLeafView({{2, 2, 2}}, {{1, 1, 1}}, {{3, 3, 3}}, {"LGR1"});
+    if (grid.comm().rank() == 0)
+    {
+        BOOST_CHECK(grid.currentData()[1]->logicalCartesianSize() == grid.currentData()[0]->logicalCartesianSize());
+    }
+    const int leafCells = grid.comm().sum(grid.size(0));
+    BOOST_CHECK_EQUAL(leafCells, 4*4*4 - 8 + 8*8);
+
+    grid.loadBalance(1, partition_methods[0]);
+
+    BOOST_CHECK_EQUAL(grid.maxLevel(), 1);
+    int ownedLeafCells = 0;
+    for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior))
+    {
+        static_cast<void>(element);
+        ++ownedLeafCells;
+    }
+    BOOST_CHECK_EQUAL(grid.comm().sum(ownedLeafCells), leafCells);
+}
+
+#if HAVE_MPI
+// Loading the saved parts of a distributed grid gives the same distributed grid.
+BOOST_AUTO_TEST_CASE(saveAndLoadDistributedGrid)
+{
+    Dune::CpGrid grid;
+    if (grid.comm().size() == 1)
+    {
+        return;
+    }
+    const std::string fileName = "distributed_grid_test";
+    grid.createCartesian({8, 8, 4}, {1.0, 1.0, 1.0});
+    grid.loadBalance(1, partition_methods[0]);
+    grid.saveDistributedGrid(fileName);
+
+    Dune::CpGrid loaded;
+    loaded.loadDistributedGrid(fileName);
+
+    BOOST_CHECK(loaded.logicalCartesianSize() == grid.logicalCartesianSize());
+    BOOST_REQUIRE_EQUAL(loaded.numCells(), grid.numCells());
+    BOOST_REQUIRE_EQUAL(loaded.size(3), grid.size(3));
+    BOOST_CHECK_EQUAL_COLLECTIONS(loaded.globalCell().begin(), loaded.globalCell().end(),
+                                  grid.globalCell().begin(), grid.globalCell().end());
+
+    const auto& gidSet = grid.globalIdSet();
+    const auto& loadedGidSet = loaded.globalIdSet();
+    auto loadedElement = loaded.leafGridView().begin<0>();
+    for (const auto& element : elements(grid.leafGridView()))
+    {
+        BOOST_CHECK_EQUAL(loadedGidSet.id(*loadedElement), gidSet.id(element));
+        BOOST_CHECK(loadedElement->partitionType() == element.partitionType());
+        BOOST_CHECK(loadedElement->geometry().center() == element.geometry().center());
+        ++loadedElement;
+    }
+    auto loadedVertex = loaded.leafGridView().begin<3>();
+    for (const auto& vertex : vertices(grid.leafGridView()))
+    {
+        BOOST_CHECK_EQUAL(loadedGidSet.id(*loadedVertex), gidSet.id(vertex));
+        BOOST_CHECK(loadedVertex->partitionType() == vertex.partitionType());
+        ++loadedVertex;
+    }
+
+    // Same parallel index set and neighbours, hence the same communication.
+    const auto& indexSet = grid.getCellIndexSet();
+    const auto& loadedIndexSet = loaded.getCellIndexSet();
+    BOOST_REQUIRE_EQUAL(loadedIndexSet.size(), indexSet.size());
+    for (const auto& index : indexSet)
+    {
+        const auto& loadedIndex = loadedIndexSet.at(index.global());
+        BOOST_CHECK_EQUAL(loadedIndex.local().local(), index.local().local());
+        BOOST_CHECK(loadedIndex.local().attribute() == index.local().attribute());
+    }
+    BOOST_CHECK_EQUAL(loaded.cellCommunication().remoteIndices().neighbours(),
+                      grid.cellCommunication().remoteIndices().neighbours());
+    loaded.comm().barrier();
+
+    // A corrupt or missing file on one process throws on all processes.
+    const std::string rankFileName = fileName + "." + std::to_string(grid.comm().rank());
+    if (grid.comm().rank() == 1)
+    {
+        std::ofstream(rankFileName, std::ios::binary | std::ios::trunc) << "corrupt";
+    }
+    Dune::CpGrid corrupt;
+    BOOST_CHECK_THROW(corrupt.loadDistributedGrid(fileName), std::runtime_error);
+    if (grid.comm().rank() == 1)
+    {
+        std::remove(rankFileName.c_str());
+    }
+    Dune::CpGrid missing;
+    BOOST_CHECK_THROW(missing.loadDistributedGrid(fileName), std::runtime_error);
+    BOOST_CHECK_EQUAL(missing.numCells(), 0);
+    loaded.comm().barrier();
+    std::remove(rankFileName.c_str());
+}
+
+// Repartitioning moves the cells and their data directly between the processes.
+BOOST_AUTO_TEST_CASE(repartition)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 8, 4}};
+    std::array<double, 3> size={{ 1.0, 1.0, 1.0}};
+    grid.createCartesian(dims, size);
+    BOOST_CHECK_THROW(grid.repartition({}), std::logic_error);
+    if (grid.comm().size() == 1)
+    {
+        return;
+    }
+    grid.loadBalance(1, partition_methods[0]);
+
+    // Move all owned cells to the next process.
+    const int rank = grid.comm().rank();
+    const int noProcs = grid.comm().size();
+    std::vector<int> parts(grid.size(0), (rank + 1) % noProcs);
+    int owned = 0;
+    for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior))
+    {
+        static_cast<void>(element);
+        ++owned;
+    }
+    std::vector<int> ownedBefore(noProcs);
+    grid.comm().allgather(&owned, 1, ownedBefore.data());
+
+    const int totalCells = dims[0] * dims[1] * dims[2];
+    const int totalPoints = (dims[0] + 1) * (dims[1] + 1) * (dims[2] + 1);
+    std::vector<int> cellIds(totalCells, -1);
+    std::vector<int> pointIds(totalPoints, -1);
+    LoadBalanceGlobalIdDataHandle handle(grid.globalIdSet(), grid, pointIds, cellIds);
+    grid.repartition(parts, handle);
+
+    owned = 0;
+    const auto& gidSet = grid.globalIdSet();
+    for (const auto& element : elements(grid.leafGridView()))
+    {
+        owned += element.partitionType() == Dune::InteriorEntity;
+        BOOST_CHECK_EQUAL(cellIds[element.index()], gidSet.id(element));
+    }
+    for (const auto& vertex : vertices(grid.leafGridView()))
+    {
+        BOOST_CHECK_EQUAL(pointIds[grid.leafIndexSet().index(vertex)], gidSet.id(vertex));
+    }
+    BOOST_CHECK_EQUAL(owned, ownedBefore[(rank + noProcs - 1) % noProcs]);
+    BOOST_CHECK(grid.size(0) > owned); // overlap layer
+    BOOST_CHECK_EQUAL(grid.comm().sum(owned), totalCells);
+    BOOST_CHECK_THROW(grid.scatterData(handle), std::runtime_error);
+}
+#endif
+
 // A small test that gathers/scatter the global cell indices.
 // On the sending side these are sent and on the receiving side
 // these are check with the globalCell values.
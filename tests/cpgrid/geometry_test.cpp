@@ -28,12 +28,14 @@
 #include <boost/test/tools/floating_point_comparison.hpp>
 #endif
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/GeometryHelpers.hpp>
 #include <opm/grid/cpgrid/CpGridData.hpp>
 #include <opm/grid/cpgrid/DefaultGeometryPolicy.hpp>
 #include <opm/grid/cpgrid/EntityRep.hpp>
 #include <opm/grid/cpgrid/Geometry.hpp>
 
 #include <algorithm>
+#include <vector>
 
 struct Fixture
 {
@@ -112,6 +114,47 @@ BOOST_AUTO_TEST_CASE(intersectiongeom)
 }
 
 
+namespace
+{
+    // GeometryHelpers take a container template with a single parameter.
+    template <class T>
+    struct PointList : std::vector<T>
+    {
+        using std::vector<T>::vector;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(fused_polygon_helpers)
+{
+    using namespace GeometryHelpers;
+    using Point = FieldVector<double, 3>;
+
+    // A non-planar, skewed quadrilateral and a triangle.
+    const PointList<Point> polygons[2] = {
+        { {0.0, 0.0, 0.0}, {2.0, 0.1, 0.3}, {2.2, 1.7, -0.2}, {-0.1, 1.0, 0.1} },
+        { {1.0, 0.0, 5.0}, {0.0, 3.0, 5.0}, {-1.0, 0.5, 4.0} },
+    };
+    const Point apex = {0.3, 0.4, -1.0};
+
+    for (const auto& pts : polygons) {
+        const Point centroid = polygonCentroid(pts, average(pts));
+        const Point normal = polygonNormal(pts, centroid);
+        const double area = polygonArea(pts, centroid);
+
+        Point fused_centroid;
+        Point fused_normal;
+        const double fused_area = polygonGeometry(pts, fused_centroid, fused_normal);
+        BOOST_CHECK_EQUAL(fused_area, area);
+        BOOST_CHECK_EQUAL(fused_centroid, centroid);
+        BOOST_CHECK_EQUAL(fused_normal, normal);
+
+        Point part_centroid;
+        const double part_volume = polygonCellVolumeCentroid(pts, centroid, apex, part_centroid);
+        BOOST_CHECK_EQUAL(part_volume, polygonCellVolume(pts, centroid, apex));
+        BOOST_CHECK_EQUAL(part_centroid, polygonCellCentroid(pts, centroid, apex));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(cellgeom)
 {
     typedef cpgrid::Geometry<3, 3> Geometry;
@@ -593,3 +636,65 @@ BOOST_AUTO_TEST_CASE(refine_patch)
 {
     refinePatch_and_check({}, {}, {});
 }
+
+BOOST_AUTO_TEST_CASE(compact_cell_geometry)
+{
+    CpGrid grid;
+    grid.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5});
+    BOOST_CHECK(!grid.compactCellGeometry());
+
+    const auto& grid_view = grid.leafGridView();
+    std::vector<cpgrid::Geometry<3, 3>> regular;
+    for (const auto& element : elements(grid_view)) {
+        regular.push_back(element.geometry());
+    }
+
+    grid.setCompactCellGeometry(true);
+    BOOST_CHECK(grid.compactCellGeometry());
+    BOOST_CHECK_THROW(grid.beginCellCentroids(), std::logic_error);
+    for (const auto& element : elements(grid_view)) {
+        const int cell = grid_view.indexSet().index(element);
+        const auto compact = element.geometry();
+        BOOST_CHECK_EQUAL(compact.volume(), regular[cell].volume());
+        BOOST_CHECK_EQUAL(compact.center(), regular[cell].center());
+        BOOST_CHECK_EQUAL(grid.cellVolume(cell), regular[cell].volume());
+        BOOST_CHECK_EQUAL(grid.cellCentroid(cell), regular[cell].center());
+        for (int corner = 0; corner < 8; ++corner) {
+            BOOST_CHECK_EQUAL(compact.corner(corner), regular[cell].corner(corner));
+        }
+    }
+
+    grid.setCompactCellGeometry(false);
+    BOOST_CHECK(!grid.compactCellGeometry());
+    for (const auto& element : elements(grid_view)) {
+        const int cell = grid_view.indexSet().index(element);
+        BOOST_CHECK_EQUAL(element.geometry().center(), regular[cell].center());
+        BOOST_CHECK_EQUAL(element.geometry().corner(7), regular[cell].corner(7));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(refined_level_corners_after_adapt)
+{
+    CpGrid grid;
+    grid.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5});
+    grid.addLgrsUpdateLeafView({{2, 2, 2}}, {{1, 1, 0}}, {{3, 2, 2}}, {"LGR1"});
+
+    // Refined cells are cuboids, their centroid is the mean of their corners.
+    const auto& level_view = grid.levelGridView(1);
+    int num_cells = 0;
+    for (const auto& element : elements(level_view)) {
+        const auto geometry = element.geometry();
+        BOOST_REQUIRE_EQUAL(geometry.corners(), 8);
+        FieldVector<double, 3> mean(0.0);
+        for (int corner = 0; corner < 8; ++corner) {
+            BOOST_CHECK_EQUAL(geometry.corner(corner), element.subEntity<3>(corner).geometry().center());
+            mean += geometry.corner(corner);
+        }
+        mean /= 8.0;
+        for (int dd = 0; dd < 3; ++dd) {
+            BOOST_CHECK_CLOSE(mean[dd], geometry.center()[dd], 1e-10);
+        }
+        ++num_cells;
+    }
+    BOOST_CHECK_EQUAL(num_cells, 2 * 1 * 2 * 8);
+}
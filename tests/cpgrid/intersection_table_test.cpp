@@ -0,0 +1,182 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE IntersectionTableTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <array>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+namespace
+{
+
+// What an intersection reports: id, boundary, neighbor, outside cell,
+// indexInInside, indexInOutside and boundaryId.
+using IntersectionData = std::array<int, 7>;
+
+std::vector<IntersectionData> intersectionData(const Dune::CpGrid& grid)
+{
+    std::vector<IntersectionData> result;
+    const auto gridView = grid.leafGridView();
+    for (const auto& element : elements(gridView)) {
+        for (const auto& intersection : intersections(gridView, element)) {
+            BOOST_CHECK_EQUAL(intersection.inside().index(), element.index());
+            result.push_back({intersection.id(),
+                              intersection.boundary(),
+                              intersection.neighbor(),
+                              intersection.neighbor() ? intersection.outside().index() : -1,
+                              intersection.indexInInside(),
+                              intersection.indexInOutside(),
+                              intersection.boundary() ? intersection.boundaryId() : 0});
+        }
+    }
+    return result;
+}
+
+void checkSameIntersections(Dune::CpGrid& grid)
+{
+    BOOST_CHECK(!grid.hasIntersectionTable());
+    const auto expected = intersectionData(grid);
+    grid.setIntersectionTable(true);
+    BOOST_CHECK(grid.hasIntersectionTable());
+    const auto actual = intersectionData(grid);
+    BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual[i].begin(), actual[i].end(),
+                                      expected[i].begin(), expected[i].end());
+    }
+
+    // The boundary ids follow the current setting.
+    grid.setUniqueBoundaryIds(true);
+    grid.setIntersectionTable(false);
+    const auto expectedUnique = intersectionData(grid);
+    grid.setIntersectionTable(true);
+    const auto actualUnique = intersectionData(grid);
+    for (std::size_t i = 0; i < expectedUnique.size(); ++i) {
+        BOOST_CHECK_EQUAL(actualUnique[i][6], expectedUnique[i][6]);
+    }
+    grid.setUniqueBoundaryIds(false);
+    grid.setIntersectionTable(false);
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(cartesian)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5});
+    checkSameIntersections(grid);
+}
+
+BOOST_AUTO_TEST_CASE(enabledBeforeBuild)
+{
+    Dune::CpGrid expected(Dune::MPIHelper::getLocalCommunicator());
+    expected.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5});
+
+    // Building the grid rebuilds the table requested for the empty grid.
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.setIntersectionTable(true);
+    BOOST_CHECK(grid.hasIntersectionTable());
+    grid.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5});
+    BOOST_CHECK(grid.hasIntersectionTable());
+    const auto actual = intersectionData(grid);
+    const auto withoutTable = intersectionData(expected);
+    BOOST_REQUIRE_EQUAL(actual.size(), withoutTable.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual[i].begin(), actual[i].end(),
+                                      withoutTable[i].begin(), withoutTable[i].end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(faultedWithInactiveCell)
+{
+    // The cells with i >= 2 are shifted down by half a layer, such that
+    // the cells on each side of the fault have two neighbors across it.
+    const int nx = 4, ny = 2, nz = 3;
+    std::vector<double> coord;
+    for (int j = 0; j <= ny; ++j) {
+        for (int i = 0; i <= nx; ++i) {
+            coord.insert(coord.end(), {double(i), double(j), 0.0, double(i), double(j), 10.0});
+        }
+    }
+    std::vector<double> zcorn(8 * nx * ny * nz);
+    for (int k = 0; k < 2 * nz; ++k) {
+        for (int j = 0; j < 2 * ny; ++j) {
+            for (int i = 0; i < 2 * nx; ++i) {
+                const double shift = (i / 2 >= 2) ? 0.5 : 0.0;
+                zcorn[i + 2 * nx * (j + 2 * ny * k)] = (k + 1) / 2 + shift;
+            }
+        }
+    }
+    std::vector<int> actnum(nx * ny * nz, 1);
+    actnum[1 + nx * (0 + ny * 1)] = 0;
+    grdecl g;
+    g.dims[0] = nx; g.dims[1] = ny; g.dims[2] = nz;
+    g.coord = coord.data();
+    g.zcorn = zcorn.data();
+    g.actnum = actnum.data();
+
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.processEclipseFormat(g, false);
+    BOOST_CHECK(grid.numFaces() > 0);
+    checkSameIntersections(grid);
+}
+
+BOOST_AUTO_TEST_CASE(renumberedAndDistributed)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({6, 5, 4}, {1.0, 1.0, 1.0});
+    grid.setIntersectionTable(true);
+    // Renumbering rebuilds the table.
+    grid.renumberCells(Dune::CellOrdering::reverseCuthillMcKee);
+    BOOST_CHECK(grid.hasIntersectionTable());
+    const auto withTable = intersectionData(grid);
+    grid.setIntersectionTable(false);
+    const auto withoutTable = intersectionData(grid);
+    BOOST_REQUIRE_EQUAL(withTable.size(), withoutTable.size());
+    for (std::size_t i = 0; i < withTable.size(); ++i) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(withTable[i].begin(), withTable[i].end(),
+                                      withoutTable[i].begin(), withoutTable[i].end());
+    }
+
+    if (grid.comm().size() > 1) {
+        grid.setIntersectionTable(true);
+        grid.loadBalance();
+        // The distributed view is new, the table must be requested again.
+        BOOST_CHECK(!grid.hasIntersectionTable());
+        // Overlap cells have faces whose outside cell is on another process.
+        checkSameIntersections(grid);
+    }
+}
@@ -0,0 +1,126 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE OverlapLayerTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/GridPartitioning.hpp>
+
+#include <set>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+namespace
+{
+
+/// The cells of a 4x4x1 grid, cell index i + 4*j, that are overlap of part.
+std::set<int> overlapOf(const std::vector<std::set<int>>& cell_overlap, int part)
+{
+    std::set<int> cells;
+    for (std::size_t cell = 0; cell < cell_overlap.size(); ++cell) {
+        if (cell_overlap[cell].count(part))
+            cells.insert(cell);
+    }
+    return cells;
+}
+
+int countInteriorCells(const Dune::CpGrid& grid)
+{
+    int count = 0;
+    for ([[maybe_unused]] const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior))
+        ++count;
+    return count;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(halves)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({4, 4, 1}, {1.0, 1.0, 1.0});
+    std::vector<int> cell_part(16);
+    for (int cell = 0; cell < 16; ++cell)
+        cell_part[cell] = (cell % 4) < 2 ? 0 : 1;
+
+    std::vector<std::set<int>> cell_overlap;
+    Dune::addOverlapLayer(grid, cell_part, cell_overlap, 0, 1, true);
+    BOOST_CHECK(overlapOf(cell_overlap, 0) == std::set<int>({2, 6, 10, 14}));
+    BOOST_CHECK(overlapOf(cell_overlap, 1) == std::set<int>({1, 5, 9, 13}));
+
+    cell_overlap.clear();
+    Dune::addOverlapLayer(grid, cell_part, cell_overlap, 0, 2, true);
+    BOOST_CHECK(overlapOf(cell_overlap, 0) == std::set<int>({2, 3, 6, 7, 10, 11, 14, 15}));
+    BOOST_CHECK(overlapOf(cell_overlap, 1) == std::set<int>({0, 1, 4, 5, 8, 9, 12, 13}));
+
+    // Without all only the overlap of mypart and the overlap of other parts
+    // among the cells of mypart are computed.
+    cell_overlap.clear();
+    Dune::addOverlapLayer(grid, cell_part, cell_overlap, 0, 1, false);
+    BOOST_CHECK(overlapOf(cell_overlap, 0) == std::set<int>({2, 6, 10, 14}));
+    BOOST_CHECK(overlapOf(cell_overlap, 1) == std::set<int>({1, 5, 9, 13}));
+}
+
+BOOST_AUTO_TEST_CASE(quadrantsWithCorner)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({4, 4, 1}, {1.0, 1.0, 1.0});
+    std::vector<int> cell_part(16);
+    for (int cell = 0; cell < 16; ++cell)
+        cell_part[cell] = ((cell % 4) < 2 ? 0 : 1) + ((cell / 4) < 2 ? 0 : 2);
+
+    std::vector<std::set<int>> cell_overlap;
+    Dune::addOverlapLayer(grid, cell_part, cell_overlap, 0, 1, true);
+    // Cell 10 only shares a corner with the cells of part 0.
+    BOOST_CHECK(overlapOf(cell_overlap, 0) == std::set<int>({2, 6, 8, 9, 10}));
+    BOOST_CHECK(overlapOf(cell_overlap, 3) == std::set<int>({5, 6, 7, 9, 13}));
+    for (int cell = 0; cell < 16; ++cell)
+        BOOST_CHECK(cell_overlap[cell].count(cell_part[cell]) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(loadBalanceLayers)
+{
+    Dune::CpGrid grid1;
+    grid1.createCartesian({8, 8, 4}, {1.0, 1.0, 1.0});
+    Dune::CpGrid grid2;
+    grid2.createCartesian({8, 8, 4}, {1.0, 1.0, 1.0});
+    if (grid1.comm().size() == 1)
+        return;
+
+    grid1.loadBalance(1, Dune::PartitionMethod::simple);
+    grid2.loadBalance(2, Dune::PartitionMethod::simple);
+    const auto& comm = grid1.comm();
+
+    // The same cells are owned, and the second layer adds overlap cells.
+    BOOST_CHECK_EQUAL(comm.sum(countInteriorCells(grid1)), 8 * 8 * 4);
+    BOOST_CHECK_EQUAL(comm.sum(countInteriorCells(grid2)), 8 * 8 * 4);
+    BOOST_CHECK_GT(comm.sum(grid2.size(0)), comm.sum(grid1.size(0)));
+}
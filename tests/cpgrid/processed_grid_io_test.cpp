@@ -0,0 +1,101 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE ProcessedGridIOTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+        Opm::OpmLog::setupSimpleDefaultLogging();
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_CASE(saveAndLoadProcessedGrid)
+{
+    const std::string fileName = "processed_grid_io_test.bin";
+    Dune::CpGrid grid;
+    grid.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5}, {1, 0, -2});
+    grid.saveProcessedGrid(fileName);
+
+    Dune::CpGrid loaded;
+    loaded.loadProcessedGrid(fileName);
+
+    BOOST_CHECK(loaded.logicalCartesianSize() == grid.logicalCartesianSize());
+    BOOST_REQUIRE_EQUAL(loaded.numCells(), grid.numCells());
+    BOOST_REQUIRE_EQUAL(loaded.numFaces(), grid.numFaces());
+    BOOST_REQUIRE_EQUAL(loaded.size(3), grid.size(3));
+    BOOST_CHECK_EQUAL_COLLECTIONS(loaded.globalCell().begin(), loaded.globalCell().end(),
+                                  grid.globalCell().begin(), grid.globalCell().end());
+
+    for (int cell = 0; cell < grid.numCells(); ++cell) {
+        BOOST_CHECK_EQUAL(loaded.cellVolume(cell), grid.cellVolume(cell));
+        BOOST_CHECK(loaded.cellCentroid(cell) == grid.cellCentroid(cell));
+        BOOST_REQUIRE_EQUAL(loaded.numCellFaces(cell), grid.numCellFaces(cell));
+        for (int local = 0; local < grid.numCellFaces(cell); ++local) {
+            BOOST_CHECK_EQUAL(loaded.cellFace(cell, local), grid.cellFace(cell, local));
+        }
+    }
+    for (int face = 0; face < grid.numFaces(); ++face) {
+        BOOST_CHECK_EQUAL(loaded.faceCell(face, 0), grid.faceCell(face, 0));
+        BOOST_CHECK_EQUAL(loaded.faceCell(face, 1), grid.faceCell(face, 1));
+        BOOST_CHECK_EQUAL(loaded.faceArea(face), grid.faceArea(face));
+        BOOST_CHECK(loaded.faceCentroid(face) == grid.faceCentroid(face));
+        BOOST_CHECK(loaded.faceNormal(face) == grid.faceNormal(face));
+        BOOST_REQUIRE_EQUAL(loaded.numFaceVertices(face), grid.numFaceVertices(face));
+        for (int local = 0; local < grid.numFaceVertices(face); ++local) {
+            BOOST_CHECK_EQUAL(loaded.faceVertex(face, local), grid.faceVertex(face, local));
+        }
+    }
+
+    // The cell geometries refer to the loaded corners.
+    auto elem = loaded.leafGridView().begin<0>();
+    for (const auto& element : elements(grid.leafGridView())) {
+        const auto& geom = element.geometry();
+        const auto& loadedGeom = elem->geometry();
+        BOOST_REQUIRE_EQUAL(loadedGeom.corners(), geom.corners());
+        for (int corner = 0; corner < geom.corners(); ++corner) {
+            BOOST_CHECK(loadedGeom.corner(corner) == geom.corner(corner));
+        }
+        ++elem;
+    }
+
+    Dune::CpGrid notEmpty;
+    notEmpty.createCartesian({1, 1, 1}, {1.0, 1.0, 1.0});
+    BOOST_CHECK_THROW(notEmpty.loadProcessedGrid(fileName), std::logic_error);
+
+    std::ofstream(fileName, std::ios::binary) << "not a grid";
+    Dune::CpGrid corrupt;
+    BOOST_CHECK_THROW(corrupt.loadProcessedGrid(fileName), std::runtime_error);
+    std::remove(fileName.c_str());
+}
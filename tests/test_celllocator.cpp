@@ -0,0 +1,155 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE CellLocatorTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/utility/CellLocator.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgpreprocess/preprocess.h>
+#include <opm/grid/polyhedralgrid.hh>
+
+#include <cmath>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+using Point = Dune::FieldVector<double, 3>;
+
+BOOST_AUTO_TEST_CASE(cartesian)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({4, 3, 2}, {1.0, 2.0, 0.5});
+    const auto gv = grid.leafGridView();
+    const Opm::CellLocator<Dune::CpGrid::LeafGridView> locator(gv, 1);
+    BOOST_CHECK_EQUAL(locator.numCells(), 24u);
+
+    std::vector<Point> points;
+    std::vector<int> expected;
+    for (int k = 0; k < 2; ++k) {
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 4; ++i) {
+                for (const double offset : {0.1, 0.5, 0.9}) {
+                    points.push_back({(i + offset) * 1.0, (j + offset) * 2.0, (k + 1.0 - offset) * 0.5});
+                    expected.push_back(i + 4 * (j + 3 * k));
+                }
+            }
+        }
+    }
+    // On the face between two cells, on a corner of eight and on the boundary.
+    points.push_back({1.0, 1.0, 0.25});
+    expected.push_back(0);
+    points.push_back({2.0, 2.0, 0.5});
+    expected.push_back(1 + 4 * 0);
+    points.push_back({0.0, 0.5, 0.25});
+    expected.push_back(0);
+    // Outside.
+    points.push_back({4.5, 1.0, 0.25});
+    expected.push_back(-1);
+    points.push_back({2.0, 3.0, -0.1});
+    expected.push_back(-1);
+
+    const auto cells = locator.locate(points);
+    BOOST_CHECK_EQUAL_COLLECTIONS(cells.begin(), cells.end(), expected.begin(), expected.end());
+    for (std::size_t p = 0; p < points.size(); ++p) {
+        BOOST_CHECK_EQUAL(locator.locate(points[p]), expected[p]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(deformedCornerPoint)
+{
+    // Tilted pillars and undulating, non-planar layers without faults.
+    const int nx = 5, ny = 4, nz = 3;
+    std::vector<double> coord(6 * (nx + 1) * (ny + 1));
+    for (int j = 0; j <= ny; ++j) {
+        for (int i = 0; i <= nx; ++i) {
+            double* c = &coord[6 * (i + (nx + 1) * j)];
+            c[0] = i;              c[1] = j;              c[2] = 0.0;
+            c[3] = i + 0.1 * j;    c[4] = j + 0.05 * i;   c[5] = 10.0;
+        }
+    }
+    auto depth = [](int i, int j, int k) { return 1.0 + k + 0.3 * std::sin(i + 0.7 * j); };
+    std::vector<double> zcorn(8 * nx * ny * nz);
+    for (int k = 0; k < nz; ++k) {
+        for (int j = 0; j < ny; ++j) {
+            for (int i = 0; i < nx; ++i) {
+                for (int kk = 0; kk < 2; ++kk) {
+                    for (int jj = 0; jj < 2; ++jj) {
+                        for (int ii = 0; ii < 2; ++ii) {
+                            const int ix = (2*i + ii) + 2*nx*((2*j + jj) + 2*ny*(2*k + kk));
+                            zcorn[ix] = depth(i + ii, j + jj, k + kk);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    grdecl g;
+    g.dims[0] = nx; g.dims[1] = ny; g.dims[2] = nz;
+    g.coord = coord.data();
+    g.zcorn = zcorn.data();
+    g.actnum = nullptr;
+
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.processEclipseFormat(g, false);
+    const auto gv = grid.leafGridView();
+    const Opm::CellLocator<Dune::CpGrid::LeafGridView> locator(gv);
+
+    for (const auto& element : elements(gv)) {
+        const auto& geometry = element.geometry();
+        for (const auto& local : {Point{0.5, 0.5, 0.5}, Point{0.2, 0.3, 0.25}, Point{0.8, 0.7, 0.75}}) {
+            const Point point = geometry.global(local);
+            BOOST_CHECK_EQUAL(locator.locate(point), element.index());
+            // The cells do not overlap.
+            int containing = 0;
+            for (int cell = 0; cell < grid.size(0); ++cell) {
+                containing += locator.contains(cell, point);
+            }
+            BOOST_CHECK_EQUAL(containing, 1);
+        }
+    }
+    BOOST_CHECK_EQUAL(locator.locate(Point{2.0, 2.0, 0.0}), -1);
+    BOOST_CHECK_EQUAL(locator.locate(Point{2.0, 2.0, 20.0}), -1);
+}
+
+BOOST_AUTO_TEST_CASE(polyhedralGrid)
+{
+    using Grid = Dune::PolyhedralGrid<3, 3>;
+    const Grid grid({3, 2, 2}, {1.0, 2.0, 0.5});
+    const auto gv = grid.leafGridView();
+    const Opm::CellLocator<Grid::LeafGridView> locator(gv);
+    for (const auto& element : elements(gv)) {
+        BOOST_CHECK_EQUAL(locator.locate(element.geometry().center()),
+                          int(gv.indexSet().index(element)));
+    }
+    BOOST_CHECK_EQUAL(locator.locate(Point{-0.5, 1.0, 0.25}), -1);
+}
@@ -6,7 +6,9 @@
 #define BOOST_TEST_MODULE ColumnExtractTest
 #include <boost/test/unit_test.hpp>
 #include <opm/grid/ColumnExtract.hpp>
+#include <opm/grid/CpGrid.hpp>
 #include <opm/grid/GridManager.hpp>
+#include <opm/grid/cpgpreprocess/preprocess.h>
 
 #if HAVE_ECL_INPUT
 #include <opm/input/eclipse/Parser/Parser.hpp>
@@ -17,6 +19,18 @@
 #include <cstddef>
 #include <iostream>
 
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
 BOOST_AUTO_TEST_CASE(SingleColumnTest)
 {
     using namespace Opm;
@@ -164,3 +178,93 @@ BOOST_AUTO_TEST_CASE(DisjointColumn)
     }
 #endif
 }
+
+
+BOOST_AUTO_TEST_CASE(CpGridFourByFourColumnTest)
+{
+    const int size_x = 4, size_y = 4, size_z = 10;
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({size_x, size_y, size_z}, {1.0, 1.0, 1.0});
+
+    const Opm::SparseTable<int> columns = Opm::extractColumns(grid);
+    BOOST_REQUIRE_EQUAL(columns.size(), size_x * size_y);
+    for (int i = 0; i < size_x * size_y; i++) {
+        std::vector<int> correct_answer;
+        for (int j = 0; j < size_z; j++) {
+            correct_answer.push_back(i + j*size_x*size_y);
+        }
+        BOOST_CHECK_EQUAL_COLLECTIONS(correct_answer.begin(), correct_answer.end(),
+                                      columns[i].begin(), columns[i].end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CpGridDisjointColumn)
+{
+    // The same grid as in DisjointColumn, with the centre cell inactive.
+    std::vector<double> coord;
+    for (int j = 0; j <= 3; ++j) {
+        for (int i = 0; i <= 3; ++i) {
+            coord.insert(coord.end(), {double(i), double(j), 0.0, double(i), double(j), 3.0});
+        }
+    }
+    std::vector<double> zcorn;
+    for (int k = 0; k < 3; ++k) {
+        zcorn.insert(zcorn.end(), 36, double(k));
+        zcorn.insert(zcorn.end(), 36, double(k + 1));
+    }
+    std::vector<int> actnum(27, 1);
+    actnum[13] = 0;
+    grdecl g;
+    g.dims[0] = 3; g.dims[1] = 3; g.dims[2] = 3;
+    g.coord = coord.data();
+    g.zcorn = zcorn.data();
+    g.actnum = actnum.data();
+
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.processEclipseFormat(g, false);
+
+    // Ordered by column, the split column (1, 1) gives two rows.
+    const std::vector<std::vector<int>> correct_answer = {
+        { 0,  9, 17}, { 1, 10, 18}, { 2, 11, 19}, { 3, 12, 20},
+        { 4 }, { 21 },
+        { 5, 13, 22}, { 6, 14, 23}, { 7, 15, 24}, { 8, 16, 25}
+    };
+    const Opm::SparseTable<int> columns = Opm::extractColumns(grid);
+    BOOST_REQUIRE_EQUAL(columns.size(), int(correct_answer.size()));
+    for (std::size_t col = 0; col < correct_answer.size(); ++col) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(correct_answer[col].begin(), correct_answer[col].end(),
+                                      columns[col].begin(), columns[col].end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CpGridColumnPartition)
+{
+    const int size_x = 4, size_y = 4, size_z = 10;
+    Dune::CpGrid grid;
+    grid.createCartesian({size_x, size_y, size_z}, {1.0, 1.0, 1.0});
+
+    const int num_parts = grid.comm().size();
+    const std::vector<int> parts = Opm::columnPartition(grid, Opm::extractColumns(grid), num_parts);
+    BOOST_REQUIRE_EQUAL(parts.size(), std::size_t(grid.numCells()));
+    std::vector<int> part_size(num_parts, 0);
+    for (int cell = 0; cell < grid.numCells(); ++cell) {
+        // All cells of a column are in the part of its top cell.
+        BOOST_CHECK_EQUAL(parts[cell], parts[cell % (size_x*size_y)]);
+        ++part_size[parts[cell]];
+    }
+    // Only rank 0 has the global grid.
+    grid.comm().sum(part_size.data(), num_parts);
+    for (const int size : part_size) {
+        BOOST_CHECK_EQUAL(size, size_x*size_y*size_z / num_parts);
+    }
+
+    if (num_parts > 1) {
+        grid.loadBalance(parts);
+        // Every rank has complete columns only.
+        const Opm::SparseTable<int> columns = Opm::extractColumns(grid);
+        for (int col = 0; col < columns.size(); ++col) {
+            BOOST_CHECK_EQUAL(columns[col].size(), std::size_t(size_z));
+        }
+        BOOST_CHECK_EQUAL(grid.comm().sum(columns.size()), size_x*size_y);
+    }
+}
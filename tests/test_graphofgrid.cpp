@@ -113,6 +113,56 @@ BOOST_AUTO_TEST_CASE(SimpleGraphWithVertexContraction)
 
 }
 
+// contract sets of vertices of different size, the resulting vertex
+// has the smallest ID of the contracted cells
+BOOST_AUTO_TEST_CASE(ContractionOfVertexSets)
+{
+    Dune::CpGrid grid;
+    std::array<int,3> dims{3,3,1};
+    std::array<double,3> size{3.,3.,1.};
+    grid.createCartesian(dims,size);
+    Opm::GraphOfGrid gog(grid);
+    if (grid.size(0)==0)
+        return;
+
+    // vertices 4, 5, 7, 8 form a set larger than {0,1},
+    // contracted vertices are referred to by their new ID
+    BOOST_REQUIRE(gog.contractVertices(8,7)==7);
+    BOOST_REQUIRE(gog.contractVertices(5,7)==5);
+    BOOST_REQUIRE(gog.contractVertices(5,4)==4);
+    BOOST_REQUIRE(gog.contractVertices(1,0)==0);
+    BOOST_REQUIRE(gog.contractVertices(1,4)==-1); // 1 is not a vertex anymore
+    BOOST_REQUIRE(gog.contractVertices(0,4)==0);
+    BOOST_REQUIRE(gog.size()==4);
+    BOOST_REQUIRE(gog.getVertex(0).weight==6.);
+    BOOST_REQUIRE_THROW(gog.getVertex(4),std::logic_error);
+
+    // remaining vertices are 0, 2, 3, 6
+    auto edgeL = gog.edgeList(0);
+    BOOST_REQUIRE(edgeL.size()==3);
+    BOOST_REQUIRE(edgeL[2]==2.); // via 1 and 5
+    BOOST_REQUIRE(edgeL[3]==2.); // via 0 and 4
+    BOOST_REQUIRE(edgeL[6]==1.); // via 7
+    BOOST_REQUIRE(gog.edgeList(6).size()==2);
+    BOOST_REQUIRE(gog.edgeList(6).at(0)==1.);
+
+    Opm::GraphOfGrid<Dune::CpGrid>::Edges edges;
+    int numVertices = 0;
+    for (const auto& v : gog)
+    {
+        BOOST_REQUIRE(gog.getEdges(v.first, edges));
+        BOOST_REQUIRE(edges.size()==v.second.edges.size());
+        BOOST_REQUIRE(std::equal(edges.begin(), edges.end(), v.second.edges.begin(),
+                                 [](const auto& a, const auto& b)
+                                 { return a.first==b.first && a.second==b.second; }));
+        BOOST_REQUIRE(gog.vertexWeight(v.first)==v.second.weight);
+        ++numVertices;
+    }
+    BOOST_REQUIRE(numVertices==gog.size());
+    BOOST_REQUIRE(!gog.getEdges(5, edges));
+    BOOST_REQUIRE(edges.empty());
+}
+
 BOOST_AUTO_TEST_CASE(SimpleGraphWithTransmissibilities)
 {
     Dune::CpGrid grid;
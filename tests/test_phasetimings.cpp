@@ -0,0 +1,128 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE PhaseTimingsTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/utility/PhaseTimings.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+        Opm::OpmLog::setupSimpleDefaultLogging();
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_CASE(accumulate)
+{
+    Opm::PhaseTimings timings;
+    for (int i = 0; i < 3; ++i) {
+        Opm::PhaseTimings::Scope outer(&timings, "outer");
+        outer.setItems(10);
+        {
+            Opm::PhaseTimings::Scope inner(&timings, "inner");
+            std::vector<double> work(100000, 1.0);
+            inner.setItems(work.size());
+        }
+    }
+    {
+        // Nothing is recorded without timings.
+        Opm::PhaseTimings::Scope ignored(nullptr, "ignored");
+    }
+
+    const auto& phases = timings.phases();
+    BOOST_REQUIRE_EQUAL(phases.size(), 2u);
+    BOOST_CHECK_EQUAL(phases[0].name, "inner");
+    BOOST_CHECK_EQUAL(phases[1].name, "outer");
+    BOOST_CHECK_EQUAL(phases[0].calls, 3);
+    BOOST_CHECK_EQUAL(phases[0].items, 300000u);
+    BOOST_CHECK_EQUAL(phases[1].items, 30u);
+    BOOST_CHECK_GE(phases[1].seconds, phases[0].seconds);
+    BOOST_CHECK_GE(phases[0].peakRssIncrease, 0);
+    BOOST_CHECK(timings.phase("ignored") == nullptr);
+    BOOST_CHECK(timings.phase("outer") == &phases[1]);
+
+    // A stopped scope is only recorded once.
+    {
+        Opm::PhaseTimings::Scope phase(&timings, "stopped");
+        phase.stop();
+    }
+    BOOST_CHECK_EQUAL(timings.phase("stopped")->calls, 1);
+
+    std::ostringstream json;
+    timings.writeJson(json);
+    const auto str = json.str();
+    BOOST_CHECK_EQUAL(str.front(), '[');
+    BOOST_CHECK_EQUAL(str.back(), ']');
+    BOOST_CHECK(str.find("{\"name\": \"outer\", \"seconds\": ") != std::string::npos);
+    BOOST_CHECK(str.find("\"items\": 30, \"calls\": 3}") != std::string::npos);
+
+    timings.clear();
+    BOOST_CHECK(timings.phases().empty());
+}
+
+BOOST_AUTO_TEST_CASE(gridSetup)
+{
+    Dune::CpGrid grid;
+    grid.createCartesian({4, 3, 2}, {1.0, 1.0, 1.0});
+    const auto& timings = grid.setupTimings();
+
+    if (grid.comm().rank() == 0) {
+        for (const auto* name : {"process_grdecl", "filterNNCs", "buildTopo", "buildGeom"}) {
+            BOOST_CHECK_MESSAGE(timings.phase(name) != nullptr, name);
+        }
+        BOOST_CHECK_EQUAL(timings.phase("process_grdecl")->items, 24u);
+        BOOST_CHECK_EQUAL(timings.phase("buildGeom")->items, 24u);
+        BOOST_CHECK_EQUAL(timings.phase("buildTopo")->items, std::size_t(grid.numFaces()));
+    }
+
+    if (grid.comm().size() > 1) {
+        grid.loadBalance();
+        for (const auto* name : {"loadBalance", "partition", "addOverlapLayer",
+                                 "distributeGlobalGrid", "computeCommunicationInterfaces"}) {
+            BOOST_CHECK_MESSAGE(timings.phase(name) != nullptr, name);
+        }
+        BOOST_CHECK_EQUAL(timings.phase("distributeGlobalGrid")->items, std::size_t(grid.size(0)));
+    }
+
+    std::ostringstream json;
+    grid.writeSetupTimings(json);
+    if (grid.comm().rank() == 0) {
+        const auto str = json.str();
+        BOOST_CHECK(str.find("{\"ranks\": [") == 0);
+        BOOST_CHECK(str.find("{\"rank\": " + std::to_string(grid.comm().size() - 1)) != std::string::npos);
+        BOOST_CHECK(str.find("\"name\": \"buildTopo\"") != std::string::npos);
+    } else {
+        BOOST_CHECK(json.str().empty());
+    }
+}
@@ -0,0 +1,124 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE PolyhedralGridLoadBalanceTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/polyhedralgrid.hh>
+
+#include <cstddef>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+using Grid = Dune::PolyhedralGrid<3, 3>;
+
+/// Data handle moving or communicating the global ids of the cells.
+class GlobalIdHandle
+{
+public:
+    using DataType = std::size_t;
+
+    GlobalIdHandle(const Grid& grid, std::vector<std::size_t>& ids)
+        : grid_(grid), ids_(ids)
+    {}
+
+    bool contains(int /* dim */, int codim) const
+    {
+        return codim == 0;
+    }
+
+    bool fixedSize(int /* dim */, int /* codim */) const
+    {
+        return true;
+    }
+
+    template <class Entity>
+    std::size_t size(const Entity&) const
+    {
+        return 1;
+    }
+
+    template <class Buffer, class Entity>
+    void gather(Buffer& buffer, const Entity& entity) const
+    {
+        buffer.write(ids_[grid_.leafIndexSet().index(entity)]);
+    }
+
+    template <class Buffer, class Entity>
+    void scatter(Buffer& buffer, const Entity& entity, std::size_t)
+    {
+        ids_.resize(grid_.size(0));
+        buffer.read(ids_[grid_.leafIndexSet().index(entity)]);
+    }
+
+private:
+    const Grid& grid_;
+    std::vector<std::size_t>& ids_;
+};
+
+BOOST_AUTO_TEST_CASE(loadBalanceAndCommunicate)
+{
+    Grid grid(std::vector<int>{4, 4, 4}, std::vector<double>{1.0, 1.0, 1.0});
+    const auto& globalIdSet = grid.globalIdSet();
+
+    std::vector<std::size_t> movedIds(grid.size(0));
+    for (const auto& element : elements(grid.leafGridView())) {
+        movedIds[grid.leafIndexSet().index(element)] = globalIdSet.id(element);
+    }
+    GlobalIdHandle moveHandle(grid, movedIds);
+    const bool changed = grid.loadBalance(moveHandle, Dune::PartitionMethod::simple);
+    BOOST_CHECK_EQUAL(changed, grid.comm().size() > 1);
+    BOOST_CHECK_EQUAL(grid.overlapSize(0), grid.comm().size() > 1 ? 1 : 0);
+
+    int interior = 0;
+    for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior)) {
+        BOOST_CHECK(element.partitionType() == Dune::InteriorEntity);
+        ++interior;
+    }
+    BOOST_CHECK_EQUAL(grid.comm().sum(interior), 4 * 4 * 4);
+    if (grid.comm().size() > 1) {
+        BOOST_CHECK(interior < grid.size(0));
+    }
+
+    // Only the owners know the ids, the overlap cells get them by communication.
+    std::vector<std::size_t> ids(grid.size(0), std::size_t(-1));
+    for (const auto& element : elements(grid.leafGridView(), Dune::Partitions::interior)) {
+        ids[grid.leafIndexSet().index(element)] = globalIdSet.id(element);
+    }
+    GlobalIdHandle handle(grid, ids);
+    grid.communicate(handle, Dune::InteriorBorder_All_Interface, Dune::ForwardCommunication);
+
+    for (const auto& element : elements(grid.leafGridView())) {
+        const auto index = grid.leafIndexSet().index(element);
+        BOOST_CHECK_EQUAL(ids[index], globalIdSet.id(element));
+        BOOST_CHECK_EQUAL(movedIds[index], globalIdSet.id(element));
+    }
+}
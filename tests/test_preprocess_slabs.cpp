@@ -0,0 +1,266 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define NVERBOSE
+
+#define BOOST_TEST_MODULE PreprocessSlabs
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+namespace {
+
+// Corner-point model with sloping pillars, cell corners displaced
+// independently along the pillars (which creates fault intersections),
+// collapsed cells and inactive cells.
+struct FaultedModel
+{
+    FaultedModel(int nx, int ny, int nz, unsigned seed, bool left_handed = false)
+        : dims{nx, ny, nz}
+        , coord(6 * (nx + 1) * (ny + 1))
+        , zcorn(8 * nx * ny * nz)
+        , actnum(nx * ny * nz)
+        , aquifer(nx * ny * nz, 0)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> unif(0.0, 1.0);
+
+        for (int j = 0; j <= ny; ++j) {
+            for (int i = 0; i <= nx; ++i) {
+                double* c = &coord[6 * (i + (nx + 1) * j)];
+                const double y = left_handed ? -j : j;
+                c[0] = i;   c[1] = y;   c[2] = 0.0;
+                c[3] = i + 0.1*unif(gen);   c[4] = y;   c[5] = 10.0;
+            }
+        }
+        for (std::size_t c = 0; c < actnum.size(); ++c) {
+            actnum[c] = unif(gen) > 0.15;
+            aquifer[c] = actnum[c] && unif(gen) > 0.9;
+        }
+        for (int j = 0; j < ny; ++j) {
+            for (int i = 0; i < nx; ++i) {
+                std::array<double, 4> z;
+                for (auto& zz : z) {
+                    zz = unif(gen) > 0.4 ? 2.0*unif(gen) : 0.0;
+                }
+                for (int k = 0; k < nz; ++k) {
+                    for (int jj = 0; jj < 2; ++jj) {
+                        for (int ii = 0; ii < 2; ++ii) {
+                            const double thickness = unif(gen) > 0.2 ? unif(gen) + 0.1 : 0.0;
+                            const int ix = (2*i + ii) + 2*nx*((2*j + jj) + 2*ny*2*k);
+                            zcorn[ix] = z[ii + 2*jj];
+                            zcorn[ix + 4*nx*ny] = z[ii + 2*jj] + thickness;
+                            z[ii + 2*jj] += thickness;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    grdecl input() const
+    {
+        grdecl g;
+        std::copy(dims.begin(), dims.end(), g.dims);
+        g.coord = coord.data();
+        g.zcorn = zcorn.data();
+        g.actnum = actnum.data();
+        return g;
+    }
+
+    std::array<int, 3> dims;
+    std::vector<double> coord;
+    std::vector<double> zcorn;
+    std::vector<int> actnum;
+    std::vector<int> aquifer;
+};
+
+template <class T>
+void checkEqual(const T* a, const T* b, std::size_t n)
+{
+    BOOST_CHECK_EQUAL_COLLECTIONS(a, a + n, b, b + n);
+}
+
+void checkEqual(const processed_grid& a, const processed_grid& b)
+{
+    BOOST_REQUIRE_EQUAL(a.number_of_faces, b.number_of_faces);
+    BOOST_REQUIRE_EQUAL(a.number_of_nodes, b.number_of_nodes);
+    BOOST_REQUIRE_EQUAL(a.number_of_nodes_on_pillars, b.number_of_nodes_on_pillars);
+    BOOST_REQUIRE_EQUAL(a.number_of_cells, b.number_of_cells);
+
+    const std::size_t nf = a.number_of_faces;
+    checkEqual(a.face_ptr, b.face_ptr, nf + 1);
+    checkEqual(a.face_nodes, b.face_nodes, a.face_ptr[nf]);
+    checkEqual(a.face_neighbors, b.face_neighbors, 2*nf);
+    checkEqual(a.face_tag, b.face_tag, nf);
+    // Bitwise identical coordinates.
+    checkEqual(a.node_coordinates, b.node_coordinates, 3*std::size_t(a.number_of_nodes));
+    checkEqual(a.local_cell_index, b.local_cell_index, a.number_of_cells);
+}
+
+void checkSlabsMatchSerial(const FaultedModel& model, bool use_aquifer, int pinchActive)
+{
+    const grdecl g = model.input();
+    const int* aquifer = use_aquifer ? model.aquifer.data() : nullptr;
+
+    processed_grid serial;
+    BOOST_REQUIRE(process_grdecl_serial(&g, 0.0, aquifer, &serial, pinchActive));
+
+    // Possibly threaded.
+    processed_grid grid;
+    BOOST_REQUIRE(process_grdecl(&g, 0.0, aquifer, &grid, pinchActive));
+    checkEqual(serial, grid);
+    free_processed_grid(&grid);
+
+    for (int nslabs = 1; nslabs <= model.dims[1]; ++nslabs) {
+        BOOST_TEST_MESSAGE("Number of slabs: " << nslabs);
+        processed_grid slabs;
+        BOOST_REQUIRE(process_grdecl_slabs(&g, 0.0, aquifer, nslabs, &slabs, pinchActive));
+        checkEqual(serial, slabs);
+        free_processed_grid(&slabs);
+    }
+
+    free_processed_grid(&serial);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SlabsMatchSerial)
+{
+    for (unsigned seed = 0; seed < 10; ++seed) {
+        const FaultedModel model(1 + seed % 4, 2 + seed, 1 + seed % 3, seed);
+        checkSlabsMatchSerial(model, false, 0);
+        checkSlabsMatchSerial(model, false, 1);
+        checkSlabsMatchSerial(model, true, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedMatchesSerial)
+{
+    // Tall enough for process_grdecl() to use several slabs if threaded.
+    const FaultedModel model(5, 64, 4, 42);
+    const grdecl g = model.input();
+
+    processed_grid serial, grid;
+    BOOST_REQUIRE(process_grdecl_serial(&g, 0.0, model.aquifer.data(), &serial, 0));
+    BOOST_REQUIRE(process_grdecl(&g, 0.0, model.aquifer.data(), &grid, 0));
+    checkEqual(serial, grid);
+    free_processed_grid(&grid);
+    free_processed_grid(&serial);
+}
+
+BOOST_AUTO_TEST_CASE(SlabsMatchSerialLeftHanded)
+{
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        const FaultedModel model(3, 4 + seed, 2, seed, true);
+        checkSlabsMatchSerial(model, false, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DistributedCreateCartesianAndGrdecl)
+{
+    // All ranks call createCartesian() and processEclipseFormat(), and the
+    // ranks other than 0 take part in the preprocessing.
+    Dune::CpGrid serial;
+    serial.createCartesian({3, 8, 2}, {1.0, 2.0, 3.0});
+    Dune::CpGrid distributed;
+    distributed.setDistributedPreprocessing(true);
+    distributed.createCartesian({3, 8, 2}, {1.0, 2.0, 3.0});
+
+    BOOST_REQUIRE_EQUAL(serial.size(0), distributed.size(0));
+    BOOST_REQUIRE_EQUAL(serial.numFaces(), distributed.numFaces());
+    for (int c = 0; c < serial.size(0); ++c) {
+        BOOST_CHECK_EQUAL(serial.cellVolume(c), distributed.cellVolume(c));
+    }
+    BOOST_CHECK(serial.logicalCartesianSize() == distributed.logicalCartesianSize());
+
+    const FaultedModel model(4, 7, 3, 17);
+    const grdecl g = model.input();
+    Dune::CpGrid fromGrdecl;
+    fromGrdecl.setDistributedPreprocessing(true);
+    fromGrdecl.processEclipseFormat(g, false);
+    if (fromGrdecl.comm().rank() == 0) {
+        processed_grid expected;
+        BOOST_REQUIRE(process_grdecl_serial(&g, 0.0, nullptr, &expected, 0));
+        BOOST_CHECK_EQUAL(fromGrdecl.size(0), expected.number_of_cells);
+        free_processed_grid(&expected);
+    } else {
+        BOOST_CHECK_EQUAL(fromGrdecl.size(0), 0);
+    }
+}
+
+#if HAVE_ECL_INPUT
+BOOST_AUTO_TEST_CASE(DistributedProcessEclipseFormat)
+{
+    const FaultedModel model(4, 7, 3, 17);
+    const Opm::EclipseGrid ecl_grid(model.dims, model.coord, model.zcorn, model.actnum.data());
+
+    Dune::CpGrid serial;
+    Dune::CpGrid distributed;
+    distributed.setDistributedPreprocessing(true);
+    BOOST_CHECK(distributed.distributedPreprocessing());
+
+    const bool is_root = serial.comm().rank() == 0;
+    serial.processEclipseFormat(is_root ? &ecl_grid : nullptr, nullptr, false, false, false);
+    distributed.processEclipseFormat(is_root ? &ecl_grid : nullptr, nullptr, false, false, false);
+
+    BOOST_REQUIRE_EQUAL(serial.size(0), distributed.size(0));
+    BOOST_REQUIRE_EQUAL(serial.numFaces(), distributed.numFaces());
+    BOOST_REQUIRE_EQUAL(serial.size(3), distributed.size(3));
+
+    for (int c = 0; c < serial.size(0); ++c) {
+        BOOST_CHECK_EQUAL(serial.cellVolume(c), distributed.cellVolume(c));
+        BOOST_CHECK(serial.cellCentroid(c) == distributed.cellCentroid(c));
+        BOOST_CHECK_EQUAL(serial.numCellFaces(c), distributed.numCellFaces(c));
+    }
+    for (int f = 0; f < serial.numFaces(); ++f) {
+        BOOST_CHECK(serial.faceCentroid(f) == distributed.faceCentroid(f));
+        BOOST_CHECK_EQUAL(serial.faceCell(f, 0), distributed.faceCell(f, 0));
+        BOOST_CHECK_EQUAL(serial.faceCell(f, 1), distributed.faceCell(f, 1));
+    }
+}
+#endif
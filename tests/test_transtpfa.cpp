@@ -0,0 +1,147 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TransTpfaTest
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/GridHelpers.hpp>
+#include <opm/grid/transmissibility/CpGridTransTpfa.hpp>
+#include <opm/grid/transmissibility/TransTpfa.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+namespace
+{
+
+const std::array<double,3> cellSize = {1.0, 2.0, 0.5};
+const std::array<double,3> permDiagonal = {100.0, 200.0, 50.0};
+
+// The direction of a face of a cartesian grid.
+int faceDirection(const Dune::CpGrid& grid, int face)
+{
+    const auto& normal = grid.faceNormal(face);
+    for (int dir = 0; dir < 3; ++dir) {
+        if (std::abs(normal[dir]) > 0.5)
+            return dir;
+    }
+    return -1;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(cartesianDiagonal)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({3, 2, 2}, cellSize);
+    const int numCells = grid.numCells();
+    const int numFaces = grid.numFaces();
+
+    std::vector<double> perm(9 * numCells, 0.0);
+    std::vector<double> permDiag(3 * numCells);
+    for (int c = 0; c < numCells; ++c) {
+        for (int dir = 0; dir < 3; ++dir) {
+            perm[9 * c + 4 * dir] = permDiagonal[dir];
+            permDiag[3 * c + dir] = permDiagonal[dir];
+        }
+    }
+
+    const Opm::CpGridTransTpfa tpfa(grid);
+    BOOST_REQUIRE_EQUAL(tpfa.numHalfFaces(), std::size_t(grid.numCellFaces()));
+    std::vector<double> htrans(tpfa.numHalfFaces());
+    std::vector<double> htransDiag(tpfa.numHalfFaces());
+    tpfa.halfTransmissibilities(perm.data(), htrans.data());
+    tpfa.halfTransmissibilitiesDiagonal(permDiag.data(), htransDiag.data());
+
+    for (int c = 0; c < numCells; ++c) {
+        for (int local = 0; local < grid.numCellFaces(c); ++local) {
+            const int i = tpfa.halfFaceStart(c) + local;
+            const int dir = faceDirection(grid, grid.cellFace(c, local));
+            const double area = cellSize[0] * cellSize[1] * cellSize[2] / cellSize[dir];
+            const double expected = permDiagonal[dir] * area / (0.5 * cellSize[dir]);
+            BOOST_CHECK_CLOSE(htrans[i], expected, 1e-10);
+            BOOST_CHECK_CLOSE(htransDiag[i], expected, 1e-10);
+        }
+    }
+
+    std::vector<double> trans(numFaces);
+    tpfa.transmissibilities(htrans.data(), trans.data());
+    std::vector<double> totmob(numCells, 2.0);
+    std::vector<double> effTrans(numFaces);
+    tpfa.effectiveTransmissibilities(totmob.data(), htrans.data(), effTrans.data());
+    for (int f = 0; f < numFaces; ++f) {
+        const int dir = faceDirection(grid, f);
+        const double area = cellSize[0] * cellSize[1] * cellSize[2] / cellSize[dir];
+        const bool interior = grid.faceCell(f, 0) >= 0 && grid.faceCell(f, 1) >= 0;
+        // Boundary faces only have the half-transmissibility of their cell.
+        const double expected = permDiagonal[dir] * area / (interior ? cellSize[dir] : 0.5 * cellSize[dir]);
+        BOOST_CHECK_CLOSE(trans[f], expected, 1e-10);
+        BOOST_CHECK_CLOSE(effTrans[f], 2.0 * expected, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fullTensorMatchesGeneric)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({3, 2, 2}, cellSize);
+    const int numCells = grid.numCells();
+
+    // Symmetric positive definite tensors that differ between cells.
+    std::vector<double> perm(9 * numCells);
+    for (int c = 0; c < numCells; ++c) {
+        double* K = perm.data() + 9 * c;
+        K[0] = 100.0 + c; K[3] = 10.0;        K[6] = 5.0;
+        K[1] = 10.0;      K[4] = 200.0 - c;   K[7] = 2.0;
+        K[2] = 5.0;       K[5] = 2.0;         K[8] = 50.0 + 2 * c;
+    }
+
+    const std::size_t numHalfFaces = grid.numCellFaces();
+    std::vector<double> expected(numHalfFaces);
+    std::vector<double> htrans(numHalfFaces);
+    tpfa_htrans_compute<Dune::CpGrid>(&grid, perm.data(), expected.data());
+    tpfa_htrans_compute(&grid, perm.data(), htrans.data());
+    for (std::size_t i = 0; i < numHalfFaces; ++i) {
+        BOOST_CHECK_CLOSE(htrans[i], expected[i], 1e-10);
+    }
+
+    std::vector<double> expectedTrans(grid.numFaces());
+    std::vector<double> trans(grid.numFaces());
+    tpfa_trans_compute<Dune::CpGrid>(&grid, expected.data(), expectedTrans.data());
+    tpfa_trans_compute(&grid, htrans.data(), trans.data());
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        BOOST_CHECK_CLOSE(trans[f], expectedTrans[f], 1e-10);
+    }
+}
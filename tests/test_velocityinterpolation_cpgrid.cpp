@@ -0,0 +1,141 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE VelocityInterpolationCpGridTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/utility/VelocityInterpolation.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+struct Fixture
+{
+    Fixture()
+    {
+        int m_argc = boost::unit_test::framework::master_test_suite().argc;
+        char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+        Dune::MPIHelper::instance(m_argc, m_argv);
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+namespace
+{
+
+using Point = Dune::FieldVector<double, 3>;
+using Velocity = std::function<Point(const Point&)>;
+
+// Flux through each face of the velocity field v, exact if v is linear
+// in the direction of the face normal only.
+std::vector<double> computeFlux(const Dune::CpGrid& grid, const Velocity& v)
+{
+    std::vector<double> flux(grid.numFaces());
+    for (int face = 0; face < grid.numFaces(); ++face) {
+        flux[face] = (v(grid.faceCentroid(face)) * grid.faceNormal(face)) * grid.faceArea(face);
+    }
+    return flux;
+}
+
+// Some points inside each cell, and the cell containing them.
+void samplePoints(const Dune::CpGrid& grid, std::vector<int>& cells, std::vector<double>& x)
+{
+    for (const auto& element : elements(grid.leafGridView())) {
+        const auto& geometry = element.geometry();
+        for (const auto& local : {Point{0.5, 0.5, 0.5}, Point{0.1, 0.8, 0.3}, Point{1.0, 0.0, 0.6}}) {
+            const Point point = geometry.global(local);
+            cells.push_back(element.index());
+            x.insert(x.end(), point.begin(), point.end());
+        }
+    }
+}
+
+void checkReproduces(const Velocity& v)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({3, 2, 2}, {1.0, 2.0, 0.5});
+    Opm::VelocityInterpolationECVI interp(grid);
+    const std::vector<double> flux = computeFlux(grid, v);
+    interp.setupFluxes(flux.data());
+
+    std::vector<int> cells;
+    std::vector<double> x;
+    samplePoints(grid, cells, x);
+    for (std::size_t p = 0; p < cells.size(); ++p) {
+        const Point point{x[3*p], x[3*p + 1], x[3*p + 2]};
+        const Point expected = v(point);
+        Point interpolated;
+        interp.interpolate(cells[p], &point[0], &interpolated[0]);
+        for (int dd = 0; dd < 3; ++dd) {
+            BOOST_CHECK_CLOSE(interpolated[dd], expected[dd], 1e-8);
+        }
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(constantVelocity)
+{
+    checkReproduces([](const Point&) { return Point{1.0, -0.5, 0.25}; });
+}
+
+BOOST_AUTO_TEST_CASE(linearVelocity)
+{
+    checkReproduces([](const Point& x) { return Point{1.0 + 0.5*x[0], 5.0 - x[1], 0.3 + 4.0*x[2]}; });
+}
+
+BOOST_AUTO_TEST_CASE(batchedMatchesSingle)
+{
+    Dune::CpGrid grid(Dune::MPIHelper::getLocalCommunicator());
+    grid.createCartesian({4, 3, 2}, {1.0, 1.0, 1.0});
+    Opm::VelocityInterpolationECVI interp(grid);
+    // A field that is not reproduced exactly.
+    const std::vector<double> flux = computeFlux(grid, [](const Point& x)
+    {
+        return Point{x[1]*x[2], std::sin(x[0]), x[0]*x[1]};
+    });
+    interp.setupFluxes(flux.data());
+    BOOST_CHECK_EQUAL(interp.scratchSize(), 8);
+
+    std::vector<int> cells;
+    std::vector<double> x;
+    samplePoints(grid, cells, x);
+    const int num_points = cells.size();
+    std::vector<double> v(3*num_points);
+    interp.interpolate(num_points, cells.data(), x.data(), v.data());
+
+    std::vector<double> scratch(interp.scratchSize());
+    for (int p = 0; p < num_points; ++p) {
+        std::array<double, 3> single;
+        std::array<double, 3> with_scratch;
+        interp.interpolate(cells[p], &x[3*p], single.data());
+        interp.interpolate(cells[p], &x[3*p], with_scratch.data(), scratch.data());
+        for (int dd = 0; dd < 3; ++dd) {
+            BOOST_CHECK_EQUAL(v[3*p + dd], single[dd]);
+            BOOST_CHECK_EQUAL(v[3*p + dd], with_scratch[dd]);
+        }
+    }
+}